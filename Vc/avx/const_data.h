@@ -81,6 +81,27 @@ template<> struct c_log<double>
     alignas(64) static const unsigned long long data[21];
 };
 
+/**\internal
+ * A table of vpermd indexes with one row per mask bit pattern. Every row packs the eight
+ * 32-bit lane indexes into nibbles. Bit 3 of a nibble marks a lane that is zeroed.
+ */
+template <std::size_t Rows> struct alignas(64) PermuteTable
+{
+    unsigned int data[Rows];
+};
+
+/**\internal
+ * vpermd indexes for Detail::compress and Detail::expand, indexed by Mask::toInt(). The
+ * suffix is the entry size in bits.
+ */
+struct c_compress
+{
+    static const PermuteTable<256> compress32;
+    static const PermuteTable<16> compress64;
+    static const PermuteTable<256> expand32;
+    static const PermuteTable<16> expand64;
+};
+
 }  // namespace AVX
 }  // namespace Vc
 
@@ -94,6 +115,7 @@ namespace AVX2
     using AVX::c_general;
     using AVX::c_trig;
     using AVX::c_log;
+    using AVX::c_compress;
 }  // namespace AVX2
 }  // namespace Vc
 
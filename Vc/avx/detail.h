@@ -583,6 +583,48 @@ template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 4, __m256>(__m256i k)
     return _mm256_castsi256_ps(AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)));
 }
 
+#ifdef Vc_IMPL_AVX2
+// 32 -> 4
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 4, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi64(AVX::lo128(k)));
+}
+
+// 32 -> 8
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 8, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi32(AVX::lo128(k)));
+}
+
+// 32 -> 16
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<32, 16, __m256>(__m256i k)
+{
+    return _mm256_castsi256_ps(_mm256_cvtepi8_epi16(AVX::lo128(k)));
+}
+
+// 4 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<4, 32, __m256>(__m256i k)
+{
+    // aaaa bbbb cccc dddd -> abcd 0000 0000 0000 0000 0000 0000 0000
+    return AVX::zeroExtend(AVX::avx_cast<__m128>(_mm_packs_epi16(
+        AVX::avx_cast<__m128i>(mask_cast<4, 8, __m128>(k)), _mm_setzero_si128())));
+}
+
+// 8 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<8, 32, __m256>(__m256i k)
+{
+    return AVX::zeroExtend(AVX::avx_cast<__m128>(_mm_packs_epi16(
+        AVX::avx_cast<__m128i>(mask_cast<8, 8, __m128>(k)), _mm_setzero_si128())));
+}
+
+// 16 -> 32
+template<> Vc_INTRINSIC Vc_CONST __m256 mask_cast<16, 32, __m256>(__m256i k)
+{
+    return AVX::zeroExtend(
+        AVX::avx_cast<__m128>(_mm_packs_epi16(AVX::lo128(k), AVX::hi128(k))));
+}
+#endif
+
 // allone{{{1
 template<> Vc_INTRINSIC Vc_CONST __m256  allone<__m256 >() { return AVX::setallone_ps(); }
 template<> Vc_INTRINSIC Vc_CONST __m256i allone<__m256i>() { return AVX::setallone_si256(); }
@@ -602,6 +644,10 @@ Vc_INTRINSIC Vc_CONST __m256i one( short) { return AVX::setone_epi16(); }
 Vc_INTRINSIC Vc_CONST __m256i one(ushort) { return AVX::setone_epu16(); }
 Vc_INTRINSIC Vc_CONST __m256i one( schar) { return AVX::setone_epi8 (); }
 Vc_INTRINSIC Vc_CONST __m256i one( uchar) { return AVX::setone_epu8 (); }
+Vc_INTRINSIC Vc_CONST __m256i one(         long long) { return AVX::setone_epi64(); }
+Vc_INTRINSIC Vc_CONST __m256i one(unsigned long long) { return AVX::setone_epu64(); }
+Vc_INTRINSIC Vc_CONST __m256i one(              long) { return AVX::setone_epi64(); }
+Vc_INTRINSIC Vc_CONST __m256i one(     unsigned long) { return AVX::setone_epu64(); }
 
 // negate{{{1
 Vc_ALWAYS_INLINE Vc_CONST __m256 negate(__m256 v, std::integral_constant<std::size_t, 4>)
@@ -612,6 +658,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m256d negate(__m256d v, std::integral_constant<std::
 {
     return _mm256_xor_pd(v, AVX::setsignmask_pd());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 8>)
+{
+    return AVX::sub_epi64(_mm256_setzero_si256(), v);
+}
 Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 4>)
 {
     return AVX::sign_epi32(v, Detail::allone<__m256i>());
@@ -620,6 +670,10 @@ Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::
 {
     return AVX::sign_epi16(v, Detail::allone<__m256i>());
 }
+Vc_ALWAYS_INLINE Vc_CONST __m256i negate(__m256i v, std::integral_constant<std::size_t, 1>)
+{
+    return AVX::sign_epi8(v, Detail::allone<__m256i>());
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m256 xor_(__m256 a, __m256 b) { return _mm256_xor_ps(a, b); }
@@ -691,6 +745,12 @@ Vc_INTRINSIC __m256i abs(__m256i a,  short) { return AVX::abs_epi16(a); }
 Vc_INTRINSIC __m256i abs(__m256i a, ushort) { return a; }
 Vc_INTRINSIC __m256i abs(__m256i a,  schar) { return AVX::abs_epi8 (a); }
 Vc_INTRINSIC __m256i abs(__m256i a,  uchar) { return a; }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i abs(__m256i a,          long long) { return AVX::abs_epi64(a); }
+Vc_INTRINSIC __m256i abs(__m256i a, unsigned long long) { return a; }
+Vc_INTRINSIC __m256i abs(__m256i a,               long) { return AVX::abs_epi64(a); }
+Vc_INTRINSIC __m256i abs(__m256i a,      unsigned long) { return a; }
+#endif
 
 // add{{{1
 Vc_INTRINSIC __m256  add(__m256  a, __m256  b,  float) { return _mm256_add_ps(a, b); }
@@ -699,6 +759,12 @@ Vc_INTRINSIC __m256i add(__m256i a, __m256i b,    int) { return AVX::add_epi32(a
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,   uint) { return AVX::add_epi32(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  short) { return AVX::add_epi16(a, b); }
 Vc_INTRINSIC __m256i add(__m256i a, __m256i b, ushort) { return AVX::add_epi16(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  schar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,  uchar) { return AVX::add_epi8 (a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,          long long) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b, unsigned long long) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,               long) { return AVX::add_epi64(a, b); }
+Vc_INTRINSIC __m256i add(__m256i a, __m256i b,      unsigned long) { return AVX::add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m256  sub(__m256  a, __m256  b,  float) { return _mm256_sub_ps(a, b); }
@@ -707,6 +773,12 @@ Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,    int) { return AVX::sub_epi32(a
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,   uint) { return AVX::sub_epi32(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  short) { return AVX::sub_epi16(a, b); }
 Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, ushort) { return AVX::sub_epi16(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  schar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,  uchar) { return AVX::sub_epi8 (a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,          long long) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b, unsigned long long) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,               long) { return AVX::sub_epi64(a, b); }
+Vc_INTRINSIC __m256i sub(__m256i a, __m256i b,      unsigned long) { return AVX::sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m256  mul(__m256  a, __m256  b,  float) { return _mm256_mul_ps(a, b); }
@@ -715,6 +787,21 @@ Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,    int) { return AVX::mullo_epi32
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,   uint) { return AVX::mullo_epi32(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  short) { return AVX::mullo_epi16(a, b); }
 Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, ushort) { return AVX::mullo_epi16(a, b); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  schar) {
+    // multiply the even and the odd bytes as 16-bit integers and keep the low bytes
+    const __m256i even = _mm256_mullo_epi16(a, b);
+    const __m256i odd =
+        _mm256_mullo_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+    return _mm256_or_si256(_mm256_slli_epi16(odd, 8),
+                           _mm256_and_si256(even, _mm256_set1_epi16(0x00ff)));
+}
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,  uchar) { return mul(a, b, schar()); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,          long long) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b, unsigned long long) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,               long) { return AVX::mullo_epi64(a, b); }
+Vc_INTRINSIC __m256i mul(__m256i a, __m256i b,      unsigned long) { return AVX::mullo_epi64(a, b); }
+#endif
 
 // mul{{{1
 Vc_INTRINSIC __m256  div(__m256  a, __m256  b,  float) { return _mm256_div_ps(a, b); }
@@ -756,6 +843,40 @@ Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  short) {
         _mm256_div_ps(convert<short, float>(hi128(a)), convert<short, float>(hi128(b)));
     return concat(convert<float, short>(lo), convert<float, short>(hi));
 }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  schar) {
+    // divide as 16-bit integers and keep the low byte, so that -128 / -1 wraps like the
+    // scalar division
+    const __m256i lo8 = _mm256_set1_epi16(0xff);
+    const __m256i lo = div(_mm256_cvtepi8_epi16(AVX::lo128(a)),
+                           _mm256_cvtepi8_epi16(AVX::lo128(b)), short());
+    const __m256i hi = div(_mm256_cvtepi8_epi16(AVX::hi128(a)),
+                           _mm256_cvtepi8_epi16(AVX::hi128(b)), short());
+    return Mem::permute4x64<X0, X2, X1, X3>(
+        _mm256_packus_epi16(_mm256_and_si256(lo, lo8), _mm256_and_si256(hi, lo8)));
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,  uchar) {
+    const __m256i lo = div(_mm256_cvtepu8_epi16(AVX::lo128(a)),
+                           _mm256_cvtepu8_epi16(AVX::lo128(b)), short());
+    const __m256i hi = div(_mm256_cvtepu8_epi16(AVX::hi128(a)),
+                           _mm256_cvtepu8_epi16(AVX::hi128(b)), short());
+    return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packus_epi16(lo, hi));
+}
+// there is no 64-bit integer division and the conversion through double is inexact, so
+// divide entry by entry
+template <typename T> Vc_INTRINSIC __m256i div64(__m256i a, __m256i b)
+{
+    return _mm256_setr_epi64x(
+        T(_mm256_extract_epi64(a, 0)) / T(_mm256_extract_epi64(b, 0)),
+        T(_mm256_extract_epi64(a, 1)) / T(_mm256_extract_epi64(b, 1)),
+        T(_mm256_extract_epi64(a, 2)) / T(_mm256_extract_epi64(b, 2)),
+        T(_mm256_extract_epi64(a, 3)) / T(_mm256_extract_epi64(b, 3)));
+}
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,          long long) { return div64<         long long>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b, unsigned long long) { return div64<unsigned long long>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,               long) { return div64<         long long>(a, b); }
+Vc_INTRINSIC __m256i div(__m256i a, __m256i b,      unsigned long) { return div64<unsigned long long>(a, b); }
+#endif
 
 // horizontal add{{{1
 template <typename T> Vc_INTRINSIC T add(Common::IntrinsicType<T, 32 / sizeof(T)> a, T)
@@ -787,6 +908,10 @@ Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,    int) { return AvxIntrinsics:
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,   uint) { return AvxIntrinsics::cmpeq_epi32(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,  short) { return AvxIntrinsics::cmpeq_epi16(a, b); }
 Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, ushort) { return AvxIntrinsics::cmpeq_epi16(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,          long long) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b, unsigned long long) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,               long) { return AvxIntrinsics::cmpeq_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpeq(__m256i a, __m256i b,      unsigned long) { return AvxIntrinsics::cmpeq_epi64(a, b); }
 
 // cmpneq{{{1
 Vc_INTRINSIC __m256  cmpneq(__m256  a, __m256  b,  float) { return AvxIntrinsics::cmpneq_ps(a, b); }
@@ -797,6 +922,10 @@ Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  short) { return not_(AvxIntri
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, ushort) { return not_(AvxIntrinsics::cmpeq_epi16(a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  schar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,  uchar) { return not_(AvxIntrinsics::cmpeq_epi8 (a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,          long long) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b, unsigned long long) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,               long) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmpneq(__m256i a, __m256i b,      unsigned long) { return not_(AvxIntrinsics::cmpeq_epi64(a, b)); }
 
 // cmpgt{{{1
 Vc_INTRINSIC __m256  cmpgt(__m256  a, __m256  b,  float) { return AVX::cmpgt_ps(a, b); }
@@ -807,6 +936,10 @@ Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (a, b); }
 Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,          long long) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b, unsigned long long) { return AVX::cmpgt_epu64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,               long) { return AVX::cmpgt_epi64(a, b); }
+Vc_INTRINSIC __m256i cmpgt(__m256i a, __m256i b,      unsigned long) { return AVX::cmpgt_epu64(a, b); }
 
 // cmpge{{{1
 Vc_INTRINSIC __m256  cmpge(__m256  a, __m256  b,  float) { return AVX::cmpge_ps(a, b); }
@@ -817,6 +950,10 @@ Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (b, a)); }
 Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,          long long) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b, unsigned long long) { return not_(AVX::cmpgt_epu64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,               long) { return not_(AVX::cmpgt_epi64(b, a)); }
+Vc_INTRINSIC __m256i cmpge(__m256i a, __m256i b,      unsigned long) { return not_(AVX::cmpgt_epu64(b, a)); }
 
 // cmple{{{1
 Vc_INTRINSIC __m256  cmple(__m256  a, __m256  b,  float) { return AVX::cmple_ps(a, b); }
@@ -827,6 +964,10 @@ Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  short) { return not_(AVX::cmpg
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, ushort) { return not_(AVX::cmpgt_epu16(a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  schar) { return not_(AVX::cmpgt_epi8 (a, b)); }
 Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,  uchar) { return not_(AVX::cmpgt_epu8 (a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,          long long) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b, unsigned long long) { return not_(AVX::cmpgt_epu64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,               long) { return not_(AVX::cmpgt_epi64(a, b)); }
+Vc_INTRINSIC __m256i cmple(__m256i a, __m256i b,      unsigned long) { return not_(AVX::cmpgt_epu64(a, b)); }
 
 // cmplt{{{1
 Vc_INTRINSIC __m256  cmplt(__m256  a, __m256  b,  float) { return AVX::cmplt_ps(a, b); }
@@ -837,6 +978,10 @@ Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  short) { return AVX::cmpgt_epi
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, ushort) { return AVX::cmpgt_epu16(b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  schar) { return AVX::cmpgt_epi8 (b, a); }
 Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,  uchar) { return AVX::cmpgt_epu8 (b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,          long long) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b, unsigned long long) { return AVX::cmpgt_epu64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,               long) { return AVX::cmpgt_epi64(b, a); }
+Vc_INTRINSIC __m256i cmplt(__m256i a, __m256i b,      unsigned long) { return AVX::cmpgt_epu64(b, a); }
 
 // fma{{{1
 Vc_INTRINSIC __m256 fma(__m256  a, __m256  b, __m256  c,  float) {
@@ -890,30 +1035,65 @@ template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,    int) { return
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,   uint) { return AVX::srli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  short) { return AVX::srai_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, ushort) { return AVX::srli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return AVX::srai_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return AVX::srli_epi8 <shift>(a); }
 
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,    int) { return AVX::sra_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,   uint) { return AVX::srl_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  short) { return AVX::sra_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, ushort) { return AVX::srl_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar) { return AVX::sra_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar) { return AVX::srl_epi8 (a, _mm_cvtsi32_si128(shift)); }
+#ifdef Vc_IMPL_AVX2
+// there are no 8-bit shifts: shift 16-bit words and fix up the bits that crossed a byte
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  schar)
+{
+    const __m128i n = _mm_cvtsi32_si128(shift);
+    const __m256i hi = _mm256_and_si256(_mm256_sra_epi16(a, n), _mm256_set1_epi16(-0x100));
+    const __m256i lo = _mm256_srli_epi16(_mm256_sra_epi16(_mm256_slli_epi16(a, 8), n), 8);
+    return _mm256_or_si256(hi, lo);
+}
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,  uchar)
+{
+    return _mm256_and_si256(_mm256_srl_epi16(a, _mm_cvtsi32_si128(shift)),
+                            _mm256_set1_epi8(static_cast<char>(0xff >> shift)));
+}
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  schar) { return shiftRight(a, shift, schar()); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,  uchar) { return shiftRight(a, shift, uchar()); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,          long long) { return AVX::srai_epi64(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift, unsigned long long) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,               long) { return AVX::srai_epi64(a, shift); }
+Vc_INTRINSIC __m256i shiftRight(__m256i a, int shift,      unsigned long) { return AVX::srl_epi64(a, _mm_cvtsi32_si128(shift)); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,          long long) { return AVX::srai_epi64(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a, unsigned long long) { return AVX::srli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,               long) { return AVX::srai_epi64(a, shift); }
+template <int shift> Vc_INTRINSIC __m256i shiftRight(__m256i a,      unsigned long) { return AVX::srli_epi64<shift>(a); }
+#endif
 
 // shiftLeft{{{1
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,    int) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,   uint) { return AVX::slli_epi32<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  short) { return AVX::slli_epi16<shift>(a); }
 template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, ushort) { return AVX::slli_epi16<shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return AVX::slli_epi8 <shift>(a); }
-//template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return AVX::slli_epi8 <shift>(a); }
 
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,    int) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,   uint) { return AVX::sll_epi32(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  short) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
 Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, ushort) { return AVX::sll_epi16(a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
-//Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return AVX::sll_epi8 (a, _mm_cvtsi32_si128(shift)); }
+#ifdef Vc_IMPL_AVX2
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  schar)
+{
+    return _mm256_and_si256(_mm256_sll_epi16(a, _mm_cvtsi32_si128(shift)),
+                            _mm256_set1_epi8(static_cast<char>(0xff << shift)));
+}
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,  uchar) { return shiftLeft(a, shift, schar()); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  schar) { return shiftLeft(a, shift, schar()); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,  uchar) { return shiftLeft(a, shift, schar()); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,          long long) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift, unsigned long long) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,               long) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+Vc_INTRINSIC __m256i shiftLeft(__m256i a, int shift,      unsigned long) { return AVX::sll_epi64(a, _mm_cvtsi32_si128(shift)); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,          long long) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a, unsigned long long) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,               long) { return AVX::slli_epi64<shift>(a); }
+template <int shift> Vc_INTRINSIC __m256i shiftLeft(__m256i a,      unsigned long) { return AVX::slli_epi64<shift>(a); }
+#endif
 
 // zeroExtendIfNeeded{{{1
 Vc_INTRINSIC __m256  zeroExtendIfNeeded(__m256  x) { return x; }
@@ -933,6 +1113,10 @@ Vc_INTRINSIC __m256i avx_broadcast(ushort x) { return _mm256_set1_epi16(x); }
 Vc_INTRINSIC __m256i avx_broadcast(  char x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( schar x) { return _mm256_set1_epi8(x); }
 Vc_INTRINSIC __m256i avx_broadcast( uchar x) { return _mm256_set1_epi8(x); }
+Vc_INTRINSIC __m256i avx_broadcast(         long long x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(unsigned long long x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(              long x) { return _mm256_set1_epi64x(x); }
+Vc_INTRINSIC __m256i avx_broadcast(     unsigned long x) { return _mm256_set1_epi64x(x); }
 
 // sorted{{{1
 template <Vc::Implementation Impl, typename T,
@@ -1169,6 +1353,50 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 16), V> rotated(
     }
     return avx_cast<V>(_mm256_setzero_ps());
 }
+
+template <typename T, size_t N, typename V>
+static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 32 && N == 32), V> rotated(
+    V v, int amount)
+{
+    using namespace AVX;
+    const __m128i vLo = avx_cast<__m128i>(lo128(v));
+    const __m128i vHi = avx_cast<__m128i>(hi128(v));
+    switch (static_cast<unsigned int>(amount) % N) {
+    case  0: return v;
+    case  1: return concat(SSE::alignr_epi8< 1>(vHi, vLo), SSE::alignr_epi8< 1>(vLo, vHi));
+    case  2: return concat(SSE::alignr_epi8< 2>(vHi, vLo), SSE::alignr_epi8< 2>(vLo, vHi));
+    case  3: return concat(SSE::alignr_epi8< 3>(vHi, vLo), SSE::alignr_epi8< 3>(vLo, vHi));
+    case  4: return concat(SSE::alignr_epi8< 4>(vHi, vLo), SSE::alignr_epi8< 4>(vLo, vHi));
+    case  5: return concat(SSE::alignr_epi8< 5>(vHi, vLo), SSE::alignr_epi8< 5>(vLo, vHi));
+    case  6: return concat(SSE::alignr_epi8< 6>(vHi, vLo), SSE::alignr_epi8< 6>(vLo, vHi));
+    case  7: return concat(SSE::alignr_epi8< 7>(vHi, vLo), SSE::alignr_epi8< 7>(vLo, vHi));
+    case  8: return concat(SSE::alignr_epi8< 8>(vHi, vLo), SSE::alignr_epi8< 8>(vLo, vHi));
+    case  9: return concat(SSE::alignr_epi8< 9>(vHi, vLo), SSE::alignr_epi8< 9>(vLo, vHi));
+    case 10: return concat(SSE::alignr_epi8<10>(vHi, vLo), SSE::alignr_epi8<10>(vLo, vHi));
+    case 11: return concat(SSE::alignr_epi8<11>(vHi, vLo), SSE::alignr_epi8<11>(vLo, vHi));
+    case 12: return concat(SSE::alignr_epi8<12>(vHi, vLo), SSE::alignr_epi8<12>(vLo, vHi));
+    case 13: return concat(SSE::alignr_epi8<13>(vHi, vLo), SSE::alignr_epi8<13>(vLo, vHi));
+    case 14: return concat(SSE::alignr_epi8<14>(vHi, vLo), SSE::alignr_epi8<14>(vLo, vHi));
+    case 15: return concat(SSE::alignr_epi8<15>(vHi, vLo), SSE::alignr_epi8<15>(vLo, vHi));
+    case 16: return Mem::permute128<X1, X0>(v);
+    case 17: return concat(SSE::alignr_epi8< 1>(vLo, vHi), SSE::alignr_epi8< 1>(vHi, vLo));
+    case 18: return concat(SSE::alignr_epi8< 2>(vLo, vHi), SSE::alignr_epi8< 2>(vHi, vLo));
+    case 19: return concat(SSE::alignr_epi8< 3>(vLo, vHi), SSE::alignr_epi8< 3>(vHi, vLo));
+    case 20: return concat(SSE::alignr_epi8< 4>(vLo, vHi), SSE::alignr_epi8< 4>(vHi, vLo));
+    case 21: return concat(SSE::alignr_epi8< 5>(vLo, vHi), SSE::alignr_epi8< 5>(vHi, vLo));
+    case 22: return concat(SSE::alignr_epi8< 6>(vLo, vHi), SSE::alignr_epi8< 6>(vHi, vLo));
+    case 23: return concat(SSE::alignr_epi8< 7>(vLo, vHi), SSE::alignr_epi8< 7>(vHi, vLo));
+    case 24: return concat(SSE::alignr_epi8< 8>(vLo, vHi), SSE::alignr_epi8< 8>(vHi, vLo));
+    case 25: return concat(SSE::alignr_epi8< 9>(vLo, vHi), SSE::alignr_epi8< 9>(vHi, vLo));
+    case 26: return concat(SSE::alignr_epi8<10>(vLo, vHi), SSE::alignr_epi8<10>(vHi, vLo));
+    case 27: return concat(SSE::alignr_epi8<11>(vLo, vHi), SSE::alignr_epi8<11>(vHi, vLo));
+    case 28: return concat(SSE::alignr_epi8<12>(vLo, vHi), SSE::alignr_epi8<12>(vHi, vLo));
+    case 29: return concat(SSE::alignr_epi8<13>(vLo, vHi), SSE::alignr_epi8<13>(vHi, vLo));
+    case 30: return concat(SSE::alignr_epi8<14>(vLo, vHi), SSE::alignr_epi8<14>(vHi, vLo));
+    case 31: return concat(SSE::alignr_epi8<15>(vLo, vHi), SSE::alignr_epi8<15>(vHi, vLo));
+    }
+    return _mm256_setzero_si256();
+}
 #endif  // Vc_IMPL_AVX2
 
 // testc{{{1
@@ -1202,8 +1430,8 @@ template <size_t N, typename Flags>
 Vc_INTRINSIC void mask_store(__m256i k, bool *mem, Flags)
 {
     static_assert(
-        N == 4 || N == 8 || N == 16,
-        "mask_store(__m256i, bool *) is only implemented for 4, 8, and 16 entries");
+        N == 4 || N == 8 || N == 16 || N == 32,
+        "mask_store(__m256i, bool *) is only implemented for 4, 8, 16, and 32 entries");
     switch (N) {
     case 4:
         *aliasing_cast<int32_t>(mem) = (_mm_movemask_epi8(AVX::lo128(k)) |
@@ -1229,6 +1457,14 @@ Vc_INTRINSIC void mask_store(__m256i k, bool *mem, Flags)
             _mm_storeu_si128(reinterpret_cast<__m128i *>(mem), bools);
         }
     } break;
+    case 32: {
+        const auto bools = Detail::and_(AVX::setone_epi8(), k);
+        if (Flags::IsAligned) {
+            _mm256_store_si256(reinterpret_cast<__m256i *>(mem), bools);
+        } else {
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(mem), bools);
+        }
+    } break;
     default:
         Vc_UNREACHABLE();
     }
@@ -1268,8 +1504,8 @@ Vc_INTRINSIC R mask_load(const bool *mem, Flags,
                          enable_if<std::is_same<R, __m256>::value> = nullarg)
 {
     static_assert(
-        N == 4 || N == 8 || N == 16,
-        "mask_load<__m256>(const bool *) is only implemented for 4, 8, and 16 entries");
+        N == 4 || N == 8 || N == 16 || N == 32,
+        "mask_load<__m256>(const bool *) is only implemented for 4, 8, 16, and 32 entries");
     switch (N) {
     case 4: {
         __m128i k = AVX::avx_cast<__m128i>(_mm_and_ps(
@@ -1297,6 +1533,13 @@ Vc_INTRINSIC R mask_load(const bool *mem, Flags,
         return AVX::avx_cast<__m256>(
             AVX::concat(_mm_unpacklo_epi8(k128, k128), _mm_unpackhi_epi8(k128, k128)));
     }
+    case 32: {
+        const auto k = AVX::cmpgt_epi8(
+            Flags::IsAligned ? _mm256_load_si256(reinterpret_cast<const __m256i *>(mem))
+                             : _mm256_loadu_si256(reinterpret_cast<const __m256i *>(mem)),
+            _mm256_setzero_si256());
+        return AVX::avx_cast<__m256>(k);
+    }
     default:
         Vc_UNREACHABLE();
         return R();
@@ -1325,6 +1568,115 @@ template <> Vc_INTRINSIC Vc_CONST int mask_to_int<32>(__m256i k)
     return movemask(k);
 }
 
+// compress_halves / expand_halves{{{1
+/**\internal
+ * Compresses both 128-bit halves of \p x with the SSE implementation and joins the
+ * results in memory.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m256i compress_halves(__m256i x, int k)
+{
+    constexpr int HalfSize = 16 / EntrySize;
+    const int klo = k & ((1 << HalfSize) - 1);
+    alignas(32) char tmp[32];
+    _mm_store_si128(reinterpret_cast<__m128i *>(&tmp[0]),
+                    compress<EntrySize>(AVX::lo128(x), klo));
+    _mm_store_si128(reinterpret_cast<__m128i *>(&tmp[16]), _mm_setzero_si128());
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(&tmp[popcnt8(klo) * EntrySize]),
+                     compress<EntrySize>(AVX::hi128(x), k >> HalfSize));
+    return _mm256_load_si256(reinterpret_cast<const __m256i *>(&tmp[0]));
+}
+
+/**\internal
+ * Expands both 128-bit halves of \p x with the SSE implementation.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m256i expand_halves(__m256i x, int k)
+{
+    constexpr int HalfSize = 16 / EntrySize;
+    const int klo = k & ((1 << HalfSize) - 1);
+    alignas(32) char tmp[32];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(&tmp[0]), x);
+    return AVX::concat(
+        expand<EntrySize>(AVX::lo128(x), klo),
+        expand<EntrySize>(_mm_loadu_si128(reinterpret_cast<const __m128i *>(
+                              &tmp[popcnt8(klo) * EntrySize])),
+                          k >> HalfSize));
+}
+
+#ifdef Vc_IMPL_AVX2
+// permute_nibbles{{{1
+/**\internal
+ * vpermd with the lane indexes packed into the nibbles of \p nibbles. Lanes with bit 3 of
+ * their nibble set are zeroed.
+ */
+Vc_INTRINSIC __m256i permute_nibbles(__m256i x, unsigned int nibbles)
+{
+    const __m256i idx = _mm256_and_si256(
+        _mm256_srlv_epi32(_mm256_set1_epi32(nibbles),
+                          _mm256_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28)),
+        _mm256_set1_epi32(0xf));
+    return _mm256_andnot_si256(_mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7)),
+                               _mm256_permutevar8x32_epi32(x, idx));
+}
+#endif  // Vc_IMPL_AVX2
+
+// compress{{{1
+/**\internal
+ * The AVX variant of the SSE compress.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m256i compress(__m256i x, int k);
+#ifdef Vc_IMPL_AVX2
+template <> Vc_INTRINSIC __m256i compress<8>(__m256i x, int k)
+{
+    return permute_nibbles(x, AVX::c_compress::compress64.data[k]);
+}
+template <> Vc_INTRINSIC __m256i compress<4>(__m256i x, int k)
+{
+    return permute_nibbles(x, AVX::c_compress::compress32.data[k]);
+}
+#else
+template <> Vc_INTRINSIC __m256i compress<8>(__m256i x, int k)
+{
+    return compress_halves<8>(x, k);
+}
+template <> Vc_INTRINSIC __m256i compress<4>(__m256i x, int k)
+{
+    return compress_halves<4>(x, k);
+}
+#endif
+template <> Vc_INTRINSIC __m256i compress<2>(__m256i x, int k)
+{
+    return compress_halves<2>(x, k);
+}
+
+// expand{{{1
+/**\internal
+ * The AVX variant of the SSE expand.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m256i expand(__m256i x, int k);
+#ifdef Vc_IMPL_AVX2
+template <> Vc_INTRINSIC __m256i expand<8>(__m256i x, int k)
+{
+    return permute_nibbles(x, AVX::c_compress::expand64.data[k]);
+}
+template <> Vc_INTRINSIC __m256i expand<4>(__m256i x, int k)
+{
+    return permute_nibbles(x, AVX::c_compress::expand32.data[k]);
+}
+#else
+template <> Vc_INTRINSIC __m256i expand<8>(__m256i x, int k)
+{
+    return expand_halves<8>(x, k);
+}
+template <> Vc_INTRINSIC __m256i expand<4>(__m256i x, int k)
+{
+    return expand_halves<4>(x, k);
+}
+#endif
+template <> Vc_INTRINSIC __m256i expand<2>(__m256i x, int k)
+{
+    return expand_halves<2>(x, k);
+}
+
 //InterleaveImpl{{{1
 template<typename V> struct InterleaveImpl<V, 16, 32> {
     template<typename I> static inline void interleave(typename V::EntryType *const data, const I &i,/*{{{*/
@@ -114,6 +114,8 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m256i Vc_CONST setone_epu16()  { return setone_epi16(); }
     static Vc_INTRINSIC m256i Vc_CONST setone_epi32()  { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&_IndexesFromZero32[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setone_epu32()  { return setone_epi32(); }
+    static Vc_INTRINSIC m256i Vc_CONST setone_epi64()  { return _mm256_set1_epi64x(1); }
+    static Vc_INTRINSIC m256i Vc_CONST setone_epu64()  { return setone_epi64(); }
 
     static Vc_INTRINSIC m256  Vc_CONST setone_ps()     { return _mm256_broadcast_ss(&c_general::oneFloat); }
     static Vc_INTRINSIC m256d Vc_CONST setone_pd()     { return _mm256_broadcast_sd(&c_general::oneDouble); }
@@ -133,6 +135,7 @@ namespace AvxIntrinsics
     static Vc_INTRINSIC m128i Vc_CONST _mm_setmin_epi32() { return _mm_castps_si128(_mm_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi16() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(c_general::minShort))); }
     static Vc_INTRINSIC m256i Vc_CONST setmin_epi32() { return _mm256_castps_si256(_mm256_broadcast_ss(reinterpret_cast<const float *>(&c_general::signMaskFloat[1]))); }
+    static Vc_INTRINSIC m256i Vc_CONST setmin_epi64() { return _mm256_set1_epi64x(-0x7fffffffffffffffll - 1); }
 
     template <int i>
     static Vc_INTRINSIC Vc_CONST unsigned int extract_epu32(__m128i x)
@@ -338,12 +341,16 @@ namespace AvxIntrinsics
     Vc_AVX_TO_SSE_2_NEW(cmpgt_epi64)
     Vc_AVX_TO_SSE_2_NEW(unpackhi_epi16)
     Vc_AVX_TO_SSE_2_NEW(unpacklo_epi16)
+    Vc_AVX_TO_SSE_2_NEW(add_epi8)
     Vc_AVX_TO_SSE_2_NEW(add_epi16)
     Vc_AVX_TO_SSE_2_NEW(add_epi32)
     Vc_AVX_TO_SSE_2_NEW(add_epi64)
+    Vc_AVX_TO_SSE_2_NEW(sub_epi8)
     Vc_AVX_TO_SSE_2_NEW(sub_epi16)
     Vc_AVX_TO_SSE_2_NEW(sub_epi32)
+    Vc_AVX_TO_SSE_2_NEW(sub_epi64)
     Vc_AVX_TO_SSE_2_NEW(mullo_epi16)
+    Vc_AVX_TO_SSE_2_NEW(sign_epi8)
     Vc_AVX_TO_SSE_2_NEW(sign_epi16)
     Vc_AVX_TO_SSE_2_NEW(sign_epi32)
     Vc_AVX_TO_SSE_2_NEW(min_epi8)
@@ -454,6 +461,62 @@ static Vc_INTRINSIC m256i cmplt_epi8(__m256i a, __m256i b) {
 static Vc_INTRINSIC m256i cmpgt_epu8(__m256i a, __m256i b) {
     return cmpgt_epi8(xor_si256(a, setmin_epi8()), xor_si256(b, setmin_epi8()));
 }
+static Vc_INTRINSIC m256i cmplt_epu8(__m256i a, __m256i b) {
+    return cmpgt_epu8(b, a);
+}
+static Vc_INTRINSIC m256i cmpgt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epi64(xor_si256(a, setmin_epi64()), xor_si256(b, setmin_epi64()));
+}
+static Vc_INTRINSIC m256i cmplt_epu64(__m256i a, __m256i b) {
+    return cmpgt_epu64(b, a);
+}
+#ifdef Vc_IMPL_AVX2
+// 64-bit integers {{{
+// AVX2 has no 64-bit min/max, abs, multiplication or arithmetic right shift; these
+// are composed from the 32-bit and logical 64-bit instructions.
+static Vc_INTRINSIC Vc_CONST m256i min_epi64(__m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(a, b, cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC Vc_CONST m256i max_epi64(__m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, cmpgt_epi64(a, b));
+}
+static Vc_INTRINSIC Vc_CONST m256i min_epu64(__m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(a, b, cmpgt_epu64(a, b));
+}
+static Vc_INTRINSIC Vc_CONST m256i max_epu64(__m256i a, __m256i b)
+{
+    return _mm256_blendv_epi8(b, a, cmpgt_epu64(a, b));
+}
+static Vc_INTRINSIC Vc_CONST m256i abs_epi64(__m256i a)
+{
+    const m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return _mm256_sub_epi64(_mm256_xor_si256(a, sign), sign);
+}
+static Vc_INTRINSIC Vc_CONST m256i mullo_epi64(__m256i a, __m256i b)
+{
+    const m256i lo = _mm256_mul_epu32(a, b);
+    const m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b),
+                                         _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+    return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+static Vc_INTRINSIC Vc_CONST m256i srai_epi64(__m256i a, int shift)
+{
+    const m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return _mm256_or_si256(_mm256_srli_epi64(a, shift),
+                           _mm256_slli_epi64(sign, 64 - shift));
+}
+static Vc_INTRINSIC Vc_CONST m256i srav_epi64(__m256i a, __m256i shift)
+{
+    const m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), a);
+    return _mm256_or_si256(
+        _mm256_srlv_epi64(a, shift),
+        _mm256_sllv_epi64(sign, _mm256_sub_epi64(_mm256_set1_epi64x(64), shift)));
+}
+// }}}
+#endif  // Vc_IMPL_AVX2
 #if defined(Vc_IMPL_XOP)
     Vc_AVX_TO_SSE_2_NEW(comlt_epu32)
     Vc_AVX_TO_SSE_2_NEW(comgt_epu32)
@@ -601,6 +664,24 @@ template <int Scale> __m256i gather(const unsigned *addr, __m256i idx)
 {
     return _mm256_i32gather_epi32(aliasing_cast<int>(addr), idx, Scale);
 }
+template <int Scale> __m256i gather(const long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(addr, idx, Scale);
+}
+template <int Scale> __m256i gather(const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+#ifdef __LP64__
+template <int Scale> __m256i gather(const long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+template <int Scale> __m256i gather(const unsigned long *addr, __m128i idx)
+{
+    return _mm256_i32gather_epi64(aliasing_cast<long long>(addr), idx, Scale);
+}
+#endif
 
 template <int Scale> __m256 gather(__m256 src, __m256 k, const float *addr, __m256i idx)
 {
@@ -620,6 +701,28 @@ __m256i gather(__m256i src, __m256i k, const unsigned *addr, __m256i idx)
 {
     return _mm256_mask_i32gather_epi32(src, aliasing_cast<int>(addr), idx, k, Scale);
 }
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, addr, idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const unsigned long long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+#ifdef __LP64__
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+template <int Scale>
+__m256i gather(__m256i src, __m256i k, const unsigned long *addr, __m128i idx)
+{
+    return _mm256_mask_i32gather_epi64(src, aliasing_cast<long long>(addr), idx, k, Scale);
+}
+#endif
 #endif
 
 }  // namespace AvxIntrinsics
@@ -79,6 +79,14 @@ Vc_NUM_LIM(unsigned short, Vc::Detail::allone<__m256i>(), Vc::Detail::zero<__m25
 Vc_NUM_LIM(         short, _mm256_srli_epi16(Vc::Detail::allone<__m256i>(), 1), Vc::AVX::setmin_epi16());
 Vc_NUM_LIM(  unsigned int, Vc::Detail::allone<__m256i>(), Vc::Detail::zero<__m256i>());
 Vc_NUM_LIM(           int, _mm256_srli_epi32(Vc::Detail::allone<__m256i>(), 1), Vc::AVX::setmin_epi32());
+Vc_NUM_LIM( unsigned char, Vc::Detail::allone<__m256i>(), Vc::Detail::zero<__m256i>());
+Vc_NUM_LIM(   signed char, _mm256_set1_epi8(0x7f), _mm256_set1_epi8(-0x80));
+Vc_NUM_LIM(unsigned long long, Vc::Detail::allone<__m256i>(), Vc::Detail::zero<__m256i>());
+Vc_NUM_LIM(         long long, _mm256_srli_epi64(Vc::Detail::allone<__m256i>(), 1), Vc::AVX::setmin_epi64());
+#ifdef __LP64__
+Vc_NUM_LIM(     unsigned long, Vc::Detail::allone<__m256i>(), Vc::Detail::zero<__m256i>());
+Vc_NUM_LIM(              long, _mm256_srli_epi64(Vc::Detail::allone<__m256i>(), 1), Vc::AVX::setmin_epi64());
+#endif
 #endif
 #undef Vc_NUM_LIM
 
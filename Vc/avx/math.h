@@ -44,6 +44,20 @@ Vc_ALWAYS_INLINE AVX2::int_v    max(const AVX2::int_v    &x, const AVX2::int_v
 Vc_ALWAYS_INLINE AVX2::uint_v   max(const AVX2::uint_v   &x, const AVX2::uint_v   &y) { return _mm256_max_epu32(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::short_v  max(const AVX2::short_v  &x, const AVX2::short_v  &y) { return _mm256_max_epi16(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::ushort_v max(const AVX2::ushort_v &x, const AVX2::ushort_v &y) { return _mm256_max_epu16(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  min(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_min_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  min(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_min_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::schar_v  max(const AVX2::schar_v  &x, const AVX2::schar_v  &y) { return _mm256_max_epi8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::uchar_v  max(const AVX2::uchar_v  &x, const AVX2::uchar_v  &y) { return _mm256_max_epu8 (x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: llong_v min(const AVX2:: llong_v &x, const AVX2:: llong_v &y) { return AVX::min_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ullong_v min(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return AVX::min_epu64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: llong_v max(const AVX2:: llong_v &x, const AVX2:: llong_v &y) { return AVX::max_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::ullong_v max(const AVX2::ullong_v &x, const AVX2::ullong_v &y) { return AVX::max_epu64(x.data(), y.data()); }
+#ifdef __LP64__
+Vc_ALWAYS_INLINE AVX2::  long_v min(const AVX2::  long_v &x, const AVX2::  long_v &y) { return AVX::min_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: ulong_v min(const AVX2:: ulong_v &x, const AVX2:: ulong_v &y) { return AVX::min_epu64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2::  long_v max(const AVX2::  long_v &x, const AVX2::  long_v &y) { return AVX::max_epi64(x.data(), y.data()); }
+Vc_ALWAYS_INLINE AVX2:: ulong_v max(const AVX2:: ulong_v &x, const AVX2:: ulong_v &y) { return AVX::max_epu64(x.data(), y.data()); }
+#endif
 #endif
 Vc_ALWAYS_INLINE AVX2::float_v  min(const AVX2::float_v  &x, const AVX2::float_v  &y) { return _mm256_min_ps(x.data(), y.data()); }
 Vc_ALWAYS_INLINE AVX2::double_v min(const AVX2::double_v &x, const AVX2::double_v &y) { return _mm256_min_pd(x.data(), y.data()); }
@@ -96,6 +110,20 @@ Vc_INTRINSIC Vc_CONST AVX2::short_v abs(AVX2::short_v x)
 {
     return _mm256_abs_epi16(x.data());
 }
+Vc_INTRINSIC Vc_CONST AVX2::schar_v abs(AVX2::schar_v x)
+{
+    return _mm256_abs_epi8(x.data());
+}
+Vc_INTRINSIC Vc_CONST AVX2::llong_v abs(AVX2::llong_v x)
+{
+    return AVX::abs_epi64(x.data());
+}
+#ifdef __LP64__
+Vc_INTRINSIC Vc_CONST AVX2::long_v abs(AVX2::long_v x)
+{
+    return AVX::abs_epi64(x.data());
+}
+#endif
 #endif
 
 // isfinite {{{1
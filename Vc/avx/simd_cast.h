@@ -195,6 +195,132 @@ Vc_SIMD_CAST_AVX_2(   int_v, ushort_v);
 Vc_SIMD_CAST_AVX_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_AVX_3(double_v, ushort_v);
 Vc_SIMD_CAST_AVX_4(double_v, ushort_v);
+
+Vc_SIMD_CAST_AVX_1( schar_v, double_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  float_v);
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, double_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  float_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v);
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v);
+
+Vc_SIMD_CAST_AVX_1(double_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( float_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_AVX_2( float_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_AVX_2( short_v,  schar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_AVX_4( float_v,  schar_v);
+Vc_SIMD_CAST_AVX_4(   int_v,  schar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v,  schar_v);
+
+Vc_SIMD_CAST_AVX_1(double_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( float_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2( float_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(  uint_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2( short_v,  uchar_v);
+Vc_SIMD_CAST_AVX_2(ushort_v,  uchar_v);
+Vc_SIMD_CAST_AVX_4( float_v,  uchar_v);
+Vc_SIMD_CAST_AVX_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_AVX_4(  uint_v,  uchar_v);
+template <typename Return>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::double_v x0, AVX2::double_v x1, AVX2::double_v x2, AVX2::double_v x3,
+          AVX2::double_v x4, AVX2::double_v x5, AVX2::double_v x6, AVX2::double_v x7,
+          enable_if<(std::is_same<Return, AVX2::schar_v>::value ||
+                     std::is_same<Return, AVX2::uchar_v>::value)> = nullarg);
+
+Vc_SIMD_CAST_AVX_1( llong_v, double_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  float_v);
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  short_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v);
+Vc_SIMD_CAST_AVX_2( llong_v,  float_v);
+Vc_SIMD_CAST_AVX_2( llong_v,    int_v);
+Vc_SIMD_CAST_AVX_2( llong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( float_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( short_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  float_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  short_v);
+Vc_SIMD_CAST_AVX_1(ullong_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v);
+Vc_SIMD_CAST_AVX_2(ullong_v,  float_v);
+Vc_SIMD_CAST_AVX_2(ullong_v,    int_v);
+Vc_SIMD_CAST_AVX_2(ullong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( float_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( short_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(ushort_v, ullong_v);
+#ifdef __LP64__
+Vc_SIMD_CAST_AVX_1(  long_v, double_v);
+Vc_SIMD_CAST_AVX_1(  long_v,  float_v);
+Vc_SIMD_CAST_AVX_1(  long_v,    int_v);
+Vc_SIMD_CAST_AVX_1(  long_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(  long_v,  short_v);
+Vc_SIMD_CAST_AVX_1(  long_v, ushort_v);
+Vc_SIMD_CAST_AVX_1(  long_v,  llong_v);
+Vc_SIMD_CAST_AVX_1(  long_v, ullong_v);
+Vc_SIMD_CAST_AVX_1(  long_v,  ulong_v);
+Vc_SIMD_CAST_AVX_2(  long_v,  float_v);
+Vc_SIMD_CAST_AVX_2(  long_v,    int_v);
+Vc_SIMD_CAST_AVX_2(  long_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(double_v,   long_v);
+Vc_SIMD_CAST_AVX_1( float_v,   long_v);
+Vc_SIMD_CAST_AVX_1(   int_v,   long_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,   long_v);
+Vc_SIMD_CAST_AVX_1( short_v,   long_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,   long_v);
+Vc_SIMD_CAST_AVX_1( ulong_v, double_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,  float_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,    int_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,  short_v);
+Vc_SIMD_CAST_AVX_1( ulong_v, ushort_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,  llong_v);
+Vc_SIMD_CAST_AVX_1( ulong_v, ullong_v);
+Vc_SIMD_CAST_AVX_1( ulong_v,   long_v);
+Vc_SIMD_CAST_AVX_2( ulong_v,  float_v);
+Vc_SIMD_CAST_AVX_2( ulong_v,    int_v);
+Vc_SIMD_CAST_AVX_2( ulong_v,   uint_v);
+Vc_SIMD_CAST_AVX_1(double_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1( float_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1(   int_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1(  uint_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1( short_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1(ushort_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1( llong_v,   long_v);
+Vc_SIMD_CAST_AVX_1( llong_v,  ulong_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,   long_v);
+Vc_SIMD_CAST_AVX_1(ullong_v,  ulong_v);
+#endif
 #endif
 
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
@@ -242,6 +368,13 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v);
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v);
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v);
+Vc_SIMD_CAST_1(SSE:: float_v, AVX2:: llong_v);
+Vc_SIMD_CAST_1(SSE:: float_v, AVX2::ullong_v);
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
@@ -385,6 +518,11 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v);
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::ushort_v);
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v);
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v);
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
@@ -507,6 +645,12 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
           Scalar::Vector<T> x3,
           enable_if<std::is_same<Return, AVX2::ushort_v>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)> = nullarg);
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -820,6 +964,11 @@ Vc_SIMD_CAST_AVX_2(  uint_m, ushort_m);
 #ifdef Vc_IMPL_AVX2
 Vc_SIMD_CAST_AVX_4(double_m,  short_m);
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m);
+
+Vc_SIMD_CAST_AVX_4(   int_m,  schar_m);
+Vc_SIMD_CAST_AVX_4(   int_m,  uchar_m);
+Vc_SIMD_CAST_AVX_4(  uint_m,  schar_m);
+Vc_SIMD_CAST_AVX_4(  uint_m,  uchar_m);
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -867,6 +1016,12 @@ Vc_SIMD_CAST_1(SSE:: short_m, AVX2::  uint_m);
 
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::   int_m);
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::  uint_m);
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(std::is_same<Return, AVX2::llong_m>::value ||
+                     std::is_same<Return, AVX2::ullong_m>::value)> = nullarg);
 #endif
 
 // 2 SSE::Mask to 1 AVX2::Mask {{{2
@@ -995,6 +1150,11 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::   int_m);
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::  uint_m);
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE:: short_m);
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m);
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> k, enable_if<(SSE::is_mask<Return>::value &&
+                                      std::is_integral<T>::value && sizeof(T) == 8)> = nullarg);
 #endif
 
 // 2 AVX2::Mask to 1 SSE::Mask {{{2
@@ -1404,6 +1564,161 @@ Vc_SIMD_CAST_AVX_4(double_v, ushort_v) {
 }
 #endif
 
+// 1: from schar_v and uchar_v {{{3
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_1( schar_v, double_v) { return _mm256_cvtepi32_pd(_mm_cvtepi8_epi32(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( schar_v,  float_v) { return _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( schar_v,    int_v) { return _mm256_cvtepi8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v,   uint_v) { return _mm256_cvtepi8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v,  short_v) { return _mm256_cvtepi8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( schar_v, ushort_v) { return _mm256_cvtepi8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v, double_v) { return _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  float_v) { return _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(AVX::lo128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( uchar_v,    int_v) { return _mm256_cvtepu8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v,   uint_v) { return _mm256_cvtepu8_epi32(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  short_v) { return _mm256_cvtepu8_epi16(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( uchar_v, ushort_v) { return _mm256_cvtepu8_epi16(AVX::lo128(x.data())); }
+#endif
+
+// 1: to schar_v and uchar_v {{{3
+// the conversions to 8-bit integers keep the low byte (as the integral conversions do)
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_1(double_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( float_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1( short_v,  schar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  schar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( uchar_v,  schar_v) { return x.data(); }
+
+Vc_SIMD_CAST_AVX_1(double_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( float_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(   int_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  uchar_v) { return simd_cast<AVX2::uchar_v>(simd_cast<AVX2::short_v>(x)); }
+Vc_SIMD_CAST_AVX_1( short_v,  uchar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  uchar_v) { return AVX::zeroExtend(SSE::convert_int16_to_int8(AVX::lo128(x.data()), AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( schar_v,  uchar_v) { return x.data(); }
+#endif
+
+// 2: to schar_v and uchar_v {{{3
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_2( short_v,  schar_v) {
+    const auto lo8 = _mm256_set1_epi16(0xff);
+    return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packus_epi16(
+        _mm256_and_si256(x0.data(), lo8), _mm256_and_si256(x1.data(), lo8)));
+}
+Vc_SIMD_CAST_AVX_2(ushort_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0), simd_cast<AVX2::short_v>(x1)); }
+Vc_SIMD_CAST_AVX_2( float_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+Vc_SIMD_CAST_AVX_2(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1)); }
+
+Vc_SIMD_CAST_AVX_2( short_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_2(ushort_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_2( float_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_2(   int_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_2(  uint_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1).data(); }
+#endif
+
+// 4: to schar_v and uchar_v {{{3
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_4( float_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(   int_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4(  uint_v,  schar_v) { return simd_cast<AVX2::schar_v>(simd_cast<AVX2::short_v>(x0, x1), simd_cast<AVX2::short_v>(x2, x3)); }
+Vc_SIMD_CAST_AVX_4( float_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_AVX_4(   int_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_AVX_4(  uint_v,  uchar_v) { return simd_cast<AVX2::schar_v>(x0, x1, x2, x3).data(); }
+template <typename Return>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::double_v x0, AVX2::double_v x1, AVX2::double_v x2, AVX2::double_v x3,
+          AVX2::double_v x4, AVX2::double_v x5, AVX2::double_v x6, AVX2::double_v x7,
+          enable_if<(std::is_same<Return, AVX2::schar_v>::value ||
+                     std::is_same<Return, AVX2::uchar_v>::value)>)
+{
+    return simd_cast<AVX2::schar_v>(simd_cast<AVX2::int_v>(x0, x1), simd_cast<AVX2::int_v>(x2, x3),
+                                    simd_cast<AVX2::int_v>(x4, x5), simd_cast<AVX2::int_v>(x6, x7))
+        .data();
+}
+#endif
+
+// 1 and 2: from and to llong_v and ullong_v {{{3
+// the conversions between 64-bit integers and floating-point are computed entry by entry
+#ifdef Vc_IMPL_AVX2
+Vc_SIMD_CAST_AVX_1( llong_v, double_v) { return AVX::concat(SSE::convert<llong, double>(AVX::lo128(x.data())), SSE::convert<llong, double>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( llong_v,  float_v) { return AVX::zeroExtend(_mm_movelh_ps(SSE::convert<llong, float>(AVX::lo128(x.data())), SSE::convert<llong, float>(AVX::hi128(x.data())))); }
+Vc_SIMD_CAST_AVX_1( llong_v,    int_v) { return AVX::zeroExtend(AVX::lo128(_mm256_permutevar8x32_epi32(x.data(), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))); }
+Vc_SIMD_CAST_AVX_1( llong_v,   uint_v) { return simd_cast<AVX2::int_v>(x).data(); }
+Vc_SIMD_CAST_AVX_1( llong_v,  short_v) { return simd_cast<AVX2::short_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( llong_v, ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( llong_v, ullong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2( llong_v,  float_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::float_v>(x0).data()), AVX::lo128(simd_cast<AVX2::float_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2( llong_v,    int_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::int_v>(x0).data()), AVX::lo128(simd_cast<AVX2::int_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2( llong_v,   uint_v) { return simd_cast<AVX2::int_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_1(double_v,  llong_v) { return AVX::concat(SSE::convert<double, llong>(AVX::lo128(x.data())), SSE::convert<double, llong>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( float_v,  llong_v) { return AVX::concat(SSE::convert<float, llong>(AVX::lo128(x.data())), SSE::convert<float, llong>(_mm_movehl_ps(AVX::lo128(x.data()), AVX::lo128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(   int_v,  llong_v) { return _mm256_cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  llong_v) { return _mm256_cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( short_v,  llong_v) { return _mm256_cvtepi16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  llong_v) { return _mm256_cvtepu16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ullong_v, double_v) { return AVX::concat(SSE::convert<ullong, double>(AVX::lo128(x.data())), SSE::convert<ullong, double>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  float_v) { return AVX::zeroExtend(_mm_movelh_ps(SSE::convert<ullong, float>(AVX::lo128(x.data())), SSE::convert<ullong, float>(AVX::hi128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(ullong_v,    int_v) { return AVX::zeroExtend(AVX::lo128(_mm256_permutevar8x32_epi32(x.data(), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))); }
+Vc_SIMD_CAST_AVX_1(ullong_v,   uint_v) { return simd_cast<AVX2::int_v>(x).data(); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  short_v) { return simd_cast<AVX2::short_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(ullong_v, ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  llong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2(ullong_v,  float_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::float_v>(x0).data()), AVX::lo128(simd_cast<AVX2::float_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2(ullong_v,    int_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::int_v>(x0).data()), AVX::lo128(simd_cast<AVX2::int_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2(ullong_v,   uint_v) { return simd_cast<AVX2::int_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_1(double_v, ullong_v) { return AVX::concat(SSE::convert<double, ullong>(AVX::lo128(x.data())), SSE::convert<double, ullong>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( float_v, ullong_v) { return AVX::concat(SSE::convert<float, ullong>(AVX::lo128(x.data())), SSE::convert<float, ullong>(_mm_movehl_ps(AVX::lo128(x.data()), AVX::lo128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(   int_v, ullong_v) { return _mm256_cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v, ullong_v) { return _mm256_cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( short_v, ullong_v) { return _mm256_cvtepi16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ushort_v, ullong_v) { return _mm256_cvtepu16_epi64(AVX::lo128(x.data())); }
+#ifdef __LP64__
+Vc_SIMD_CAST_AVX_1(  long_v, double_v) { return AVX::concat(SSE::convert<long, double>(AVX::lo128(x.data())), SSE::convert<long, double>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1(  long_v,  float_v) { return AVX::zeroExtend(_mm_movelh_ps(SSE::convert<long, float>(AVX::lo128(x.data())), SSE::convert<long, float>(AVX::hi128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(  long_v,    int_v) { return AVX::zeroExtend(AVX::lo128(_mm256_permutevar8x32_epi32(x.data(), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))); }
+Vc_SIMD_CAST_AVX_1(  long_v,   uint_v) { return simd_cast<AVX2::int_v>(x).data(); }
+Vc_SIMD_CAST_AVX_1(  long_v,  short_v) { return simd_cast<AVX2::short_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  long_v, ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1(  long_v,  llong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(  long_v, ullong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(  long_v,  ulong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2(  long_v,  float_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::float_v>(x0).data()), AVX::lo128(simd_cast<AVX2::float_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2(  long_v,    int_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::int_v>(x0).data()), AVX::lo128(simd_cast<AVX2::int_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2(  long_v,   uint_v) { return simd_cast<AVX2::int_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_1(double_v,   long_v) { return AVX::concat(SSE::convert<double, long>(AVX::lo128(x.data())), SSE::convert<double, long>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( float_v,   long_v) { return AVX::concat(SSE::convert<float, long>(AVX::lo128(x.data())), SSE::convert<float, long>(_mm_movehl_ps(AVX::lo128(x.data()), AVX::lo128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(   int_v,   long_v) { return _mm256_cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v,   long_v) { return _mm256_cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( short_v,   long_v) { return _mm256_cvtepi16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ushort_v,   long_v) { return _mm256_cvtepu16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( ulong_v, double_v) { return AVX::concat(SSE::convert<ulong, double>(AVX::lo128(x.data())), SSE::convert<ulong, double>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( ulong_v,  float_v) { return AVX::zeroExtend(_mm_movelh_ps(SSE::convert<ulong, float>(AVX::lo128(x.data())), SSE::convert<ulong, float>(AVX::hi128(x.data())))); }
+Vc_SIMD_CAST_AVX_1( ulong_v,    int_v) { return AVX::zeroExtend(AVX::lo128(_mm256_permutevar8x32_epi32(x.data(), _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)))); }
+Vc_SIMD_CAST_AVX_1( ulong_v,   uint_v) { return simd_cast<AVX2::int_v>(x).data(); }
+Vc_SIMD_CAST_AVX_1( ulong_v,  short_v) { return simd_cast<AVX2::short_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( ulong_v, ushort_v) { return simd_cast<AVX2::ushort_v>(simd_cast<AVX2::int_v>(x)); }
+Vc_SIMD_CAST_AVX_1( ulong_v,  llong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1( ulong_v, ullong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1( ulong_v,   long_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_2( ulong_v,  float_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::float_v>(x0).data()), AVX::lo128(simd_cast<AVX2::float_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2( ulong_v,    int_v) { return AVX::concat(AVX::lo128(simd_cast<AVX2::int_v>(x0).data()), AVX::lo128(simd_cast<AVX2::int_v>(x1).data())); }
+Vc_SIMD_CAST_AVX_2( ulong_v,   uint_v) { return simd_cast<AVX2::int_v>(x0, x1).data(); }
+Vc_SIMD_CAST_AVX_1(double_v,  ulong_v) { return AVX::concat(SSE::convert<double, ulong>(AVX::lo128(x.data())), SSE::convert<double, ulong>(AVX::hi128(x.data()))); }
+Vc_SIMD_CAST_AVX_1( float_v,  ulong_v) { return AVX::concat(SSE::convert<float, ulong>(AVX::lo128(x.data())), SSE::convert<float, ulong>(_mm_movehl_ps(AVX::lo128(x.data()), AVX::lo128(x.data())))); }
+Vc_SIMD_CAST_AVX_1(   int_v,  ulong_v) { return _mm256_cvtepi32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(  uint_v,  ulong_v) { return _mm256_cvtepu32_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( short_v,  ulong_v) { return _mm256_cvtepi16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1(ushort_v,  ulong_v) { return _mm256_cvtepu16_epi64(AVX::lo128(x.data())); }
+Vc_SIMD_CAST_AVX_1( llong_v,   long_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1( llong_v,  ulong_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(ullong_v,   long_v) { return x.data(); }
+Vc_SIMD_CAST_AVX_1(ullong_v,  ulong_v) { return x.data(); }
+#endif
+#endif
+
 // 1 SSE::Vector to 1 AVX2::Vector {{{2
 Vc_SIMD_CAST_1(SSE::double_v, AVX2::double_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE:: float_v, AVX2::double_v) { return _mm256_cvtps_pd(x.data()); }
@@ -1449,6 +1764,13 @@ Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast
 Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ushort_v) { return AVX::zeroExtend(simd_cast<SSE::ushort_v>(x).data()); }
 Vc_SIMD_CAST_1(SSE:: short_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
 Vc_SIMD_CAST_1(SSE::ushort_v, AVX2::ushort_v) { return AVX::zeroExtend(x.data()); }
+
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2:: llong_v) { return _mm256_cvtepi32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2:: llong_v) { return _mm256_cvtepu32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::   int_v, AVX2::ullong_v) { return _mm256_cvtepi32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE::  uint_v, AVX2::ullong_v) { return _mm256_cvtepu32_epi64(x.data()); }
+Vc_SIMD_CAST_1(SSE:: float_v, AVX2:: llong_v) { return simd_cast<AVX2:: llong_v>(simd_cast<AVX2::double_v>(x)); }
+Vc_SIMD_CAST_1(SSE:: float_v, AVX2::ullong_v) { return simd_cast<AVX2::ullong_v>(simd_cast<AVX2::double_v>(x)); }
 #endif
 
 // 2 SSE::Vector to 1 AVX2::Vector {{{2
@@ -1594,6 +1916,11 @@ Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: float_v) { return simd_cast<SSE:: float_v>(
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::   int_v) { return simd_cast<SSE::   int_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE::  uint_v) { return simd_cast<SSE::  uint_v>(simd_cast<SSE::ushort_v>(x)); }
 Vc_SIMD_CAST_1(AVX2::ushort_v, SSE:: short_v) { return simd_cast<SSE:: short_v>(simd_cast<SSE::ushort_v>(x)); }
+
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::   int_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2:: llong_v, SSE::  uint_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::   int_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
+Vc_SIMD_CAST_1(AVX2::ullong_v, SSE::  uint_v) { return AVX::lo128(simd_cast<AVX2::int_v>(x).data()); }
 #endif
 
 // 2 AVX2::Vector to 1 SSE::Vector {{{2
@@ -1798,6 +2125,15 @@ simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
 {
     return _mm256_setr_epi16(x0.data(), x1.data(), x2.data(), x3.data(), 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0);
 }
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1, Scalar::Vector<T> x2,
+          Scalar::Vector<T> x3,
+          enable_if<(std::is_same<Return, AVX2::llong_v>::value ||
+                     std::is_same<Return, AVX2::ullong_v>::value)>)
+{
+    return _mm256_setr_epi64x(x0.data(), x1.data(), x2.data(), x3.data());
+}
 #endif
 
 // 5 Scalar::Vector to 1 AVX2::Vector {{{2
@@ -2284,6 +2620,11 @@ Vc_SIMD_CAST_AVX_4(double_m, short_m)
                   _mm_unpackhi_epi32(lo128(tmp), hi128(tmp)));  // c0 c1 c2 c3 d0 d1 d2 d3
 }
 Vc_SIMD_CAST_AVX_4(double_m, ushort_m) { return simd_cast<AVX2::short_m>(x0, x1, x2, x3).data(); }
+
+Vc_SIMD_CAST_AVX_4(   int_m,  schar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(simd_cast<AVX2::short_m>(x0, x1).dataI(), simd_cast<AVX2::short_m>(x2, x3).dataI())); }
+Vc_SIMD_CAST_AVX_4(   int_m,  uchar_m) { return simd_cast<AVX2::schar_m>(x0, x1, x2, x3).data(); }
+Vc_SIMD_CAST_AVX_4(  uint_m,  schar_m) { return Mem::permute4x64<X0, X2, X1, X3>(_mm256_packs_epi16(simd_cast<AVX2::short_m>(x0, x1).dataI(), simd_cast<AVX2::short_m>(x2, x3).dataI())); }
+Vc_SIMD_CAST_AVX_4(  uint_m,  uchar_m) { return simd_cast<AVX2::schar_m>(x0, x1, x2, x3).data(); }
 #endif
 
 // 1 SSE::Mask to 1 AVX2::Mask {{{2
@@ -2332,6 +2673,15 @@ Vc_SIMD_CAST_1(SSE:: short_m, AVX2::  uint_m) { const auto v = Mem::permute4x64<
 
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::   int_m) { const auto v = Mem::permute4x64<X0, X2, X1, X3>(AVX::avx_cast<__m256i>(x.data())); return _mm256_unpacklo_epi16(v, v); }
 Vc_SIMD_CAST_1(SSE::ushort_m, AVX2::  uint_m) { const auto v = Mem::permute4x64<X0, X2, X1, X3>(AVX::avx_cast<__m256i>(x.data())); return _mm256_unpacklo_epi16(v, v); }
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(SSE::Mask<T> k,
+          enable_if<(std::is_same<Return, AVX2::llong_m>::value ||
+                     std::is_same<Return, AVX2::ullong_m>::value)>)
+{
+    return {simd_cast<AVX2::double_m>(k).dataI()};
+}
 #endif
 
 // 2 SSE::Mask to 1 AVX2::Mask {{{2
@@ -2511,6 +2861,14 @@ Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::   int_m) { return simd_cast<SSE::   int_m>(
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::  uint_m) { return simd_cast<SSE::  uint_m>(SSE::ushort_m(AVX::lo128(x.data()))); }
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE:: short_m) { return simd_cast<SSE:: short_m>(SSE::ushort_m(AVX::lo128(x.data()))); }
 Vc_SIMD_CAST_1(AVX2::ushort_m, SSE::ushort_m) { return simd_cast<SSE::ushort_m>(SSE::ushort_m(AVX::lo128(x.data()))); }
+
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(AVX2::Mask<T> k, enable_if<(SSE::is_mask<Return>::value &&
+                                      std::is_integral<T>::value && sizeof(T) == 8)>)
+{
+    return simd_cast<Return>(AVX2::double_m(k.dataI()));
+}
 #endif
 
 // 2 AVX2::Mask to 1 SSE::Mask {{{2
@@ -2666,6 +3024,19 @@ simd_cast(const AVX2::Mask<T> &k,
     return AVX::concat(_mm_unpacklo_epi16(tmp, tmp), _mm_unpackhi_epi16(tmp, tmp));
 }
 
+#ifdef Vc_IMPL_AVX2
+// (s|u)char_v have size 32, so they reach (u)llong_v and double_v with offsets 1 to 7
+template <typename Return, int offset, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(const AVX2::Mask<T> &k,
+          enable_if<(AVX2::is_mask<Return>::value && offset != 0 &&
+                     AVX2::Mask<T>::Size == Return::Size * 8)> = nullarg)
+{
+    const auto tmp = offset < 4 ? AVX::lo128(k.dataI()) : AVX::hi128(k.dataI());
+    return _mm256_cvtepi8_epi64(_mm_srli_si128(tmp, (offset % 4) * 4));
+}
+#endif
+
 // 1 SSE::Mask to N AVX2::Mask {{{2
 Vc_SIMD_CAST_OFFSET(SSE:: short_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
 Vc_SIMD_CAST_OFFSET(SSE::ushort_m, AVX2::double_m, 1) { auto tmp = _mm_unpackhi_epi16(x.dataI(), x.dataI()); return AVX::concat(_mm_unpacklo_epi32(tmp, tmp), _mm_unpackhi_epi32(tmp, tmp)); }
@@ -278,10 +278,13 @@ public:
         }
 
         ////////////////////////////////////////////////////////////////////////////////
-        // all remaining converting gathers
+        // all remaining converting gathers (via a SimdArray, which does not support 8-bit
+        // and 64-bit integral entries; those use the generic implementation)
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
                                 Traits::is_valid_vector_argument<MT>::value &&
+                                (sizeof(MT) == 2 || sizeof(MT) == 4 ||
+                                 std::is_same<MT, double>::value) &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
                                void>
@@ -294,6 +297,8 @@ public:
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
                                 Traits::is_valid_vector_argument<MT>::value &&
+                                (sizeof(MT) == 2 || sizeof(MT) == 4 ||
+                                 std::is_same<MT, double>::value) &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
                                void>
@@ -76,6 +76,44 @@ Vc_INTRINSIC AVX2::   int_m operator< (AVX2::   int_v a, AVX2::   int_v b) { ret
 Vc_INTRINSIC AVX2::  uint_m operator< (AVX2::  uint_v a, AVX2::  uint_v b) { return AVX::cmplt_epu32(a.data(), b.data()); }
 Vc_INTRINSIC AVX2:: short_m operator< (AVX2:: short_v a, AVX2:: short_v b) { return AVX::cmplt_epi16(a.data(), b.data()); }
 Vc_INTRINSIC AVX2::ushort_m operator< (AVX2::ushort_v a, AVX2::ushort_v b) { return AVX::cmplt_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator==(AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator==(AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpeq_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator!=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator!=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpeq_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator>=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmplt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator>=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmplt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator<=(AVX2:: schar_v a, AVX2:: schar_v b) { return not_(AVX::cmpgt_epi8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: uchar_m operator<=(AVX2:: uchar_v a, AVX2:: uchar_v b) { return not_(AVX::cmpgt_epu8(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: schar_m operator> (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmpgt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator> (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmpgt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: schar_m operator< (AVX2:: schar_v a, AVX2:: schar_v b) { return AVX::cmplt_epi8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: uchar_m operator< (AVX2:: uchar_v a, AVX2:: uchar_v b) { return AVX::cmplt_epu8(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator==(AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator==(AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator!=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator!=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator>=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmplt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator>=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmplt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator<=(AVX2:: llong_v a, AVX2:: llong_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::ullong_m operator<=(AVX2::ullong_v a, AVX2::ullong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: llong_m operator> (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator> (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: llong_m operator< (AVX2:: llong_v a, AVX2:: llong_v b) { return AVX::cmplt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ullong_m operator< (AVX2::ullong_v a, AVX2::ullong_v b) { return AVX::cmplt_epu64(a.data(), b.data()); }
+#ifdef __LP64__
+Vc_INTRINSIC AVX2::  long_m operator==(AVX2::  long_v a, AVX2::  long_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: ulong_m operator==(AVX2:: ulong_v a, AVX2:: ulong_v b) { return AVX::cmpeq_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::  long_m operator!=(AVX2::  long_v a, AVX2::  long_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: ulong_m operator!=(AVX2:: ulong_v a, AVX2:: ulong_v b) { return not_(AVX::cmpeq_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::  long_m operator>=(AVX2::  long_v a, AVX2::  long_v b) { return not_(AVX::cmplt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: ulong_m operator>=(AVX2:: ulong_v a, AVX2:: ulong_v b) { return not_(AVX::cmplt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::  long_m operator<=(AVX2::  long_v a, AVX2::  long_v b) { return not_(AVX::cmpgt_epi64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2:: ulong_m operator<=(AVX2:: ulong_v a, AVX2:: ulong_v b) { return not_(AVX::cmpgt_epu64(a.data(), b.data())); }
+Vc_INTRINSIC AVX2::  long_m operator> (AVX2::  long_v a, AVX2::  long_v b) { return AVX::cmpgt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: ulong_m operator> (AVX2:: ulong_v a, AVX2:: ulong_v b) { return AVX::cmpgt_epu64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::  long_m operator< (AVX2::  long_v a, AVX2::  long_v b) { return AVX::cmplt_epi64(a.data(), b.data()); }
+Vc_INTRINSIC AVX2:: ulong_m operator< (AVX2:: ulong_v a, AVX2:: ulong_v b) { return AVX::cmplt_epu64(a.data(), b.data()); }
+#endif
 #endif  // Vc_IMPL_AVX2
 
 // bitwise operators {{{1
@@ -229,6 +267,94 @@ template <> template <typename G> Vc_INTRINSIC AVX2::ushort_v AVX2::ushort_v::ge
     const auto tmp15 = gen(15);
     return _mm256_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
 }
+template <> template <typename G> Vc_INTRINSIC AVX2::schar_v AVX2::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
+template <> template <typename G> Vc_INTRINSIC AVX2::uchar_v AVX2::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    const auto tmp16 = gen(16);
+    const auto tmp17 = gen(17);
+    const auto tmp18 = gen(18);
+    const auto tmp19 = gen(19);
+    const auto tmp20 = gen(20);
+    const auto tmp21 = gen(21);
+    const auto tmp22 = gen(22);
+    const auto tmp23 = gen(23);
+    const auto tmp24 = gen(24);
+    const auto tmp25 = gen(25);
+    const auto tmp26 = gen(26);
+    const auto tmp27 = gen(27);
+    const auto tmp28 = gen(28);
+    const auto tmp29 = gen(29);
+    const auto tmp30 = gen(30);
+    const auto tmp31 = gen(31);
+    return _mm256_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9, tmp10, tmp11, tmp12, tmp13, tmp14, tmp15, tmp16, tmp17, tmp18, tmp19, tmp20, tmp21, tmp22, tmp23, tmp24, tmp25, tmp26, tmp27, tmp28, tmp29, tmp30, tmp31);
+}
+#define Vc_GENERATE_64(V_)                                                                \
+    template <> template <typename G> Vc_INTRINSIC AVX2::V_ AVX2::V_::generate(G gen)    \
+    {                                                                                    \
+        const auto tmp0 = gen(0);                                                        \
+        const auto tmp1 = gen(1);                                                        \
+        const auto tmp2 = gen(2);                                                        \
+        const auto tmp3 = gen(3);                                                        \
+        return _mm256_setr_epi64x(tmp0, tmp1, tmp2, tmp3);                               \
+    }
+Vc_GENERATE_64(llong_v)
+Vc_GENERATE_64(ullong_v)
+#ifdef __LP64__
+Vc_GENERATE_64(long_v)
+Vc_GENERATE_64(ulong_v)
+#endif
+#undef Vc_GENERATE_64
 #endif
 
 // constants {{{1
@@ -243,6 +369,12 @@ template <> Vc_INTRINSIC Vector< short, VectorAbi::Avx>::Vector(VectorSpecialIni
 template <> Vc_INTRINSIC Vector<ushort, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu16()) {}
 template <> Vc_INTRINSIC Vector< schar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi8()) {}
 template <> Vc_INTRINSIC Vector< uchar, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu8()) {}
+template <> Vc_INTRINSIC Vector< llong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi64()) {}
+template <> Vc_INTRINSIC Vector<ullong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu64()) {}
+#ifdef __LP64__
+template <> Vc_INTRINSIC Vector<  long, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epi64()) {}
+template <> Vc_INTRINSIC Vector< ulong, VectorAbi::Avx>::Vector(VectorSpecialInitializerOne) : d(AVX::setone_epu64()) {}
+#endif
 #endif
 
 template <typename T>
@@ -262,6 +394,22 @@ Vc_ALWAYS_INLINE Vector<double, VectorAbi::Avx>::Vector(VectorSpecialInitializer
     : Vector(AVX::IndexesFromZeroData<int>::address(), Vc::Aligned)
 {
 }
+#ifdef Vc_IMPL_AVX2
+#define Vc_INDEXES_FROM_ZERO_64(T_)                                                      \
+    template <>                                                                          \
+    Vc_ALWAYS_INLINE Vector<T_, VectorAbi::Avx>::Vector(                                 \
+        VectorSpecialInitializerIndexesFromZero)                                         \
+        : d(_mm256_setr_epi64x(0, 1, 2, 3))                                              \
+    {                                                                                    \
+    }
+Vc_INDEXES_FROM_ZERO_64(long long)
+Vc_INDEXES_FROM_ZERO_64(unsigned long long)
+#ifdef __LP64__
+Vc_INDEXES_FROM_ZERO_64(long)
+Vc_INDEXES_FROM_ZERO_64(unsigned long)
+#endif
+#undef Vc_INDEXES_FROM_ZERO_64
+#endif
 
 ///////////////////////////////////////////////////////////////////////////////////////////
 // load member functions {{{1
@@ -343,6 +491,20 @@ template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector< short> Vector< short, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
 template <> Vc_ALWAYS_INLINE AVX2::Vector<ushort> Vector<ushort, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator<<(AsArg x) const { return generate([&](int i) { return get(*this, i) << get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< schar> Vector< schar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< uchar> Vector< uchar, VectorAbi::Avx>::operator>>(AsArg x) const { return generate([&](int i) { return get(*this, i) >> get(x, i); }); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< llong> Vector< llong, VectorAbi::Avx>::operator>>(AsArg x) const { return AVX::srav_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<ullong> Vector<ullong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
+#ifdef __LP64__
+template <> Vc_ALWAYS_INLINE AVX2::Vector<  long> Vector<  long, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< ulong> Vector< ulong, VectorAbi::Avx>::operator<<(AsArg x) const { return _mm256_sllv_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector<  long> Vector<  long, VectorAbi::Avx>::operator>>(AsArg x) const { return AVX::srav_epi64(d.v(), x.d.v()); }
+template <> Vc_ALWAYS_INLINE AVX2::Vector< ulong> Vector< ulong, VectorAbi::Avx>::operator>>(AsArg x) const { return _mm256_srlv_epi64(d.v(), x.d.v()); }
+#endif
 template <typename T>
 Vc_ALWAYS_INLINE AVX2::Vector<T> &Vector<T, VectorAbi::Avx>::operator<<=(AsArg x)
 {
@@ -426,6 +588,33 @@ Vc_GATHER_IMPL(ushort_v)
                               Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
                               Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15));
 }
+
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5),
+                             Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
+                             Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15), Vc_M(16), Vc_M(17),
+                             Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29),
+                             Vc_M(30), Vc_M(31));
+}
+
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm256_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5),
+                             Vc_M(6), Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11),
+                             Vc_M(12), Vc_M(13), Vc_M(14), Vc_M(15), Vc_M(16), Vc_M(17),
+                             Vc_M(18), Vc_M(19), Vc_M(20), Vc_M(21), Vc_M(22), Vc_M(23),
+                             Vc_M(24), Vc_M(25), Vc_M(26), Vc_M(27), Vc_M(28), Vc_M(29),
+                             Vc_M(30), Vc_M(31));
+}
+
+Vc_GATHER_IMPL(llong_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+Vc_GATHER_IMPL(ullong_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+#ifdef __LP64__
+Vc_GATHER_IMPL(long_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+Vc_GATHER_IMPL(ulong_v) { d.v() = _mm256_setr_epi64x(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3)); }
+#endif
 #endif
 #undef Vc_M
 #undef Vc_GATHER_IMPL
@@ -797,6 +986,31 @@ template<typename T> Vc_INTRINSIC AVX2::Vector<T> Vector<T, VectorAbi::Avx>::rot
     return Detail::rotated<EntryType, size()>(d.v(), amount);
 }
 // sorted {{{1
+#ifdef Vc_IMPL_AVX2
+namespace Detail
+{
+// sorting network for four 64-bit entries: (0,1) (2,3), (0,2) (1,3), (1,2)
+template <typename T> Vc_INTRINSIC Vc_CONST AVX2::Vector<T> sorted4(AVX2::Vector<T> x_)
+{
+    __m256i x = x_.data();
+    __m256i y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(2, 3, 0, 1));
+    __m256i gt = cmpgt(x, y, T());
+    x = _mm256_blend_epi32(_mm256_blendv_epi8(x, y, gt), _mm256_blendv_epi8(y, x, gt), 0xcc);
+    y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(1, 0, 3, 2));
+    gt = cmpgt(x, y, T());
+    x = _mm256_blend_epi32(_mm256_blendv_epi8(x, y, gt), _mm256_blendv_epi8(y, x, gt), 0xf0);
+    y = _mm256_permute4x64_epi64(x, _MM_SHUFFLE(3, 1, 2, 0));
+    gt = cmpgt(x, y, T());
+    return _mm256_blend_epi32(_mm256_blendv_epi8(x, y, gt), _mm256_blendv_epi8(y, x, gt), 0x30);
+}
+inline Vc_CONST AVX2::llong_v sorted(AVX2::llong_v x) { return sorted4(x); }
+inline Vc_CONST AVX2::ullong_v sorted(AVX2::ullong_v x) { return sorted4(x); }
+#ifdef __LP64__
+inline Vc_CONST AVX2::long_v sorted(AVX2::long_v x) { return sorted4(x); }
+inline Vc_CONST AVX2::ulong_v sorted(AVX2::ulong_v x) { return sorted4(x); }
+#endif
+}  // namespace Detail
+#endif
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Avx> Vector<T, VectorAbi::Avx>::sorted()
     const
@@ -894,6 +1108,35 @@ Vc_INTRINSIC Vc_PURE AVX2::ushort_v AVX2::ushort_v::operator[](
         AVX::avx_cast<__m256d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
         AVX::avx_cast<__m256d>(Mem::permuteLo<X3, X2, X1, X0>(d.v())))));
 }
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::schar_v AVX2::schar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15,
+                                14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+}
+template <>
+Vc_INTRINSIC Vc_PURE AVX2::uchar_v AVX2::uchar_v::operator[](
+    Permutation::ReversedTag) const
+{
+    return Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        d.v(), _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15,
+                                14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)));
+}
+#define Vc_REVERSED_64(V_)                                                               \
+    template <>                                                                          \
+    Vc_INTRINSIC Vc_PURE AVX2::V_ AVX2::V_::operator[](Permutation::ReversedTag) const   \
+    {                                                                                    \
+        return _mm256_permute4x64_epi64(d.v(), _MM_SHUFFLE(0, 1, 2, 3));                 \
+    }
+Vc_REVERSED_64(llong_v)
+Vc_REVERSED_64(ullong_v)
+#ifdef __LP64__
+Vc_REVERSED_64(long_v)
+Vc_REVERSED_64(ulong_v)
+#endif
+#undef Vc_REVERSED_64
 #endif
 template <> Vc_INTRINSIC AVX2::float_v Vector<float, VectorAbi::Avx>::operator[](const IndexType &/*perm*/) const
 {
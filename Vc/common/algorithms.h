@@ -29,6 +29,16 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define VC_COMMON_ALGORITHMS_H_
 
 #include "simdize.h"
+#include "threadpool.h"
+#include "../Allocator"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
 
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -161,6 +171,1481 @@ simd_for_each_n(InputIt first, std::size_t count, UnaryFunction f)
     return std::move(f);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Type of the Vc::MaskedEpilogue policy object.
+ */
+struct MaskedEpilogueTag {};
+
+/**
+ * \ingroup Utilities
+ *
+ * Policy object for simd_for_each and simd_for_each_n that selects the masked epilogue
+ * variant of the algorithm.
+ *
+ * Instead of finishing the range with up to `V::Size - 1` calls with a one-element
+ * vector type, the remainder is processed with a single call on the full vector type.
+ * The lanes of that call that lie outside the range are zero-initialized and never
+ * written back. For ranges of arithmetic types an aligned prologue (again a single masked
+ * call) is executed first, so that the main loop can use aligned loads and stores.
+ *
+ * \code
+ * Vc::simd_for_each(Vc::MaskedEpilogue, data.begin(), data.end(), [&](auto &v) {
+ *   v *= factor;
+ * });
+ * \endcode
+ *
+ * \note The functor is only ever called with the full vector type. Reductions over the
+ * argument must therefore ignore (or be neutral to) the zero-initialized lanes.
+ */
+constexpr MaskedEpilogueTag MaskedEpilogue = {};
+
+namespace Detail
+{
+// simd_for_each_store {{{
+/**\internal
+ * Writes \p tmp back to \p mem, unless the functor took its argument by value or const
+ * reference.
+ */
+template <class V, class T, class... Args>
+Vc_INTRINSIC void simd_for_each_store(std::true_type, const V &, T *, Args &&...)
+{
+}
+template <class V, class T, class... Args>
+Vc_INTRINSIC void simd_for_each_store(std::false_type, const V &tmp, T *mem,
+                                      Args &&... args)
+{
+    tmp.store(mem, std::forward<Args>(args)...);
+}
+// }}}
+// simd_for_each_masked_call {{{
+/**\internal
+ * Calls \p f with the lanes of \p mem selected by \p k. Only the selected lanes are read
+ * from and (for mutable functors) written back to memory. All other lanes are zero.
+ */
+template <class V, class T, class UnaryFunction, class Immutable>
+Vc_INTRINSIC void simd_for_each_masked_call(T *mem, const typename V::Mask &k,
+                                            UnaryFunction &f, Immutable immutable)
+{
+    V tmp = V::Zero();
+    tmp.gather(mem, typename V::IndexType(Vc::IndexesFromZero), k);
+    f(tmp);
+    simd_for_each_store(immutable, tmp, mem, k, Vc::Unaligned);
+}
+// }}}
+// simd_for_each_masked for arithmetic value types {{{
+template <class ValueType, class T, class UnaryFunction, class Immutable>
+inline void simd_for_each_masked(T *mem, std::size_t count, UnaryFunction &f,
+                                 Immutable immutable, std::true_type)
+{
+    typedef simdize<ValueType> V;
+    typedef typename V::Mask M;
+
+    // aligned prologue
+    const auto addr = reinterpret_cast<std::uintptr_t>(mem);
+    const std::size_t misalignment = addr % V::MemoryAlignment;
+    if (misalignment != 0 && addr % sizeof(ValueType) == 0) {
+        const std::size_t offset = misalignment / sizeof(ValueType);
+        const std::size_t n = std::min(count, V::Size - offset);
+        const V lane(Vc::IndexesFromZero);
+        const M k = (lane >= V(ValueType(offset))) && (lane < V(ValueType(offset + n)));
+        simd_for_each_masked_call<V>(mem - offset, k, f, immutable);
+        mem += n;
+        count -= n;
+        for (; count >= V::Size; count -= V::Size, mem += V::Size) {
+            V tmp(mem, Vc::Aligned);
+            f(tmp);
+            simd_for_each_store(immutable, tmp, mem, Vc::Aligned);
+        }
+    } else {
+        for (; count >= V::Size; count -= V::Size, mem += V::Size) {
+            V tmp(mem, Vc::Unaligned);
+            f(tmp);
+            simd_for_each_store(immutable, tmp, mem, Vc::Unaligned);
+        }
+    }
+
+    // masked epilogue
+    if (count > 0) {
+        simd_for_each_masked_call<V>(
+            mem, V(Vc::IndexesFromZero) < V(ValueType(count)), f, immutable);
+    }
+}
+// }}}
+// simd_for_each_masked for simdized structures {{{
+template <class V, class T>
+Vc_INTRINSIC void simd_for_each_store_interleaved(std::true_type, const V &, T *)
+{
+}
+template <class V, class T>
+Vc_INTRINSIC void simd_for_each_store_interleaved(std::false_type, const V &tmp, T *mem)
+{
+    store_interleaved(tmp, mem);
+}
+
+template <class V, class U, class T>
+Vc_INTRINSIC void simd_for_each_store_partial(std::true_type, const V &, U *, std::size_t,
+                                              T *)
+{
+}
+template <class V, class U, class T>
+Vc_INTRINSIC void simd_for_each_store_partial(std::false_type, const V &tmp, U *buffer,
+                                              std::size_t count, T *mem)
+{
+    store_interleaved(tmp, buffer);
+    std::copy_n(buffer, count, mem);
+}
+
+template <class ValueType, class T, class UnaryFunction, class Immutable>
+inline void simd_for_each_masked(T *mem, std::size_t count, UnaryFunction &f,
+                                 Immutable immutable, std::false_type)
+{
+    typedef simdize<ValueType> V;
+    for (; count >= V::Size; count -= V::Size, mem += V::Size) {
+        V tmp;
+        load_interleaved(tmp, mem);
+        f(tmp);
+        simd_for_each_store_interleaved(immutable, tmp, mem);
+    }
+
+    // There is no masked load/store for simdized structures. Therefore the epilogue goes
+    // through a value-initialized buffer that holds exactly V::Size objects.
+    if (count > 0) {
+        ValueType buffer[V::Size] = {};
+        std::copy_n(mem, count, buffer);
+        V tmp;
+        load_interleaved(tmp, &buffer[0]);
+        f(tmp);
+        simd_for_each_store_partial(immutable, tmp, &buffer[0], count, mem);
+    }
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Variant of simd_for_each that processes the remainder of the range with a single
+ * masked call. See Vc::MaskedEpilogue.
+ *
+ * \param first Start of the range. The range must be contiguous in memory.
+ * \param last End of the range.
+ * \param f The functor to call with vector objects.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each(MaskedEpilogueTag, InputIt first, InputIt last,
+                                   UnaryFunction f)
+{
+    if (first != last) {
+        Detail::simd_for_each_masked<ValueType>(
+            std::addressof(*first), std::distance(first, last), f,
+            Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>(),
+            std::is_arithmetic<ValueType>());
+    }
+    return std::move(f);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Variant of simd_for_each_n that processes the remainder of the range with a single
+ * masked call. See Vc::MaskedEpilogue.
+ *
+ * \param first Start of the range. The range must be contiguous in memory.
+ * \param count The number of elements in the range.
+ * \param f The functor to call with vector objects.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each_n(MaskedEpilogueTag, InputIt first, std::size_t count,
+                                     UnaryFunction f)
+{
+    if (count > 0) {
+        Detail::simd_for_each_masked<ValueType>(
+            std::addressof(*first), count, f,
+            Traits::is_functor_argument_immutable<UnaryFunction, simdize<ValueType>>(),
+            std::is_arithmetic<ValueType>());
+    }
+    return std::move(f);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::transform` algorithm.
+ *
+ * Calls \p op with `Vc::simdize<` *iterator value type* `>` objects loaded from the
+ * range from \p first to \p last and stores the returned vectors to the range starting
+ * at \p d_first. Like in simd_for_each, the remainder of the range is processed with
+ * one-element vectors.
+ *
+ * \code
+ * Vc::simd_transform(x.begin(), x.end(), y.begin(), [](auto v) { return v * v; });
+ * \endcode
+ *
+ * \param first Start of the input range. The range must be contiguous in memory.
+ * \param last End of the input range.
+ * \param d_first Start of the output range. The range must be contiguous in memory.
+ * \param op The operation to apply. It must return a vector with the same number of
+ *           entries as its argument, convertible to `Vc::simdize<` *output value type*
+ *           `>`.
+ *
+ * \return The output iterator to the element past the last element written.
+ */
+template <class InputIt, class OutputIt, class UnaryOperation,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type,
+          class OutputType = typename std::iterator_traits<OutputIt>::value_type>
+inline OutputIt simd_transform(InputIt first, InputIt last, OutputIt d_first,
+                               UnaryOperation op)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    typedef simdize<OutputType, V::Size> R;
+    typedef simdize<OutputType, 1> R1;
+    for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size, d_first += V::Size) {
+        V tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        const R r = op(tmp);
+        store_interleaved(r, std::addressof(*d_first));
+    }
+    for (; first != last; ++first, ++d_first) {
+        V1 tmp;
+        load_interleaved(tmp, std::addressof(*first));
+        const R1 r = op(tmp);
+        store_interleaved(r, std::addressof(*d_first));
+    }
+    return d_first;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the binary `std::transform` algorithm.
+ *
+ * Calls \p op with pairs of vectors loaded from the ranges starting at \p first1 and \p
+ * first2 and stores the returned vectors to the range starting at \p d_first. Both
+ * arguments to \p op have the same number of entries, determined by the value type of \p
+ * first1.
+ *
+ * \return The output iterator to the element past the last element written.
+ */
+template <class InputIt1, class InputIt2, class OutputIt, class BinaryOperation,
+          class ValueType1 = typename std::iterator_traits<InputIt1>::value_type,
+          class ValueType2 = typename std::iterator_traits<InputIt2>::value_type,
+          class OutputType = typename std::iterator_traits<OutputIt>::value_type>
+inline OutputIt simd_transform(InputIt1 first1, InputIt1 last1, InputIt2 first2,
+                               OutputIt d_first, BinaryOperation op)
+{
+    typedef simdize<ValueType1> V;
+    typedef simdize<ValueType2, V::Size> W;
+    typedef simdize<OutputType, V::Size> R;
+    typedef simdize<ValueType1, 1> V1;
+    typedef simdize<ValueType2, 1> W1;
+    typedef simdize<OutputType, 1> R1;
+    for (; last1 - first1 >= std::ptrdiff_t(V::Size);
+         first1 += V::Size, first2 += V::Size, d_first += V::Size) {
+        V a;
+        W b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        const R r = op(a, b);
+        store_interleaved(r, std::addressof(*d_first));
+    }
+    for (; first1 != last1; ++first1, ++first2, ++d_first) {
+        V1 a;
+        W1 b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        const R1 r = op(a, b);
+        store_interleaved(r, std::addressof(*d_first));
+    }
+    return d_first;
+}
+
+namespace Detail
+{
+// simd_transform_reduce_impl {{{
+/**\internal
+ * Reduces \p count elements with vector accumulators. `next.template get<V>()` loads the
+ * next `V::Size` elements, advances the input iterators and returns the transformed
+ * vector. Four independent accumulators hide the latency of \p reduce. The horizontal
+ * reduction of the accumulator lanes is done exactly once, at the end.
+ */
+template <class V, class V1, class T, class BinaryReductionOp, class Next>
+inline T simd_transform_reduce_impl(std::size_t count, T init, BinaryReductionOp &reduce,
+                                    Next next)
+{
+    if (count >= V::Size) {
+        auto acc0 = next.template get<V>();
+        count -= V::Size;
+        if (count >= 3 * V::Size) {
+            decltype(acc0) acc1 = next.template get<V>();
+            decltype(acc0) acc2 = next.template get<V>();
+            decltype(acc0) acc3 = next.template get<V>();
+            count -= 3 * V::Size;
+            for (; count >= 4 * V::Size; count -= 4 * V::Size) {
+                acc0 = reduce(acc0, next.template get<V>());
+                acc1 = reduce(acc1, next.template get<V>());
+                acc2 = reduce(acc2, next.template get<V>());
+                acc3 = reduce(acc3, next.template get<V>());
+            }
+            acc0 = reduce(reduce(acc0, acc1), reduce(acc2, acc3));
+        }
+        for (; count >= V::Size; count -= V::Size) {
+            acc0 = reduce(acc0, next.template get<V>());
+        }
+        const decltype(acc0) &r = acc0;
+        for (std::size_t i = 0; i < r.size(); ++i) {
+            init = reduce(init, r[i]);
+        }
+    }
+    for (; count > 0; --count) {
+        const auto r = next.template get<V1>();
+        init = reduce(init, r[0]);
+    }
+    return init;
+}
+// }}}
+// UnaryTransformNext / BinaryTransformNext {{{
+template <class InputIt, class UnaryTransformOp> struct UnaryTransformNext {
+    InputIt &first;
+    UnaryTransformOp &transform;
+
+    template <class V>
+    Vc_INTRINSIC auto get() -> decltype(transform(std::declval<V &>()))
+    {
+        V v;
+        load_interleaved(v, std::addressof(*first));
+        first += V::Size;
+        return transform(v);
+    }
+};
+
+template <class InputIt1, class InputIt2, class BinaryTransformOp>
+struct BinaryTransformNext {
+    typedef typename std::iterator_traits<InputIt2>::value_type ValueType2;
+    InputIt1 &first1;
+    InputIt2 &first2;
+    BinaryTransformOp &transform;
+
+    template <class V, class W = simdize<ValueType2, V::Size>>
+    Vc_INTRINSIC auto get()
+        -> decltype(transform(std::declval<V &>(), std::declval<W &>()))
+    {
+        V a;
+        W b;
+        load_interleaved(a, std::addressof(*first1));
+        load_interleaved(b, std::addressof(*first2));
+        first1 += V::Size;
+        first2 += V::Size;
+        return transform(a, b);
+    }
+};
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::transform_reduce` algorithm.
+ *
+ * Applies \p transform to vectors loaded from the range from \p first to \p last and
+ * combines the results with \p reduce into vector accumulators. The entries of the
+ * accumulators are combined with \p init only once, after the complete range was
+ * processed. Thus, \p reduce is called with two vectors and with two scalars and must be
+ * associative and commutative (e.g. `std::plus<>()`).
+ *
+ * \code
+ * float sumOfSquares = Vc::simd_transform_reduce(
+ *     x.begin(), x.end(), 0.f, std::plus<>(), [](auto v) { return v * v; });
+ * \endcode
+ *
+ * \param first Start of the range. The range must be contiguous in memory.
+ * \param last End of the range.
+ * \param init The initial value of the reduction.
+ * \param reduce The binary reduction operation.
+ * \param transform The unary operation applied to the loaded vectors. It must return a
+ *                  Vc vector type.
+ */
+template <class InputIt, class T, class BinaryReductionOp, class UnaryTransformOp,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline T simd_transform_reduce(InputIt first, InputIt last, T init,
+                               BinaryReductionOp reduce, UnaryTransformOp transform)
+{
+    typedef simdize<ValueType> V;
+    typedef simdize<ValueType, 1> V1;
+    return Detail::simd_transform_reduce_impl<V, V1>(
+        std::distance(first, last), init, reduce,
+        Detail::UnaryTransformNext<InputIt, UnaryTransformOp>{first, transform});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the binary `std::transform_reduce` algorithm (the generalization of
+ * `std::inner_product`).
+ *
+ * \code
+ * float dot = Vc::simd_transform_reduce(x.begin(), x.end(), y.begin(), 0.f,
+ *                                       std::plus<>(), std::multiplies<>());
+ * \endcode
+ */
+template <class InputIt1, class InputIt2, class T, class BinaryReductionOp,
+          class BinaryTransformOp,
+          class ValueType1 = typename std::iterator_traits<InputIt1>::value_type>
+inline T simd_transform_reduce(InputIt1 first1, InputIt1 last1, InputIt2 first2, T init,
+                               BinaryReductionOp reduce, BinaryTransformOp transform)
+{
+    typedef simdize<ValueType1> V;
+    typedef simdize<ValueType1, 1> V1;
+    return Detail::simd_transform_reduce_impl<V, V1>(
+        std::distance(first1, last1), init, reduce,
+        Detail::BinaryTransformNext<InputIt1, InputIt2, BinaryTransformOp>{
+            first1, first2, transform});
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace Detail
+{
+// simd_scan {{{
+/**\internal
+ * Calls `visit(v, k, offset)` for vectors \p v loaded from the range [\p mem, \p mem +
+ * \p count) until \p visit returns \c true. Lane 0 of \p v is `mem[offset]` and \p k
+ * selects the lanes that are inside the range and were not passed to \p visit before.
+ *
+ * The first vector is loaded unaligned from \p mem, with \p k restricted to the lanes
+ * before the next aligned address. The following vectors are loaded from aligned
+ * addresses (if the element type permits) and the last vector is loaded unaligned from
+ * `mem + count - V::Size`, overlapping with the previous one. Thus, no memory outside the
+ * range is read. Ranges shorter than `V::Size` use a masked load.
+ *
+ * \return \c true if \p visit returned \c true.
+ */
+template <class V, class T, class Visitor>
+inline bool simd_scan(const T *mem, std::size_t count, Visitor &&visit)
+{
+    typedef typename V::Mask M;
+    typedef typename V::EntryType U;
+    const M full(true);
+    if (count < V::Size) {
+        if (count == 0) {
+            return false;
+        }
+        const M k = V(Vc::IndexesFromZero) < V(U(count));
+        V v = V::Zero();
+        v.gather(mem, typename V::IndexType(Vc::IndexesFromZero), k);
+        return visit(v, k, std::size_t(0));
+    }
+
+    const auto addr = reinterpret_cast<std::uintptr_t>(mem);
+    const bool alignable = addr % sizeof(T) == 0;
+    std::size_t offset = V::Size;
+    if (alignable) {
+        offset -= (addr % V::MemoryAlignment) / sizeof(T);
+    }
+    if (visit(V(mem, Vc::Unaligned), V(Vc::IndexesFromZero) < V(U(offset)), std::size_t(0))) {
+        return true;
+    }
+    if (alignable) {
+        for (; offset + V::Size <= count; offset += V::Size) {
+            if (visit(V(mem + offset, Vc::Aligned), full, offset)) {
+                return true;
+            }
+        }
+    } else {
+        for (; offset + V::Size <= count; offset += V::Size) {
+            if (visit(V(mem + offset, Vc::Unaligned), full, offset)) {
+                return true;
+            }
+        }
+    }
+    if (offset < count) {
+        const std::size_t start = count - V::Size;
+        return visit(V(mem + start, Vc::Unaligned),
+                     V(Vc::IndexesFromZero) >= V(U(offset - start)), start);
+    }
+    return false;
+}
+// }}}
+// simd_scan_load {{{
+/**\internal
+ * Loads the vector that corresponds to the vector passed to the visitor of simd_scan at
+ * \p offset, but from the range [\p mem, \p mem + \p count).
+ */
+template <class V, class T>
+Vc_INTRINSIC V simd_scan_load(const T *mem, std::size_t offset, std::size_t count)
+{
+    if (offset + V::Size <= count) {
+        return V(mem + offset, Vc::Unaligned);
+    }
+    typedef typename V::EntryType U;
+    V v = V::Zero();
+    v.gather(mem + offset, typename V::IndexType(Vc::IndexesFromZero),
+             V(Vc::IndexesFromZero) < V(U(count - offset)));
+    return v;
+}
+// }}}
+// FindIfVisitor / CountIfVisitor {{{
+template <class UnaryPredicate> struct FindIfVisitor {
+    UnaryPredicate &pred;
+    std::size_t &found;
+
+    template <class V, class M>
+    Vc_INTRINSIC bool operator()(const V &v, const M &k, std::size_t offset)
+    {
+        const M match = k && static_cast<M>(pred(v));
+        if (any_of(match)) {
+            found = offset + match.firstOne();
+            return true;
+        }
+        return false;
+    }
+};
+
+template <class UnaryPredicate> struct CountIfVisitor {
+    UnaryPredicate &pred;
+    std::size_t &n;
+
+    template <class V, class M>
+    Vc_INTRINSIC bool operator()(const V &v, const M &k, std::size_t)
+    {
+        n += (k && static_cast<M>(pred(v))).count();
+        return false;
+    }
+};
+// }}}
+// simd_find_if_index {{{
+template <class V, class T, class UnaryPredicate>
+inline std::size_t simd_find_if_index(const T *mem, std::size_t count,
+                                      UnaryPredicate &pred)
+{
+    std::size_t found = count;
+    simd_scan<V>(mem, count, FindIfVisitor<UnaryPredicate>{pred, found});
+    return found;
+}
+// }}}
+// EqualTo / NotPredicate {{{
+template <class T> struct EqualTo {
+    const T &value;
+    template <class V> Vc_INTRINSIC typename V::Mask operator()(const V &v) const
+    {
+        return v == V(value);
+    }
+};
+
+template <class UnaryPredicate> struct NotPredicate {
+    UnaryPredicate &pred;
+    template <class V> Vc_INTRINSIC typename V::Mask operator()(const V &v) const
+    {
+        return !static_cast<typename V::Mask>(pred(v));
+    }
+};
+// }}}
+// MismatchVisitor {{{
+template <class T2, class BinaryPredicate> struct MismatchVisitor {
+    const T2 *mem2;
+    std::size_t count;
+    BinaryPredicate &pred;
+    std::size_t &found;
+
+    template <class V, class M>
+    Vc_INTRINSIC bool operator()(const V &v, const M &k, std::size_t offset)
+    {
+        typedef simdize<T2, V::Size> W;
+        const M mismatch =
+            k && !static_cast<M>(pred(v, simd_scan_load<W>(mem2, offset, count)));
+        if (any_of(mismatch)) {
+            found = offset + mismatch.firstOne();
+            return true;
+        }
+        return false;
+    }
+};
+
+struct EqualVectors {
+    template <class V, class W>
+    Vc_INTRINSIC auto operator()(const V &a, const W &b) const -> decltype(a == b)
+    {
+        return a == b;
+    }
+};
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find_if` algorithm.
+ *
+ * Calls \p pred with `Vc::simdize<` *iterator value type* `>` vectors loaded from the
+ * range and returns the iterator to the first element for which the returned mask is
+ * set. The search stops at the first vector with a match. The range is read only up to
+ * its ends: the first and last vectors are loaded unaligned and the vectors in between
+ * aligned.
+ *
+ * \code
+ * auto it = Vc::simd_find_if(data.begin(), data.end(), [](auto v) { return v < 0; });
+ * \endcode
+ *
+ * \param first Start of the range. The range must be contiguous in memory and its value
+ *              type must be arithmetic.
+ * \param last End of the range.
+ * \param pred A predicate returning a mask for a vector argument. It is only ever
+ *             called with the full vector type. Entries outside the range may be
+ *             passed to \p pred, but are never considered for the result.
+ *
+ * \return The iterator to the first matching element or \p last.
+ */
+template <class InputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline InputIt simd_find_if(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_find_if requires a range of arithmetic values");
+    if (first == last) {
+        return last;
+    }
+    return first + Detail::simd_find_if_index<simdize<ValueType>>(
+                       std::addressof(*first), std::distance(first, last), pred);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::find` algorithm. See simd_find_if.
+ */
+template <class InputIt, class T>
+inline InputIt simd_find(InputIt first, InputIt last, const T &value)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    const ValueType v = value;
+    return simd_find_if(first, last, Detail::EqualTo<ValueType>{v});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count_if` algorithm. See simd_find_if for the requirements
+ * on the range and on \p pred.
+ */
+template <class InputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count_if(
+    InputIt first, InputIt last, UnaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_count_if requires a range of arithmetic values");
+    std::size_t n = 0;
+    if (first != last) {
+        Detail::simd_scan<simdize<ValueType>>(std::addressof(*first),
+                                              std::distance(first, last),
+                                              Detail::CountIfVisitor<UnaryPredicate>{pred, n});
+    }
+    return n;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::count` algorithm. See simd_find_if.
+ */
+template <class InputIt, class T>
+inline typename std::iterator_traits<InputIt>::difference_type simd_count(InputIt first,
+                                                                          InputIt last,
+                                                                          const T &value)
+{
+    typedef typename std::iterator_traits<InputIt>::value_type ValueType;
+    const ValueType v = value;
+    return simd_count_if(first, last, Detail::EqualTo<ValueType>{v});
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::any_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_any_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, pred) != last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::none_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_none_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, pred) == last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::all_of` algorithm. See simd_find_if.
+ */
+template <class InputIt, class UnaryPredicate>
+inline bool simd_all_of(InputIt first, InputIt last, UnaryPredicate pred)
+{
+    return simd_find_if(first, last, Detail::NotPredicate<UnaryPredicate>{pred}) == last;
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::mismatch` algorithm.
+ *
+ * Compares vectors loaded from the range from \p first1 to \p last1 with the
+ * corresponding vectors from the range starting at \p first2, using \p pred, and returns
+ * the iterators to the first pair of elements for which the mask returned from \p pred is
+ * not set. Both ranges must be contiguous in memory and hold arithmetic values.
+ *
+ * \return The pair of iterators to the first mismatching elements, or \p last1 and the
+ *         corresponding iterator into the second range.
+ */
+template <class InputIt1, class InputIt2, class BinaryPredicate,
+          class ValueType1 = typename std::iterator_traits<InputIt1>::value_type,
+          class ValueType2 = typename std::iterator_traits<InputIt2>::value_type>
+inline std::pair<InputIt1, InputIt2> simd_mismatch(InputIt1 first1, InputIt1 last1,
+                                                   InputIt2 first2, BinaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType1>::value &&
+                      std::is_arithmetic<ValueType2>::value,
+                  "simd_mismatch requires ranges of arithmetic values");
+    if (first1 == last1) {
+        return {first1, first2};
+    }
+    const std::size_t count = std::distance(first1, last1);
+    std::size_t found = count;
+    Detail::simd_scan<simdize<ValueType1>>(
+        std::addressof(*first1), count,
+        Detail::MismatchVisitor<ValueType2, BinaryPredicate>{std::addressof(*first2), count,
+                                                             pred, found});
+    return {first1 + found, first2 + found};
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::mismatch` algorithm, comparing with `operator==`.
+ */
+template <class InputIt1, class InputIt2>
+inline std::pair<InputIt1, InputIt2> simd_mismatch(InputIt1 first1, InputIt1 last1,
+                                                   InputIt2 first2)
+{
+    return simd_mismatch(first1, last1, first2, Detail::EqualVectors());
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Searches for `V::Size` different values at once.
+ *
+ * Every element of the range is compared against all entries of \p values. The search
+ * stops as soon as every value was found.
+ *
+ * \param first Start of the range. Any forward iterator works.
+ * \param last End of the range.
+ * \param values The values to search for.
+ *
+ * \return An array where the i-th entry is the iterator to the first element equal to
+ *         `values[i]`, or \p last if there is no such element.
+ */
+template <class InputIt, class V>
+inline std::array<InputIt, V::Size> simd_find_parallel(InputIt first, InputIt last,
+                                                       const V &values)
+{
+    std::array<InputIt, V::Size> matches;
+    for (auto &x : matches) {
+        x = last;
+    }
+    typename V::Mask found(false);
+    for (; first != last; ++first) {
+        const auto mask = V(*first) == values && !found;
+        if (any_of(mask)) {
+            found |= mask;
+            for (std::size_t i : where(mask)) {
+                matches[i] = first;
+            }
+            if (all_of(found)) {
+                break;
+            }
+        }
+    }
+    return matches;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace Detail
+{
+// simd_sort_merge {{{
+/**\internal
+ * Merges the sorted vectors \p a and \p b such that afterwards \p a holds the smallest
+ * and \p b the largest `V::Size` entries, both sorted. This is the bitonic merge also used
+ * in SimdArray::sorted: the minimum and maximum of \p a and reversed \p b are bitonic
+ * sequences which the register sorting network sorts.
+ */
+template <class V> Vc_INTRINSIC void simd_sort_merge(V &a, V &b)
+{
+    const V r = b.reversed();
+    b = Vc::max(a, r).sorted();
+    a = Vc::min(a, r).sorted();
+}
+// }}}
+// simd_sort_merge_runs {{{
+/**\internal
+ * Merges the sorted runs [\p x, \p x + \p nx) and [\p y, \p y + \p ny) into \p out. All
+ * pointers must be aligned and \p nx and \p ny must be non-zero multiples of `V::Size`.
+ *
+ * The merge keeps the largest `V::Size` entries seen so far in a register and repeatedly
+ * merges it with the next vector from the run with the smaller head.
+ */
+template <class V, class T>
+inline void simd_sort_merge_runs(const T *x, std::size_t nx, const T *y, std::size_t ny,
+                                 T *out)
+{
+    const T *const xend = x + nx;
+    const T *const yend = y + ny;
+    V lo(x, Vc::Aligned);
+    V hi(y, Vc::Aligned);
+    x += V::Size;
+    y += V::Size;
+    simd_sort_merge(lo, hi);
+    lo.store(out, Vc::Aligned);
+    out += V::Size;
+    while (x != xend && y != yend) {
+        if (*x < *y) {
+            lo.load(x, Vc::Aligned);
+            x += V::Size;
+        } else {
+            lo.load(y, Vc::Aligned);
+            y += V::Size;
+        }
+        simd_sort_merge(lo, hi);
+        lo.store(out, Vc::Aligned);
+        out += V::Size;
+    }
+    if (y != yend) {
+        x = y;
+    }
+    for (const T *const end = x == y ? yend : xend; x != end; x += V::Size) {
+        lo.load(x, Vc::Aligned);
+        simd_sort_merge(lo, hi);
+        lo.store(out, Vc::Aligned);
+        out += V::Size;
+    }
+    hi.store(out, Vc::Aligned);
+}
+// }}}
+// simd_sort_block4 {{{
+/**\internal
+ * Sorts the `4 * V::Size` entries at \p in and stores the first \p nvectors vectors of the
+ * result to the aligned address \p out. This is the 4-input sorting network where every
+ * comparator is a simd_sort_merge.
+ */
+template <class V, class T>
+Vc_INTRINSIC void simd_sort_block4(const T *in, T *out, std::size_t nvectors)
+{
+    V v[4] = {V(in, Vc::Unaligned).sorted(), V(in + V::Size, Vc::Unaligned).sorted(),
+              V(in + 2 * V::Size, Vc::Unaligned).sorted(),
+              V(in + 3 * V::Size, Vc::Unaligned).sorted()};
+    simd_sort_merge(v[0], v[1]);
+    simd_sort_merge(v[2], v[3]);
+    simd_sort_merge(v[0], v[2]);
+    simd_sort_merge(v[1], v[3]);
+    simd_sort_merge(v[1], v[2]);
+    for (std::size_t k = 0; k < nvectors; ++k) {
+        v[k].store(out + k * V::Size, Vc::Aligned);
+    }
+}
+// }}}
+// simd_sort_padding {{{
+/**\internal
+ * The value used to pad the last vector. It sorts behind all other values.
+ */
+template <class T> constexpr T simd_sort_padding()
+{
+    return std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                : std::numeric_limits<T>::max();
+}
+// }}}
+// simd_sort_impl {{{
+template <class V, class T> inline void simd_sort_impl(T *mem, std::size_t n)
+{
+    constexpr std::size_t Size = V::Size;
+    const std::size_t padded = (n + Size - 1) / Size * Size;
+    std::vector<T, Allocator<T>> buffer(2 * padded);
+    T *src = buffer.data();
+    T *dst = src + padded;
+
+    // sort runs of four vectors; the last run is padded
+    std::size_t i = 0;
+    for (; i + 4 * Size <= n; i += 4 * Size) {
+        simd_sort_block4<V>(mem + i, src + i, 4);
+    }
+    if (i < n) {
+        T tmp[4 * Size];
+        std::fill(std::copy(mem + i, mem + n, &tmp[0]), &tmp[4 * Size],
+                  simd_sort_padding<T>());
+        simd_sort_block4<V>(&tmp[0], src + i, (padded - i) / Size);
+    }
+
+    // bottom-up merge passes
+    for (std::size_t width = 4 * Size; width < padded; width *= 2) {
+        for (std::size_t first = 0; first < padded; first += 2 * width) {
+            const std::size_t mid = std::min(first + width, padded);
+            const std::size_t last = std::min(first + 2 * width, padded);
+            if (mid == last) {
+                std::copy(src + first, src + last, dst + first);
+            } else {
+                simd_sort_merge_runs<V>(src + first, mid - first, src + mid, last - mid,
+                                        dst + first);
+            }
+        }
+        std::swap(src, dst);
+    }
+    std::copy(src, src + n, mem);
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Sorts the range from \p first to \p last in ascending order.
+ *
+ * This is a vectorized merge sort: every vector is sorted with the register sorting
+ * network of Vector::sorted(), runs of four vectors are sorted in registers, and sorted
+ * runs are merged two registers at a time using bitonic merges. The merge passes use a
+ * temporary buffer of twice the range size.
+ * Ranges shorter than 256 vectors are sorted with `std::sort`, which is faster for
+ * them.
+ *
+ * \param first Start of the range. The range must be contiguous in memory and the value
+ *              type must be one of \c float, \c double, \c int, \c uint, \c short or
+ *              \c ushort.
+ * \param last End of the range.
+ *
+ * \note Like `std::sort`, the order is unspecified if the range contains NaNs.
+ */
+template <class RandomIt> inline void simd_sort(RandomIt first, RandomIt last)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value ||
+                      std::is_same<T, int>::value || std::is_same<T, uint>::value ||
+                      std::is_same<T, short>::value || std::is_same<T, ushort>::value,
+                  "simd_sort supports float, double, int, uint, short, and ushort");
+    typedef Vector<T> V;
+    const std::size_t n = std::distance(first, last);
+    if (V::Size == 1 || n < 256 * V::Size) {
+        std::sort(first, last);
+    } else {
+        Detail::simd_sort_impl<V>(std::addressof(*first), n);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+namespace Detail
+{
+// ArgsortPayload {{{
+/**\internal
+ * The vector type that carries the indexes through simd_argsort. For \c double the
+ * indexes are carried in a \c double vector, which needs no conversions between the
+ * masks of different register sizes.
+ */
+template <class V> struct ArgsortPayload {
+    typedef typename V::IndexType type;
+};
+template <class Abi> struct ArgsortPayload<Vector<double, Abi>> {
+    typedef Vector<double, Abi> type;
+};
+// }}}
+// simd_argsort_merge {{{
+/**\internal
+ * The key/index variant of simd_sort_merge.
+ */
+template <class V, class I>
+Vc_INTRINSIC void simd_argsort_merge(V &a, I &ia, V &b, I &ib)
+{
+    const V r = b.reversed();
+    const I ir = ib.reversed();
+    const typename V::Mask takeR = r < a;
+    const typename I::Mask takeRI = simd_cast<typename I::Mask>(takeR);
+    b = iif(takeR, a, r);
+    ib = iif(takeRI, ia, ir);
+    a = iif(takeR, r, a);
+    ia = iif(takeRI, ir, ia);
+    bitonic_merge_key_value(a, ia);
+    bitonic_merge_key_value(b, ib);
+}
+// }}}
+// simd_argsort_merge_runs {{{
+/**\internal
+ * The key/index variant of simd_sort_merge_runs.
+ */
+template <class V, class I, class T, class IT>
+inline void simd_argsort_merge_runs(const T *x, const IT *ix, std::size_t nx, const T *y,
+                                    const IT *iy, std::size_t ny, T *out, IT *iout)
+{
+    const T *const xend = x + nx;
+    const T *const yend = y + ny;
+    V lo(x, Vc::Aligned);
+    I ilo(ix, Vc::Aligned);
+    V hi(y, Vc::Aligned);
+    I ihi(iy, Vc::Aligned);
+    x += V::Size;
+    ix += V::Size;
+    y += V::Size;
+    iy += V::Size;
+    simd_argsort_merge(lo, ilo, hi, ihi);
+    lo.store(out, Vc::Aligned);
+    ilo.store(iout, Vc::Aligned);
+    out += V::Size;
+    iout += V::Size;
+    while (x != xend && y != yend) {
+        if (*x < *y) {
+            lo.load(x, Vc::Aligned);
+            ilo.load(ix, Vc::Aligned);
+            x += V::Size;
+            ix += V::Size;
+        } else {
+            lo.load(y, Vc::Aligned);
+            ilo.load(iy, Vc::Aligned);
+            y += V::Size;
+            iy += V::Size;
+        }
+        simd_argsort_merge(lo, ilo, hi, ihi);
+        lo.store(out, Vc::Aligned);
+        ilo.store(iout, Vc::Aligned);
+        out += V::Size;
+        iout += V::Size;
+    }
+    const T *end = xend;
+    if (y != yend) {
+        x = y;
+        ix = iy;
+        end = yend;
+    }
+    for (; x != end; x += V::Size, ix += V::Size) {
+        lo.load(x, Vc::Aligned);
+        ilo.load(ix, Vc::Aligned);
+        simd_argsort_merge(lo, ilo, hi, ihi);
+        lo.store(out, Vc::Aligned);
+        ilo.store(iout, Vc::Aligned);
+        out += V::Size;
+        iout += V::Size;
+    }
+    hi.store(out, Vc::Aligned);
+    ihi.store(iout, Vc::Aligned);
+}
+// }}}
+// simd_argsort_block4 {{{
+/**\internal
+ * The key/index variant of simd_sort_block4. The indexes start at \p first.
+ */
+template <class V, class I, class T, class IT>
+Vc_INTRINSIC void simd_argsort_block4(const T *in, IT first, T *out, IT *iout,
+                                      std::size_t nvectors)
+{
+    V v[4];
+    I i[4];
+    for (int k = 0; k < 4; ++k) {
+        v[k] = V(in + k * V::Size, Vc::Unaligned);
+        i[k] = I(Vc::IndexesFromZero) + I(first + IT(k * V::Size));
+        sort_key_value(v[k], i[k]);
+    }
+    simd_argsort_merge(v[0], i[0], v[1], i[1]);
+    simd_argsort_merge(v[2], i[2], v[3], i[3]);
+    simd_argsort_merge(v[0], i[0], v[2], i[2]);
+    simd_argsort_merge(v[1], i[1], v[3], i[3]);
+    simd_argsort_merge(v[1], i[1], v[2], i[2]);
+    for (std::size_t k = 0; k < nvectors; ++k) {
+        v[k].store(out + k * V::Size, Vc::Aligned);
+        i[k].store(iout + k * V::Size, Vc::Aligned);
+    }
+}
+// }}}
+// simd_argsort_impl {{{
+template <class V, class T, class OutputIt>
+inline OutputIt simd_argsort_impl(const T *mem, std::size_t n, OutputIt d_first)
+{
+    typedef typename ArgsortPayload<V>::type I;
+    typedef typename I::EntryType IT;
+    constexpr std::size_t Size = V::Size;
+    const std::size_t padded = (n + Size - 1) / Size * Size;
+    std::vector<T, Allocator<T>> buffer(2 * padded);
+    std::vector<IT, Allocator<IT>> ibuffer(2 * padded);
+    T *src = buffer.data();
+    T *dst = src + padded;
+    IT *isrc = ibuffer.data();
+    IT *idst = isrc + padded;
+
+    // sort runs of four vectors; the last run is padded
+    std::size_t i = 0;
+    for (; i + 4 * Size <= n; i += 4 * Size) {
+        simd_argsort_block4<V, I>(mem + i, IT(i), src + i, isrc + i, 4);
+    }
+    if (i < n) {
+        T tmp[4 * Size];
+        std::fill(std::copy(mem + i, mem + n, &tmp[0]), &tmp[4 * Size],
+                  simd_sort_padding<T>());
+        simd_argsort_block4<V, I>(&tmp[0], IT(i), src + i, isrc + i, (padded - i) / Size);
+    }
+
+    // bottom-up merge passes
+    for (std::size_t width = 4 * Size; width < padded; width *= 2) {
+        for (std::size_t first = 0; first < padded; first += 2 * width) {
+            const std::size_t mid = std::min(first + width, padded);
+            const std::size_t last = std::min(first + 2 * width, padded);
+            if (mid == last) {
+                std::copy(src + first, src + last, dst + first);
+                std::copy(isrc + first, isrc + last, idst + first);
+            } else {
+                simd_argsort_merge_runs<V, I>(src + first, isrc + first, mid - first,
+                                           src + mid, isrc + mid, last - mid, dst + first,
+                                           idst + first);
+            }
+        }
+        std::swap(src, dst);
+        std::swap(isrc, idst);
+    }
+
+    // The padding entries sort last, but may be interleaved with entries of equal value.
+    std::size_t k = padded;
+    while (k > 0 && src[k - 1] == simd_sort_padding<T>()) {
+        --k;
+    }
+    for (std::size_t j = 0; j < k; ++j) {
+        *d_first++ = int(isrc[j]);
+    }
+    for (; k < padded; ++k) {
+        if (std::size_t(isrc[k]) < n) {
+            *d_first++ = int(isrc[k]);
+        }
+    }
+    return d_first;
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Writes the indexes that sort the range from \p first to \p last in ascending order to
+ * \p d_first, i.e. `first[d_first[0]]` is the smallest element.
+ *
+ * This is the key/index variant of simd_sort: the indexes are carried in a
+ * `V::IndexType` register through the same sorting networks and merges. The order of
+ * equal elements is unspecified.
+ *
+ * \param first Start of the range. The same requirements as for simd_sort apply. The
+ *              range must have less than `2^31` elements.
+ * \param last End of the range.
+ * \param d_first Start of the output range of \c int indexes.
+ *
+ * \return The end of the output range.
+ */
+template <class RandomIt, class OutputIt>
+inline OutputIt simd_argsort(RandomIt first, RandomIt last, OutputIt d_first)
+{
+    typedef typename std::iterator_traits<RandomIt>::value_type T;
+    static_assert(std::is_same<T, float>::value || std::is_same<T, double>::value ||
+                      std::is_same<T, int>::value || std::is_same<T, uint>::value ||
+                      std::is_same<T, short>::value || std::is_same<T, ushort>::value,
+                  "simd_argsort supports float, double, int, uint, short, and ushort");
+    typedef Vector<T> V;
+    const std::size_t n = std::distance(first, last);
+    if (V::Size == 1 || n < 256 * V::Size) {
+        std::vector<int> index(n);
+        std::iota(index.begin(), index.end(), 0);
+        std::sort(index.begin(), index.end(),
+                  [&](int a, int b) { return first[a] < first[b]; });
+        return std::copy(index.begin(), index.end(), d_first);
+    }
+    return Detail::simd_argsort_impl<V>(std::addressof(*first), n, d_first);
+}
+
+namespace Detail
+{
+// simd_compact {{{
+/**\internal
+ * Stores the elements of [\p in, \p in + \p count) that satisfy \p pred contiguously to
+ * \p out and, if \p rejected is not \c nullptr, the others to \p rejected. The order of
+ * the elements is preserved. \p out may be equal to \p in.
+ *
+ * \return The number of elements stored to \p out.
+ */
+template <class V, class T, class UnaryPredicate>
+inline std::size_t simd_compact(const T *in, std::size_t count, T *out, T *rejected,
+                                UnaryPredicate &pred)
+{
+    typedef typename V::Mask M;
+    typedef typename V::EntryType U;
+    std::size_t m = 0;
+    std::size_t r = 0;
+    std::size_t i = 0;
+    for (; i + V::Size <= count; i += V::Size) {
+        const V v(in + i, Vc::Unaligned);
+        const M k = static_cast<M>(pred(v));
+        if (rejected) {
+            r += compress_store(rejected + r, v, !k);
+        }
+        m += compress_store(out + m, v, k);
+    }
+    if (i < count) {
+        const M valid = V(Vc::IndexesFromZero) < V(U(count - i));
+        V v = V::Zero();
+        v.gather(in + i, typename V::IndexType(Vc::IndexesFromZero), valid);
+        const M k = valid && static_cast<M>(pred(v));
+        if (rejected) {
+            compress_store(rejected + r, v, valid && !k);
+        }
+        m += compress_store(out + m, v, k);
+    }
+    return m;
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::copy_if` algorithm.
+ *
+ * Calls \p pred with `Vc::simdize<` *iterator value type* `>` vectors loaded from the
+ * range and stores the selected entries of every vector contiguously to the output with
+ * Vc::compress_store.
+ *
+ * \param first Start of the range. The range must be contiguous in memory and its value
+ *              type must be arithmetic.
+ * \param last End of the range.
+ * \param d_first Start of the output range. It must be contiguous in memory and must
+ *                not overlap with the input range.
+ * \param pred A predicate returning a mask for a vector argument. Entries outside the
+ *             range may be passed to \p pred, but are never copied.
+ *
+ * \return The end of the output range.
+ */
+template <class InputIt, class OutputIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline OutputIt simd_copy_if(InputIt first, InputIt last, OutputIt d_first,
+                             UnaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_copy_if requires a range of arithmetic values");
+    if (first == last) {
+        return d_first;
+    }
+    return d_first + Detail::simd_compact<simdize<ValueType>>(
+                         std::addressof(*first), std::distance(first, last),
+                         std::addressof(*d_first), static_cast<ValueType *>(nullptr), pred);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::remove_if` algorithm. The same requirements as for
+ * simd_copy_if apply. The order of the remaining elements is preserved.
+ *
+ * \return The new end of the range.
+ */
+template <class ForwardIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<ForwardIt>::value_type>
+inline ForwardIt simd_remove_if(ForwardIt first, ForwardIt last, UnaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_remove_if requires a range of arithmetic values");
+    if (first == last) {
+        return last;
+    }
+    ValueType *mem = std::addressof(*first);
+    Detail::NotPredicate<UnaryPredicate> keep{pred};
+    return first + Detail::simd_compact<simdize<ValueType>>(
+                       mem, std::distance(first, last), mem,
+                       static_cast<ValueType *>(nullptr), keep);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile algorithms.h <Vc/Vc>
+ *
+ * Vc variant of the `std::stable_partition` algorithm: moves the elements for which
+ * \p pred returns \c true to the front of the range, preserving the relative order in
+ * both groups. The same requirements as for simd_copy_if apply. The rejected elements
+ * are collected in a temporary buffer.
+ *
+ * \return The iterator to the first element of the second group.
+ */
+template <class BidirIt, class UnaryPredicate,
+          class ValueType = typename std::iterator_traits<BidirIt>::value_type>
+inline BidirIt simd_partition(BidirIt first, BidirIt last, UnaryPredicate pred)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "simd_partition requires a range of arithmetic values");
+    if (first == last) {
+        return last;
+    }
+    const std::size_t n = std::distance(first, last);
+    std::vector<ValueType> rejected(n);
+    ValueType *mem = std::addressof(*first);
+    const std::size_t m =
+        Detail::simd_compact<simdize<ValueType>>(mem, n, mem, rejected.data(), pred);
+    std::copy(rejected.begin(), rejected.begin() + (n - m), mem + m);
+    return first + m;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/**
+ * \ingroup Utilities
+ *
+ * Type of the Vc::par policy object.
+ */
+struct ParallelTag {};
+
+/**
+ * \ingroup Utilities
+ *
+ * Execution policy object for simd_for_each and simd_for_each_n that distributes the
+ * range over all hardware threads.
+ *
+ * The range is cut into chunks whose boundaries fall on cache line (and thus `V::Size`)
+ * multiples, so that every chunk executes the aligned vector loop of the
+ * Vc::MaskedEpilogue variant. The chunks are processed by a work-stealing thread pool
+ * that is created on first use.
+ *
+ * \code
+ * Vc::simd_for_each(Vc::par, data.begin(), data.end(), [&](auto &v) {
+ *   v = Vc::sqrt(v);
+ * });
+ * \endcode
+ *
+ * \note The functor is called concurrently from several threads (with distinct
+ * arguments). It is passed by reference and not copied, so any state it modifies must be
+ * synchronized by the caller. If a call throws, the first exception is rethrown from
+ * the algorithm after all threads stopped.
+ */
+constexpr ParallelTag par = {};
+
+namespace Detail
+{
+// simd_for_each_parallel {{{
+template <class ValueType, class T, class UnaryFunction>
+inline void simd_for_each_parallel(T *mem, std::size_t count, UnaryFunction &f)
+{
+    typedef simdize<ValueType> V;
+    typedef Traits::is_functor_argument_immutable<UnaryFunction, V> Immutable;
+    typedef std::is_arithmetic<ValueType> IsArithmetic;
+    constexpr std::size_t CacheLineSize = 64;
+    // Chunks below this size do not amortize the cost of distributing them.
+    constexpr std::size_t MinChunkBytes = 16 * 1024;
+    constexpr std::size_t ChunksPerThread = 8;
+    constexpr std::size_t LineElements =
+        IsArithmetic::value ? CacheLineSize / sizeof(ValueType) : 1;
+    constexpr std::size_t Block = LineElements > V::Size ? LineElements : V::Size;
+
+    // the head covers the elements up to the first cache line boundary
+    std::size_t head = 0;
+    const auto addr = reinterpret_cast<std::uintptr_t>(mem);
+    if (IsArithmetic::value && addr % sizeof(ValueType) == 0) {
+        head = std::min(count, (CacheLineSize - addr % CacheLineSize) % CacheLineSize /
+                                   sizeof(ValueType));
+    }
+
+    Common::ThreadPool &pool = Common::ThreadPool::global();
+    const std::size_t body = count - head;
+    const std::size_t minChunk =
+        (MinChunkBytes / sizeof(ValueType) + Block - 1) / Block * Block;
+    const std::size_t chunk = std::max(
+        minChunk, (body / (pool.size() * ChunksPerThread) + Block - 1) / Block * Block);
+    const std::size_t chunks = (body + chunk - 1) / chunk;
+    if (chunks < 2) {
+        simd_for_each_masked<ValueType>(mem, count, f, Immutable(), IsArithmetic());
+        return;
+    }
+
+    T *const bodyStart = mem + head;
+    pool.parallel_for(chunks + 1, [&](std::size_t i) {
+        if (i == 0) {
+            if (head > 0) {
+                simd_for_each_masked<ValueType>(mem, head, f, Immutable(),
+                                                IsArithmetic());
+            }
+        } else {
+            const std::size_t first = (i - 1) * chunk;
+            simd_for_each_masked<ValueType>(bodyStart + first,
+                                            std::min(chunk, body - first), f,
+                                            Immutable(), IsArithmetic());
+        }
+    });
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Parallel variant of simd_for_each. See Vc::par.
+ *
+ * \param first Start of the range. The range must be contiguous in memory.
+ * \param last End of the range.
+ * \param f The functor to call with vector objects. It is called concurrently.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each(ParallelTag, InputIt first, InputIt last,
+                                   UnaryFunction f)
+{
+    if (first != last) {
+        Detail::simd_for_each_parallel<ValueType>(std::addressof(*first),
+                                                  std::distance(first, last), f);
+    }
+    return std::move(f);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Parallel variant of simd_for_each_n. See Vc::par.
+ *
+ * \param first Start of the range. The range must be contiguous in memory.
+ * \param count The number of elements in the range.
+ * \param f The functor to call with vector objects. It is called concurrently.
+ */
+template <class InputIt, class UnaryFunction,
+          class ValueType = typename std::iterator_traits<InputIt>::value_type>
+inline UnaryFunction simd_for_each_n(ParallelTag, InputIt first, std::size_t count,
+                                     UnaryFunction f)
+{
+    if (count > 0) {
+        Detail::simd_for_each_parallel<ValueType>(std::addressof(*first), count, f);
+    }
+    return std::move(f);
+}
+
 }  // namespace Vc
 
 #endif // VC_COMMON_ALGORITHMS_H_
@@ -0,0 +1,451 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_ALLOCATIONPOLICY_H_
+#define VC_COMMON_ALLOCATIONPOLICY_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include "malloc.h"
+#include "threadpool.h"
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+namespace Detail
+{
+/**\internal
+ * The size of a (transparent or explicit) huge page on x86-64 Linux.
+ */
+constexpr std::size_t HugePageSize = std::size_t(2) << 20;
+
+// pageSize {{{1
+inline std::size_t pageSize()
+{
+#ifdef __linux__
+    static const std::size_t size = std::size_t(sysconf(_SC_PAGESIZE));
+    return size;
+#else
+    return 4096;
+#endif
+}
+
+// mappedSize {{{1
+/**\internal
+ * The number of Bytes actually mapped for a request of \p bytes. Requests of at least half
+ * a huge page are rounded up to whole huge pages, everything else to whole base pages.
+ * allocate and deallocate both derive the mapping from this function, so that deallocation
+ * only needs the size that was requested.
+ */
+inline std::size_t mappedSize(std::size_t bytes)
+{
+    const std::size_t granularity = bytes >= HugePageSize / 2 ? HugePageSize : pageSize();
+    return (bytes + granularity - 1) / granularity * granularity;
+}
+
+// mapPages {{{1
+/**\internal
+ * Maps anonymous memory of mappedSize(\p bytes) Bytes. Mappings of huge page size are
+ * aligned to HugePageSize and, if \p explicitHuge is \c true, first tried from the
+ * hugetlbfs pool (MAP_HUGETLB). If that pool is exhausted or not configured, the mapping
+ * falls back to regular pages marked with MADV_HUGEPAGE for transparent huge pages.
+ *
+ * A request of 0 Bytes maps a single base page, so that it yields a unique pointer like
+ * AlignedAllocation instead of failing (mmap rejects a length of 0).
+ *
+ * \returns \c nullptr on failure.
+ */
+inline void *mapPages(std::size_t bytes, bool explicitHuge)
+{
+#ifdef __linux__
+    if (bytes == 0) {
+        void *p = mmap(nullptr, pageSize(), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+    const std::size_t size = mappedSize(bytes);
+    if (size < HugePageSize) {
+        void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                       -1, 0);
+        return p == MAP_FAILED ? nullptr : p;
+    }
+#ifdef MAP_HUGETLB
+    if (explicitHuge) {
+        int flags = MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+        // request 2 MB pages explicitly: with a different default huge page size (e.g.
+        // 1 GB) the munmap length of unmapPages would not be a multiple of the page size
+        flags |= 21 << MAP_HUGE_SHIFT;
+#endif
+        void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+        if (p != MAP_FAILED) {
+            return p;
+        }
+    }
+#else
+    (void)explicitHuge;
+#endif
+    // over-allocate by one huge page and unmap head and tail to get a 2 MB aligned range
+    char *p = static_cast<char *>(mmap(nullptr, size + HugePageSize, PROT_READ | PROT_WRITE,
+                                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+    if (p == MAP_FAILED) {
+        return nullptr;
+    }
+    const std::size_t head =
+        (HugePageSize - reinterpret_cast<std::uintptr_t>(p) % HugePageSize) % HugePageSize;
+    if (head > 0) {
+        munmap(p, head);
+    }
+    if (head < HugePageSize) {
+        munmap(p + head + size, HugePageSize - head);
+    }
+    p += head;
+#ifdef MADV_HUGEPAGE
+    madvise(p, size, MADV_HUGEPAGE);
+#endif
+    return p;
+#else
+    (void)explicitHuge;
+    return aligned_malloc<4096>(mappedSize(bytes));
+#endif
+}
+
+// unmapPages {{{1
+inline void unmapPages(void *p, std::size_t bytes)
+{
+    if (p == nullptr) {
+        return;
+    }
+#ifdef __linux__
+    // mapPages maps a single base page for 0 Bytes
+    munmap(p, bytes == 0 ? pageSize() : mappedSize(bytes));
+#else
+    (void)bytes;
+    Common::free(p);
+#endif
+}
+
+// NumaPolicy {{{1
+/**\internal
+ * The memory policy modes of mbind(2). Declared here to avoid a dependency on libnuma or
+ * the kernel headers.
+ */
+enum class NumaPolicy : int { Preferred = 1, Bind = 2, Interleave = 3 };
+
+/**\internal
+ * Applies the NUMA memory policy \p mode for the nodes in \p nodeMask to the mapping at
+ * \p p. This must happen before the first touch of the pages. Failure (no NUMA support in
+ * the kernel, a node that does not exist, ...) is ignored: the memory stays usable, it is
+ * just placed by the default first-touch policy.
+ */
+inline void setNumaPolicy(void *p, std::size_t bytes, NumaPolicy mode,
+                          unsigned long nodeMask)
+{
+#if defined __linux__ && defined SYS_mbind
+    if (p != nullptr) {
+        // the kernel interprets maxnode as one past the number of valid bits
+        syscall(SYS_mbind, p, mappedSize(bytes), static_cast<int>(mode), &nodeMask,
+                sizeof(nodeMask) * 8 + 1, 0u);
+    }
+#else
+    (void)p;
+    (void)bytes;
+    (void)mode;
+    (void)nodeMask;
+#endif
+}
+
+// forEachTouchBlock {{{1
+/**\internal
+ * Splits the Byte range [\p begin, \p end) into one contiguous block per thread of the
+ * global ThreadPool and calls \p f(lo, hi) for block s on thread s
+ * (ThreadPool::parallel_for_static), so that with the default first-touch policy every
+ * block ends up on the NUMA node of the thread that writes it first.
+ *
+ * Ranges of at least half a huge page (the size from which mapPages uses huge pages) are
+ * cut at HugePageSize boundaries, everything else at page boundaries. The first write to
+ * a transparent or explicit huge page faults in all of it, so a huge page that straddled
+ * two blocks would land on whichever thread got there first.
+ */
+template <class F>
+inline void forEachTouchBlock(std::uintptr_t begin, std::uintptr_t end, F f)
+{
+    if (begin >= end) {
+        return;
+    }
+    const std::size_t granularity =
+        end - begin >= HugePageSize / 2 ? HugePageSize : pageSize();
+    const std::uintptr_t first = begin - begin % granularity;
+    const std::size_t units = (end - first + granularity - 1) / granularity;
+    ThreadPool &pool = ThreadPool::global();
+    const std::size_t blocks = std::min(units, pool.size());
+    pool.parallel_for_static(blocks, [&](std::size_t b) {
+        const std::uintptr_t lo = first + units * b / blocks * granularity;
+        const std::uintptr_t hi = first + units * (b + 1) / blocks * granularity;
+        f(std::max(lo, begin), std::min(hi, end));
+    });
+}
+
+// touchPages {{{1
+/**\internal
+ * Writes one Byte in every base page that overlaps [\p p, \p p + \p bytes), with the
+ * blocks of forEachTouchBlock.
+ */
+inline void touchPages(void *p, std::size_t bytes)
+{
+    if (p == nullptr || bytes == 0) {
+        return;
+    }
+    const std::size_t page = pageSize();
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(p);
+    volatile char *const mem = static_cast<char *>(p);
+    forEachTouchBlock(begin, begin + bytes, [&](std::uintptr_t lo, std::uintptr_t hi) {
+        // the first page of a block may start before lo, which must not be written to
+        for (std::uintptr_t a = lo; a < hi; a = a - a % page + page) {
+            mem[a - begin] = 0;
+        }
+    });
+}
+//}}}1
+}  // namespace Detail
+
+// AlignedAllocation {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * The allocation policy of Vc::malloc: memory from the C library, aligned as requested by
+ * \p A.
+ *
+ * An allocation policy is a stateless type with the two static member functions
+ * \code
+ * static void *allocate(std::size_t bytes);            // returns nullptr on failure
+ * static void deallocate(void *p, std::size_t bytes);  // bytes as passed to allocate
+ * \endcode
+ * Policies can be passed to Vc::malloc, Vc::Allocator and the dynamically sized
+ * Vc::Memory.
+ */
+template <Vc::MallocAlignment A> struct AlignedAllocation {
+    static void *allocate(std::size_t bytes) { return Common::malloc<A>(bytes); }
+    static void deallocate(void *p, std::size_t) { Common::free(p); }
+};
+
+// TransparentHugePages {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocation policy that maps memory directly from the kernel. Allocations of at least
+ * 1 MB are aligned on 2 MB and advised for transparent huge pages (madvise with
+ * MADV_HUGEPAGE), which reduces TLB misses when streaming over large arrays. Smaller
+ * allocations are page aligned.
+ *
+ * Every allocation is a system call; use this policy for few, large buffers.
+ * On systems other than Linux the memory is page-aligned memory from the C library.
+ */
+struct TransparentHugePages {
+    static void *allocate(std::size_t bytes) { return Detail::mapPages(bytes, false); }
+    static void deallocate(void *p, std::size_t bytes) { Detail::unmapPages(p, bytes); }
+};
+
+// ExplicitHugePages {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocation policy like TransparentHugePages, but allocations of at least 1 MB are first
+ * requested from the pool of explicitly reserved huge pages (MAP_HUGETLB, see
+ * /proc/sys/vm/nr_hugepages). If the pool cannot satisfy the request the allocation falls
+ * back to transparent huge pages.
+ */
+struct ExplicitHugePages {
+    static void *allocate(std::size_t bytes) { return Detail::mapPages(bytes, true); }
+    static void deallocate(void *p, std::size_t bytes) { Detail::unmapPages(p, bytes); }
+};
+
+// NumaBind {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocation policy that places all pages on the NUMA node \p Node (mbind with MPOL_BIND).
+ * The memory is mapped with \p Pages, which must be TransparentHugePages or
+ * ExplicitHugePages. If the binding fails, e.g. because \p Node does not exist, the
+ * memory is placed on first touch as usual.
+ *
+ * \tparam Node The NUMA node number, less than 64.
+ */
+template <unsigned Node, class Pages = TransparentHugePages> struct NumaBind {
+    static_assert(Node < 64, "NumaBind supports NUMA nodes 0 to 63");
+    static void *allocate(std::size_t bytes)
+    {
+        void *p = Pages::allocate(bytes);
+        Detail::setNumaPolicy(p, bytes, Detail::NumaPolicy::Bind, 1ul << Node);
+        return p;
+    }
+    static void deallocate(void *p, std::size_t bytes) { Pages::deallocate(p, bytes); }
+};
+
+// NumaInterleave {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocation policy that interleaves the pages round-robin over all NUMA nodes the process
+ * may allocate from (mbind with MPOL_INTERLEAVE). This spreads the bandwidth of data that
+ * all threads access evenly over the memory controllers.
+ *
+ * The memory is mapped with \p Pages, which must be TransparentHugePages or
+ * ExplicitHugePages.
+ */
+template <class Pages = TransparentHugePages> struct NumaInterleave {
+    static void *allocate(std::size_t bytes)
+    {
+        void *p = Pages::allocate(bytes);
+        Detail::setNumaPolicy(p, bytes, Detail::NumaPolicy::Interleave, ~0ul);
+        return p;
+    }
+    static void deallocate(void *p, std::size_t bytes) { Pages::deallocate(p, bytes); }
+};
+
+// ParallelFirstTouch {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocation policy that touches every page of a new allocation from the threads of the
+ * pool behind the Vc::par algorithms. The pages are split into one contiguous block per
+ * thread and every thread touches exactly its own block, without work stealing. With
+ * Linux' default first-touch placement the blocks are thus distributed over the NUMA
+ * nodes the threads run on.
+ *
+ * \tparam Base The policy that allocates the memory, e.g. TransparentHugePages.
+ */
+template <class Base = TransparentHugePages> struct ParallelFirstTouch {
+    static void *allocate(std::size_t bytes)
+    {
+        void *p = Base::allocate(bytes);
+        Detail::touchPages(p, bytes);
+        return p;
+    }
+    static void deallocate(void *p, std::size_t bytes) { Base::deallocate(p, bytes); }
+};
+
+// firstTouch {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Initializes the \p n objects at \p first to \p value, in parallel with the threads of the
+ * pool behind the Vc::par algorithms. The range is split into one contiguous block per
+ * thread and every thread writes exactly its own block, without work stealing. If this is
+ * the first write to freshly allocated memory, the pages of every block are placed on the
+ * NUMA node of the thread that wrote it. Ranges of at least 1 MB are cut at 2 MB
+ * boundaries, so that a huge page does not straddle two blocks.
+ *
+ * \code
+ * float *data = Vc::malloc<float, Vc::TransparentHugePages>(N);
+ * Vc::firstTouch(data, N, 0.f);
+ * \endcode
+ */
+template <typename T> inline void firstTouch(T *first, std::size_t n, const T &value = T())
+{
+    if (n == 0) {
+        return;
+    }
+    // an object that straddles a block boundary belongs to the block after it
+    const std::uintptr_t begin = reinterpret_cast<std::uintptr_t>(first);
+    Detail::forEachTouchBlock(begin, begin + n * sizeof(T),
+                              [&](std::uintptr_t lo, std::uintptr_t hi) {
+                                  std::fill(first + (lo - begin) / sizeof(T),
+                                            first + (hi - begin) / sizeof(T), value);
+                              });
+}
+//}}}1
+}  // namespace Common
+
+using Common::AlignedAllocation;
+using Common::TransparentHugePages;
+using Common::ExplicitHugePages;
+using Common::NumaBind;
+using Common::NumaInterleave;
+using Common::ParallelFirstTouch;
+using Common::firstTouch;
+
+// malloc / free with allocation policy {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Allocates memory for \p n objects of type \p T with the allocation policy \p Policy.
+ * The memory must be released with Vc::free<Policy>(p, n).
+ *
+ * \code
+ * float *data = Vc::malloc<float, Vc::NumaInterleave<>>(N);
+ * ...
+ * Vc::free<Vc::NumaInterleave<>>(data, N);
+ * \endcode
+ *
+ * \throws std::bad_alloc if the policy cannot allocate the memory.
+ */
+template <typename T, typename Policy> Vc_ALWAYS_INLINE T *malloc(std::size_t n)
+{
+    void *p = Policy::allocate(n * sizeof(T));
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return static_cast<T *>(p);
+}
+
+/**
+ * \ingroup Utilities
+ * \headerfile allocationpolicy.h <Vc/Memory>
+ *
+ * Releases the memory for \p n objects at \p p that was allocated with
+ * Vc::malloc<T, Policy>(n).
+ */
+template <typename Policy, typename T> Vc_ALWAYS_INLINE void free(T *p, std::size_t n)
+{
+    Policy::deallocate(p, n * sizeof(T));
+}
+//}}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_ALLOCATIONPOLICY_H_
+
+// vim: foldmethod=marker
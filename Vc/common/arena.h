@@ -0,0 +1,277 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_ARENA_H_
+#define VC_COMMON_ARENA_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+#include "malloc.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// AlignedArena {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Memory>
+ *
+ * A bump allocator for short-lived, vector-aligned scratch buffers.
+ *
+ * The arena hands out memory from page-aligned chunks by advancing an offset. Releasing
+ * individual allocations is free: deallocate only takes back the most recent allocation
+ * (which makes strictly nested scratch buffers reuse their memory), everything else is
+ * reclaimed at once by reset(). reset() keeps the chunks, so after the first iteration a
+ * loop of the form
+ * \code
+ * for (auto &request : requests) {
+ *   Vc::AlignedArena::local().reset();
+ *   Vc::Memory<float_v, 0, 0, true, Vc::ThreadLocalArena> scratch(request.size());
+ *   ...
+ * }
+ * \endcode
+ * does not call into the C library allocator anymore.
+ *
+ * \warning reset() invalidates all memory the arena handed out. Objects using the memory
+ * must not be used (or destroyed in a way that touches the memory) afterwards.
+ *
+ * An arena is not thread-safe. Use local() to get a separate instance per thread.
+ */
+class AlignedArena
+{
+public:
+    /// The chunk size that local() uses.
+    enum : std::size_t { DefaultChunkSize = std::size_t(1) << 20 };
+
+    /// Creates an empty arena. Chunks are allocated on demand with \p chunkSize Bytes.
+    explicit AlignedArena(std::size_t chunkSize = std::size_t(DefaultChunkSize))
+        : m_chunkSize(chunkSize), m_current(0), m_offset(0)
+    {
+    }
+
+    ~AlignedArena() { release(); }
+
+    AlignedArena(const AlignedArena &) = delete;
+    AlignedArena &operator=(const AlignedArena &) = delete;
+
+    /// The arena of the calling thread.
+    static AlignedArena &local()
+    {
+        static thread_local AlignedArena arena;
+        return arena;
+    }
+
+    /**
+     * Returns \p bytes Bytes of memory aligned on \p alignment, which must be a power of two
+     * no larger than 4096.
+     *
+     * \throws std::bad_alloc if a new chunk is required and cannot be allocated.
+     */
+    void *allocate(std::size_t bytes, std::size_t alignment = Vc::VectorAlignment)
+    {
+        if (m_current < m_chunks.size()) {
+            const std::size_t offset = (m_offset + alignment - 1) & ~(alignment - 1);
+            if (offset + bytes <= m_chunks[m_current].size) {
+                m_offset = offset + bytes;
+                return m_chunks[m_current].memory + offset;
+            }
+        }
+        return allocateFromNextChunk(bytes);
+    }
+
+    /**
+     * Takes back the allocation at \p p if it is the most recent one. Any other memory is
+     * only reclaimed by reset().
+     */
+    void deallocate(void *p, std::size_t bytes)
+    {
+        if (m_current < m_chunks.size()) {
+            char *const mem = m_chunks[m_current].memory;
+            if (static_cast<char *>(p) + bytes == mem + m_offset) {
+                m_offset = static_cast<std::size_t>(static_cast<char *>(p) - mem);
+            }
+        }
+    }
+
+    /// Makes all memory of the arena available again without freeing the chunks.
+    void reset()
+    {
+        m_current = 0;
+        m_offset = 0;
+    }
+
+    /// Frees all chunks.
+    void release()
+    {
+        for (const Chunk &c : m_chunks) {
+            Common::free(c.memory);
+        }
+        m_chunks.clear();
+        reset();
+    }
+
+    /// The number of Bytes in all chunks of the arena.
+    std::size_t capacity() const
+    {
+        std::size_t n = 0;
+        for (const Chunk &c : m_chunks) {
+            n += c.size;
+        }
+        return n;
+    }
+
+private:
+    struct Chunk {
+        char *memory;
+        std::size_t size;
+    };
+
+    // Chunks are page-aligned, so the first allocation of every chunk needs no padding.
+    void *allocateFromNextChunk(std::size_t bytes)
+    {
+        const std::size_t next = m_chunks.empty() ? 0 : m_current + 1;
+        std::size_t i = next;
+        while (i < m_chunks.size() && m_chunks[i].size < bytes) {
+            ++i;
+        }
+        if (i < m_chunks.size()) {
+            std::swap(m_chunks[i], m_chunks[next]);
+        } else {
+            const std::size_t size = std::max(m_chunkSize, bytes);
+            Chunk c = {static_cast<char *>(Common::malloc<Vc::AlignOnPage>(size)), size};
+            if (c.memory == nullptr) {
+                throw std::bad_alloc();
+            }
+            m_chunks.insert(m_chunks.begin() + next, c);
+        }
+        m_current = next;
+        m_offset = bytes;
+        return m_chunks[next].memory;
+    }
+
+    std::vector<Chunk> m_chunks;
+    std::size_t m_chunkSize;
+    std::size_t m_current;  // index of the chunk allocations are taken from
+    std::size_t m_offset;   // first free Byte in m_chunks[m_current]
+};
+
+// ThreadLocalArena {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Memory>
+ *
+ * Allocation policy that draws from AlignedArena::local(). Use it with Vc::Memory or
+ * Vc::Allocator for scratch buffers that die before the next AlignedArena::reset() of the
+ * same thread.
+ */
+struct ThreadLocalArena {
+    static void *allocate(std::size_t bytes) { return AlignedArena::local().allocate(bytes); }
+    static void deallocate(void *p, std::size_t bytes)
+    {
+        AlignedArena::local().deallocate(p, bytes);
+    }
+};
+
+// ArenaAllocator {{{1
+/**
+ * \ingroup Utilities
+ * \headerfile arena.h <Vc/Memory>
+ *
+ * An STL allocator that draws from a given AlignedArena (by default the arena of the
+ * constructing thread). Allocators compare equal if they use the same arena.
+ *
+ * \code
+ * Vc::AlignedArena arena;
+ * std::vector<float_v, Vc::ArenaAllocator<float_v>> tmp(n, arena);
+ * \endcode
+ */
+template <typename T> class ArenaAllocator
+{
+public:
+    typedef std::size_t    size_type;
+    typedef std::ptrdiff_t difference_type;
+    typedef T*             pointer;
+    typedef const T*       const_pointer;
+    typedef T&             reference;
+    typedef const T&       const_reference;
+    typedef T              value_type;
+
+    template <typename U> struct rebind { typedef ArenaAllocator<U> other; };
+
+    ArenaAllocator() noexcept : m_arena(&AlignedArena::local()) {}
+    ArenaAllocator(AlignedArena &arena) noexcept : m_arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &rhs) noexcept : m_arena(&rhs.arena())
+    {
+    }
+
+    pointer allocate(size_type n, const void * = 0)
+    {
+        if (n > max_size()) {
+            throw std::bad_alloc();
+        }
+        return static_cast<pointer>(m_arena->allocate(
+            n * sizeof(T), std::max<std::size_t>(alignof(T), Vc::VectorAlignment)));
+    }
+
+    void deallocate(pointer p, size_type n) { m_arena->deallocate(p, n * sizeof(T)); }
+
+    size_type max_size() const noexcept { return std::size_t(-1) / sizeof(T); }
+
+    /// The arena this allocator draws from.
+    AlignedArena &arena() const noexcept { return *m_arena; }
+
+private:
+    AlignedArena *m_arena;
+};
+
+template <typename T, typename U>
+inline bool operator==(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+    return &a.arena() == &b.arena();
+}
+template <typename T, typename U>
+inline bool operator!=(const ArenaAllocator<T> &a, const ArenaAllocator<U> &b)
+{
+    return &a.arena() != &b.arena();
+}
+//}}}1
+}  // namespace Common
+
+using Common::AlignedArena;
+using Common::ThreadLocalArena;
+using Common::ArenaAllocator;
+}  // namespace Vc
+
+#endif  // VC_COMMON_ARENA_H_
+
+// vim: foldmethod=marker
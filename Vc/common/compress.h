@@ -0,0 +1,168 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_COMPRESS_H_
+#define VC_COMMON_COMPRESS_H_
+
+#include <algorithm>
+#include "../type_traits"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// compress_impl {{{
+// The 8-bit vectors have no lookup tables and use this generic implementation.
+template <class V, class M> Vc_INTRINSIC V compress_impl(const V &v, const M &k)
+{
+    V r = V::Zero();
+    std::size_t j = 0;
+    for (std::size_t i : where(k)) {
+        r[j++] = v[i];
+    }
+    return r;
+}
+
+#ifdef Vc_IMPL_SSSE3
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) > 1), Vector<T, VectorAbi::Sse>> compress_impl(
+    const Vector<T, VectorAbi::Sse> &v, const Vc::Mask<T, VectorAbi::Sse> &k)
+{
+    typedef typename Vector<T, VectorAbi::Sse>::VectorType R;
+    return SSE::sse_cast<R>(compress<sizeof(T)>(SSE::sse_cast<__m128i>(v.data()), k.toInt()));
+}
+#endif
+
+#ifdef Vc_IMPL_AVX
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) > 1), Vector<T, VectorAbi::Avx>> compress_impl(
+    const Vector<T, VectorAbi::Avx> &v, const Vc::Mask<T, VectorAbi::Avx> &k)
+{
+    typedef typename Vector<T, VectorAbi::Avx>::VectorType R;
+    return AVX::avx_cast<R>(compress<sizeof(T)>(AVX::avx_cast<__m256i>(v.data()), k.toInt()));
+}
+#endif
+// }}}
+// expand_impl {{{
+template <class V, class M> Vc_INTRINSIC V expand_impl(const V &v, const M &k)
+{
+    V r = V::Zero();
+    std::size_t j = 0;
+    for (std::size_t i : where(k)) {
+        r[i] = v[j++];
+    }
+    return r;
+}
+
+#ifdef Vc_IMPL_SSSE3
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) > 1), Vector<T, VectorAbi::Sse>> expand_impl(
+    const Vector<T, VectorAbi::Sse> &v, const Vc::Mask<T, VectorAbi::Sse> &k)
+{
+    typedef typename Vector<T, VectorAbi::Sse>::VectorType R;
+    return SSE::sse_cast<R>(expand<sizeof(T)>(SSE::sse_cast<__m128i>(v.data()), k.toInt()));
+}
+#endif
+
+#ifdef Vc_IMPL_AVX
+template <class T>
+Vc_INTRINSIC enable_if<(sizeof(T) > 1), Vector<T, VectorAbi::Avx>> expand_impl(
+    const Vector<T, VectorAbi::Avx> &v, const Vc::Mask<T, VectorAbi::Avx> &k)
+{
+    typedef typename Vector<T, VectorAbi::Avx>::VectorType R;
+    return AVX::avx_cast<R>(expand<sizeof(T)>(AVX::avx_cast<__m256i>(v.data()), k.toInt()));
+}
+#endif
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns a vector with the entries of \p v selected by \p k moved to the front, in
+ * order. The remaining entries are zero.
+ *
+ * \code
+ * // v = [1, 2, 3, 4], k = [0, 1, 0, 1]
+ * Vc::compress(v, k);  // [2, 4, 0, 0]
+ * \endcode
+ *
+ * The SSE and AVX implementations use lookup-table shuffles indexed by `k.toInt()`.
+ */
+template <class V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, V> compress(const V &v,
+                                                               const typename V::Mask &k)
+{
+    return Detail::compress_impl(v, k);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * The inverse of compress: returns a vector where the entries selected by \p k receive
+ * the first entries of \p v, in order. The remaining entries are zero.
+ *
+ * \code
+ * // v = [1, 2, 3, 4], k = [0, 1, 0, 1]
+ * Vc::expand(v, k);  // [0, 1, 0, 2]
+ * \endcode
+ */
+template <class V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, V> expand(const V &v,
+                                                             const typename V::Mask &k)
+{
+    return Detail::expand_impl(v, k);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Stores the entries of \p v selected by \p k contiguously to \p mem. Exactly `k.count()`
+ * entries are written; \p mem does not need to be aligned.
+ *
+ * \return The number of entries written.
+ */
+template <class V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, std::size_t> compress_store(
+    typename V::EntryType *mem, const V &v, const typename V::Mask &k)
+{
+    const std::size_t n = k.count();
+    if (n == V::Size) {
+        v.store(mem, Vc::Unaligned);
+    } else {
+        typename V::EntryType tmp[V::Size];
+        compress(v, k).store(&tmp[0], Vc::Unaligned);
+        std::copy(&tmp[0], &tmp[n], mem);
+    }
+    return n;
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_COMPRESS_H_
+
+// vim: foldmethod=marker
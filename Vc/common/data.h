@@ -34,7 +34,9 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace Common
 {
 
-alignas(64) extern unsigned int RandomState[];
+// one state per thread, so that concurrent V::Random() calls do not race; every thread
+// is seeded differently on first use (see src/const.cpp)
+alignas(64) extern thread_local unsigned int RandomState[];
 alignas(32) extern const unsigned int AllBitsSet[8];
 
 }  // namespace Common
@@ -0,0 +1,218 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_DISPATCH_H_
+#define VC_COMMON_DISPATCH_H_
+
+#include <utility>
+#include "../global.h"
+#include "../traits/type_traits.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+// DispatchTable {{{
+/**\internal
+ * The implementations registered for one dispatched function. Objects of this type are
+ * zero-initialized static data, so registration works regardless of the order in which
+ * the translation units are initialized.
+ */
+struct DispatchTable {
+    enum { Capacity = 16 };
+    void (*functions[Capacity])();
+    unsigned int features[Capacity];
+    unsigned int size;
+};
+
+/**\internal
+ * Adds \p function, compiled for the Vc::ImplementationT bitmask \p features, to \p
+ * table. Implemented in libVc, which is compiled for the baseline target, so that it may
+ * run before the CPU has been checked.
+ */
+bool Vc_CDECL registerDispatchTarget(DispatchTable &table, void (*function)(),
+                                     unsigned int features);
+
+/**\internal
+ * Returns the index of the best entry in \p table that the CPU supports. The best entry
+ * has the highest Vc::Implementation and, among equal implementations, the most extra
+ * instructions. Aborts with a message if no entry is supported.
+ */
+unsigned int Vc_CDECL selectDispatchTarget(const DispatchTable &table);
+// }}}
+}  // namespace Common
+
+namespace Detail
+{
+// implementation_features {{{
+/**\internal
+ * Returns the bitmask that identifies \p Impl.
+ */
+template <unsigned int Features>
+constexpr unsigned int implementation_features(ImplementationT<Features>)
+{
+    return Features;
+}
+// }}}
+// none_is_simd {{{
+/**\internal
+ * Whether none of \p Ts is a Vc vector or mask type.
+ */
+template <class... Ts> struct none_is_simd : std::true_type {
+};
+template <class T, class... Ts>
+struct none_is_simd<T, Ts...>
+    : std::integral_constant<bool, !Traits::is_simd_vector<T>::value &&
+                                       !Traits::is_simd_mask<T>::value &&
+                                       none_is_simd<Ts...>::value> {
+};
+// }}}
+}  // namespace Detail
+
+template <class Tag, class Signature> class DispatchedFunction;
+
+/**
+ * \ingroup Utilities
+ *
+ * A function that is compiled once per Vc implementation and calls the best version the
+ * CPU supports.
+ *
+ * Declare the function with Vc_DISPATCHED_FUNCTION in a header that is shared between the
+ * callers and the kernel source. Compile the kernel source once per implementation with
+ * the CMake macro \c vc_compile_for_dispatch, and register the kernel in it with
+ * Vc_DISPATCH_TARGET:
+ *
+ * \code
+ * // saxpy.h
+ * Vc_DISPATCHED_FUNCTION(saxpy, void(float, const float *, float *, std::size_t));
+ *
+ * // saxpy.cpp, compiled for Scalar, SSE2, SSE4_2, AVX and AVX2+FMA+BMI2
+ * namespace {
+ * void saxpyKernel(float a, const float *x, float *y, std::size_t n) { ... Vc::float_v ... }
+ * }
+ * Vc_DISPATCH_TARGET(saxpy, saxpyKernel);
+ *
+ * // main.cpp, compiled for the baseline target
+ * saxpy(2.f, x, y, n);
+ * \endcode
+ *
+ * The first call selects the version to use and every later call goes through the same
+ * function pointer. Do not call a dispatched function before \c main, since the versions
+ * register themselves during static initialization.
+ *
+ * The signature is the ABI between the versions. It must not contain Vc vector or mask
+ * types, since their layout differs between implementations. Pass pointers and scalars
+ * instead. Inside a kernel, keep to Vc types and functions and to code with internal
+ * linkage. Out-of-line template instantiations that other translation units also use
+ * (e.g. members of std::vector) might be merged by the linker with a copy compiled for a
+ * newer instruction set.
+ *
+ * \tparam Tag A type that identifies the function.
+ * \tparam R The return type.
+ * \tparam Args The argument types.
+ */
+template <class Tag, class R, class... Args> class DispatchedFunction<Tag, R(Args...)>
+{
+    static_assert(Detail::none_is_simd<R, Args...>::value,
+                  "The signature of a dispatched function must not use Vc vector or mask "
+                  "types. Their layout depends on the implementation.");
+
+public:
+    /// The type of the function pointers.
+    typedef R (*pointer)(Args...);
+
+    /**
+     * Registers \p f as the version for the Vc::ImplementationT bitmask \p features.
+     * Called via Vc_DISPATCH_TARGET.
+     */
+    static Vc_ALWAYS_INLINE bool add(pointer f, unsigned int features)
+    {
+        return Common::registerDispatchTarget(table, reinterpret_cast<void (*)()>(f),
+                                              features);
+    }
+
+    /// Returns the selected version.
+    static Vc_ALWAYS_INLINE pointer function()
+    {
+        return reinterpret_cast<pointer>(table.functions[selected()]);
+    }
+
+    /// Returns the Vc::ImplementationT bitmask of the selected version.
+    static Vc_ALWAYS_INLINE unsigned int implementation()
+    {
+        return table.features[selected()];
+    }
+
+    /// Calls the selected version.
+    Vc_ALWAYS_INLINE R operator()(Args... args) const
+    {
+        return function()(std::forward<Args>(args)...);
+    }
+
+private:
+    static Vc_ALWAYS_INLINE unsigned int selected()
+    {
+        static const unsigned int index = Common::selectDispatchTarget(table);
+        return index;
+    }
+
+    static Common::DispatchTable table;
+};
+template <class Tag, class R, class... Args>
+Common::DispatchTable DispatchedFunction<Tag, R(Args...)>::table = {};
+
+}  // namespace Vc
+
+/**
+ * \ingroup Utilities
+ *
+ * Declares the Vc::DispatchedFunction object \p name_ with the function type \p
+ * signature_.
+ */
+#define Vc_DISPATCHED_FUNCTION(name_, ...)                                               \
+    struct Vc_dispatch_tag_##name_;                                                      \
+    constexpr ::Vc::DispatchedFunction<Vc_dispatch_tag_##name_, __VA_ARGS__> name_ = {}
+
+/**
+ * \ingroup Utilities
+ *
+ * Registers \p function_ as the version of the dispatched function \p name_ for the
+ * implementation this translation unit is compiled for.
+ */
+#define Vc_DISPATCH_TARGET(name_, function_)                                             \
+    namespace                                                                            \
+    {                                                                                    \
+    const bool Vc_dispatch_registered_##name_ = name_.add(                               \
+        function_,                                                                       \
+        ::Vc::Detail::implementation_features(::Vc::CurrentImplementation()));           \
+    }                                                                                    \
+    static_assert(true, "")
+
+#endif  // VC_COMMON_DISPATCH_H_
+
+// vim: foldmethod=marker
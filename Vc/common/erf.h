@@ -0,0 +1,188 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The rational approximations for erf and erfc are taken from fdlibm, which carries
+the following Copyright notice:
+
+Copyright (C) 1993 by Sun Microsystems, Inc. All rights reserved.
+
+Developed at SunPro, a Sun Microsystems, Inc. business.
+Permission to use, copy, modify, and distribute this
+software is freely granted, provided that this notice
+is preserved.
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// erf_polynomial {{{1
+// Evaluates c[0] + c[1]·x + … + c[N-1]·xᴺ⁻¹ in the precision of V.
+template <typename V, std::size_t N>
+Vc_ALWAYS_INLINE V erf_polynomial(const V &x, const double (&c)[N])
+{
+    using T = typename V::EntryType;
+    V r = T(c[N - 1]);
+    for (std::size_t i = N - 1; i > 0; --i) {
+        r = r * x + T(c[i - 1]);
+    }
+    return r;
+}
+
+// erf_small {{{1
+// Returns y with erf(x) = x + x·y for |x| < 0.84375.
+template <typename V> Vc_ALWAYS_INLINE V erf_small(const V &x)
+{
+    const double P[] = {1.28379167095512558561e-01, -3.25042107247001499370e-01,
+                        -2.84817495755985104766e-02, -5.77027029648944159157e-03,
+                        -2.37630166566501626084e-05};
+    const double Q[] = {1., 3.97917223959155352819e-01, 6.50222499887672944485e-02,
+                        5.08130628187576562776e-03, 1.32494738004321644526e-04,
+                        -3.96022827877536812320e-06};
+    const V z = x * x;
+    return erf_polynomial(z, P) / erf_polynomial(z, Q);
+}
+
+// erf_medium {{{1
+// Returns erf(1 + s) - erx for s = |x| - 1 and 0.84375 ≤ |x| < 1.25.
+template <typename V> Vc_ALWAYS_INLINE V erf_medium(const V &s)
+{
+    const double P[] = {-2.36211856075265944077e-03, 4.14856118683748331666e-01,
+                        -3.72207876035701323847e-01, 3.18346619901161753674e-01,
+                        -1.10894694282396677476e-01, 3.54783043256182359371e-02,
+                        -2.16637559486879084300e-03};
+    const double Q[] = {1., 1.06420880400844228286e-01, 5.40397917702171048937e-01,
+                        7.18286544141962662868e-02, 1.26171219808761642112e-01,
+                        1.36370839120290507362e-02, 1.19844998467991074170e-02};
+    return erf_polynomial(s, P) / erf_polynomial(s, Q);
+}
+// erf(1) rounded to 24 bits
+constexpr double erx = 8.45062911510467529297e-01;
+
+template <typename T> constexpr T erfc_max() { return sizeof(T) == 4 ? 10.1f : 27.3; }
+
+// erfc_large {{{1
+// Returns erfc(a) for a ≥ 1.25.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> erfc_large(const Vector<T, Abi> &a)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    const double RA[] = {-9.86494403484714822705e-03, -6.93858572707181764372e-01,
+                         -1.05586262253232909814e+01, -6.23753324503260060396e+01,
+                         -1.62396669462573470355e+02, -1.84605092906711035994e+02,
+                         -8.12874355063065934246e+01, -9.81432934416914548592e+00};
+    const double SA[] = {1., 1.96512716674392571292e+01, 1.37657754143519042600e+02,
+                         4.34565877475229228821e+02, 6.45387271733267880336e+02,
+                         4.29008140027567833386e+02, 1.08635005541779435134e+02,
+                         6.57024977031928170135e+00, -6.04244152148580987438e-02};
+    const double RB[] = {-9.86494292470009928597e-03, -7.99283237680523006574e-01,
+                         -1.77579549177547519889e+01, -1.60636384855821916062e+02,
+                         -6.37566443368389627722e+02, -1.02509513161107724954e+03,
+                         -4.83519191608651397019e+02};
+    const double SB[] = {1., 3.03380607434824582924e+01, 3.25792512996573918826e+02,
+                         1.53672958608443695994e+03, 3.19985821950859553908e+03,
+                         2.55305040643316442583e+03, 4.74528541206955367215e+02,
+                         -2.24409524465858183362e+01};
+
+    // erfc(a) = e^(-a² - 0.5625 + R(s)/S(s)) / a with s = 1/a²
+    const V s = T(1) / (a * a);
+    V rs;
+    const auto near = a < T(1 / 0.35);
+    if (all_of(near)) {
+        rs = erf_polynomial(s, RA) / erf_polynomial(s, SA);
+    } else {
+        rs = erf_polynomial(s, RB) / erf_polynomial(s, SB);
+        if (any_of(near)) {
+            rs(near) = erf_polynomial(s, RA) / erf_polynomial(s, SA);
+        }
+    }
+    // a² = z² + (a - z)(a + z) with z² + 0.5625 exact, which requires z to have less than
+    // half the mantissa bits
+    const V z = Detail::operator&(a, C::highMask(sizeof(T) == 4 ? 13 : 32));
+    return exp_extended(-z * z - T(0.5625), (z - a) * (z + a) + rs) / a;
+}
+//}}}1
+}  // namespace Detail
+
+// erf {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> erf(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    const V a = abs(x);
+    V r = x;
+    const auto small = a < T(0.84375);
+    if (any_of(small)) {
+        r(small) = x + x * Detail::erf_small(x);
+    }
+    const auto medium = a >= T(0.84375) && a < T(1.25);
+    if (any_of(medium)) {
+        r(medium) = copysign(T(Detail::erx) + Detail::erf_medium(a - T(1)), x);
+    }
+    const auto large = a >= T(1.25);
+    if (any_of(large)) {
+        // erf(a) rounds to 1 beyond 6
+        r(large) = copysign(T(1) - Detail::erfc_large(min(a, V(T(6)))), x);
+    }
+    r(isnan(x)) = x;  // every ordered compare with NaN is false, so no branch covers NaN
+    return r;
+}
+
+// erfc {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> erfc(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    const V a = abs(x);
+    V r = x;
+    const auto small = a < T(0.84375);
+    if (any_of(small)) {
+        const V xy = x * Detail::erf_small(x);
+        r(small) = T(0.5) - (xy + (x - T(0.5)));
+        r(small && a < T(0.25)) = T(1) - (x + xy);
+    }
+    const auto medium = a >= T(0.84375) && a < T(1.25);
+    if (any_of(medium)) {
+        const V pq = Detail::erf_medium(a - T(1));
+        r(medium) = T(1) + (T(Detail::erx) + pq);
+        r(medium && x > V::Zero()) = T(1 - Detail::erx) - pq;
+    }
+    const auto large = a >= T(1.25);
+    if (any_of(large)) {
+        // erfc(a) rounds to zero beyond erfc_max, which also keeps exp_extended in range
+        const V t = Detail::erfc_large(min(a, V(Detail::erfc_max<T>())));
+        r(large) = t;
+        r(large && x < V::Zero()) = T(2) - t;
+    }
+    r(isnan(x)) = x;  // every ordered compare with NaN is false, so no branch covers NaN
+    return r;
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
@@ -41,44 +41,230 @@ constexpr float MAXLOGF = 88.72283905206835f;
 constexpr float MINLOGF = -103.278929903431851103f; /* log(2^-149) */
 constexpr float MAXNUMF = 3.4028234663852885981170418348451692544e38f;
 
-template <typename Abi, typename = enable_if<std::is_same<Abi, VectorAbi::Sse>::value ||
-                                             std::is_same<Abi, VectorAbi::Avx>::value>>
-inline Vector<float, detail::not_fixed_size_abi<Abi>> exp(Vector<float, Abi> x)
+namespace Detail
 {
-    using V = Vector<float, Abi>;
-    typedef typename V::Mask M;
-    typedef Detail::Const<float, Abi> C;
-
-        const M overflow  = x > MAXLOGF;
-        const M underflow = x < MINLOGF;
-
-        // log₂(eˣ) = x * log₂(e) * log₂(2)
-        //          = log₂(2^(x * log₂(e)))
-        // => eˣ = 2^(x * log₂(e))
-        // => n  = ⌊x * log₂(e) + ½⌋
-        // => y  = x - n * ln(2)       | recall that: ln(2) * log₂(e) == 1
-        // <=> eˣ = 2ⁿ * eʸ
-        V z = floor(C::log2_e() * x + 0.5f);
-        const auto n = static_cast<Vc::SimdArray<int, V::Size>>(z);
-        x -= z * C::ln2_large();
-        x -= z * C::ln2_small();
-
-        /* Theoretical peak relative error in [-0.5, +0.5] is 4.2e-9. */
-        z = ((((( 1.9875691500E-4f  * x
-                + 1.3981999507E-3f) * x
-                + 8.3334519073E-3f) * x
-                + 4.1665795894E-2f) * x
-                + 1.6666665459E-1f) * x
-                + 5.0000001201E-1f) * (x * x)
-                + x
-                + 1.0f;
-
-        x = ldexp(z, n); // == z * 2ⁿ
-
-        x(overflow) = std::numeric_limits<typename V::EntryType>::infinity();
-        x.setZero(underflow);
-
-        return x;
-    }
+template <typename T, typename Abi>
+using enable_if_sse_or_avx_real = enable_if<
+    std::is_floating_point<T>::value && (std::is_same<Abi, VectorAbi::Sse>::value ||
+                                         std::is_same<Abi, VectorAbi::Avx>::value)>;
+
+// ExpLimits {{{1
+// The arguments beyond which the result overflows to +∞ (max) or is less than half the
+// smallest denormal (min) for every supported base.
+template <typename T> struct ExpLimits;
+template <> struct ExpLimits<float> {
+    static constexpr float max_e() { return MAXLOGF; }
+    static constexpr float min_e() { return -103.97207708399179f; }  // log(2^-150)
+    static constexpr float max_2() { return 128.f; }
+    static constexpr float min_2() { return -150.f; }
+    static constexpr float max_10() { return 38.531839419103626f; }
+    static constexpr float min_10() { return -45.15449934959718f; }  // log10(2^-150)
+    // log10(2) split into a part with few mantissa bits and the remainder
+    static constexpr float log10_2_large() { return 3.00781250000000000000E-1f; }
+    static constexpr float log10_2_small() { return 2.48745663981195213739E-4f; }
+    // below this argument eˣ - 1 rounds to -1
+    static constexpr float min_m1() { return -18.021826694558577f; }  // log(2^-26)
+    // 2ⁿ - 1 is exact for |n| up to the number of mantissa digits
+    static constexpr int digits() { return 24; }
+};
+template <> struct ExpLimits<double> {
+    static constexpr double max_e() { return 7.09782712893383996843E2; }
+    static constexpr double min_e() { return -7.45133219101941108420E2; }  // log(2^-1075)
+    static constexpr double max_2() { return 1024.; }
+    static constexpr double min_2() { return -1075.; }
+    static constexpr double max_10() { return 3.08254715559916743851E2; }
+    static constexpr double min_10() { return -3.2360724533877976E2; }  // log10(2^-1075)
+    static constexpr double log10_2_large() { return 3.01025390625000000000E-1; }
+    static constexpr double log10_2_small() { return 4.60503898119521373889E-6; }
+    static constexpr double min_m1() { return -38.816242111356935; }  // log(2^-56)
+    static constexpr int digits() { return 53; }
+};
+
+// expm1_kernel {{{1
+// Returns eʳ - 1 for |r| ≤ ½. Returning eʳ - 1 instead of eʳ keeps the full relative
+// precision for small r, which expm1 needs, and exp only adds 1.
+template <typename Abi> Vc_ALWAYS_INLINE Vector<float, Abi> expm1_kernel(Vector<float, Abi> x)
+{
+    /* Theoretical peak relative error in [-0.5, +0.5] is 4.2e-9. */
+    return ((((( 1.9875691500E-4f  * x
+               + 1.3981999507E-3f) * x
+               + 8.3334519073E-3f) * x
+               + 4.1665795894E-2f) * x
+               + 1.6666665459E-1f) * x
+               + 5.0000001201E-1f) * (x * x)
+               + x;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> expm1_kernel(Vector<double, Abi> x)
+{
+    using V = Vector<double, Abi>;
+    // Padé approximation: eʳ - 1 = 2rP(r²) / (Q(r²) - rP(r²))
+    // The constant terms of P and Q are 1 and 2. Evaluating the expression as
+    // r + r(2P - Q + rP) / (Q - rP) with those terms subtracted exactly leaves only the
+    // correction term (≈ r²/2) subject to rounding errors.
+    const double P[] = {
+        Vc::Detail::doubleConstant<1, 0x000089cdd5e44be8ull, -13>(),
+        Vc::Detail::doubleConstant<1, 0x000f06d10cca2c7eull,  -6>()
+    };
+    const double Q[] = {
+        Vc::Detail::doubleConstant<1, 0x00092eb6bc365fa0ull, -19>(),
+        Vc::Detail::doubleConstant<1, 0x0004ae39b508b6c0ull,  -9>(),
+        Vc::Detail::doubleConstant<1, 0x000d17099887e074ull,  -3>(),
+        Vc::Detail::doubleConstant<1, 0x0000000000000000ull,   1>()
+    };
+    const V x2 = x * x;
+    const V p1 = (P[0] * x2 + P[1]) * x2;               // P - 1
+    const V q2 = ((Q[0] * x2 + Q[1]) * x2 + Q[2]) * x2;  // Q - 2
+    const V px = x + x * p1;
+    return x + x * (((p1 + p1) - q2) + px) / ((q2 + Q[3]) - px);
+}
+
+// scale {{{1
+// Returns y·2ⁿ for y ∈ [½, 2[ and n ∈ [-digits - 1022, 1024]. ldexp only adjusts the
+// exponent bits and therefore cannot produce denormals or ∞. Splitting 2ⁿ into two
+// factors keeps both ldexp calls in the range of normal numbers and lets the
+// multiplication do the rounding to denormals and the overflow.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> scale(Vector<T, Abi> y,
+                                      const SimdArray<int, Vector<T, Abi>::Size> &n)
+{
+    const SimdArray<int, Vector<T, Abi>::Size> n0 = n >> 1;
+    return ldexp(y, n - n0) * ldexp(Vector<T, Abi>::One(), n0);
+}
+
+// exp_extended {{{1
+// Returns e^(hi + lo) where lo carries the bits of an extended-precision argument that do
+// not fit into hi (see pow and erfc). lo may be as large as ½, as long as hi + lo is
+// within the range of finite nonzero results; the caller handles all other arguments.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> exp_extended(Vector<T, Abi> hi, Vector<T, Abi> lo)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    const V z = floor(C::log2_e() * (hi + lo) + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    V r = hi - z * C::ln2_large();  // exact
+    r += lo;
+    r -= z * C::ln2_small();
+    return scale(expm1_kernel(r) + T(1), n);
+}
+
+// exp_scaled {{{1
+// Returns eˣ·2ᵏ without the intermediate overflow of exp(x) * 2ᵏ for negative k.
+// Arguments beyond the range of exp are not handled.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> exp_scaled(Vector<T, Abi> x, int k)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    const V z = floor(C::log2_e() * x + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    V r = x - z * C::ln2_large();
+    r -= z * C::ln2_small();
+    return scale(expm1_kernel(r) + T(1), n + k);
+}
+
+// finalize {{{1
+// Applies the results for the arguments outside the range the reduction supports.
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> finalize(Vector<T, Abi> r, const Vector<T, Abi> &x,
+                                         T max, T min, T min_result)
+{
+    r(x > max) = std::numeric_limits<T>::infinity();
+    r(x < min) = min_result;
+    r(isnan(x)) = x;
+    return r;
+}
+//}}}1
+}  // namespace Detail
+
+// exp {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> exp(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using L = Detail::ExpLimits<T>;
+
+    // log₂(eˣ) = x * log₂(e) * log₂(2)
+    //          = log₂(2^(x * log₂(e)))
+    // => eˣ = 2^(x * log₂(e))
+    // => n  = ⌊x * log₂(e) + ½⌋
+    // => r  = x - n * ln(2)       | recall that: ln(2) * log₂(e) == 1
+    // <=> eˣ = 2ⁿ * eʳ
+    const V z = floor(C::log2_e() * x + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    V r = x - z * C::ln2_large();
+    r -= z * C::ln2_small();
+
+    r = Detail::scale(Detail::expm1_kernel(r) + T(1), n);
+    return Detail::finalize(r, x, L::max_e(), L::min_e(), T(0));
+}
+
+// exp2 {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> exp2(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using L = Detail::ExpLimits<T>;
+
+    // 2ˣ = 2ⁿ * 2ᶠ = 2ⁿ * e^(f * ln(2)) with n = ⌊x + ½⌋ and f = x - n exact
+    const V z = floor(x + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    const V r = (x - z) * T(0.693147180559945309417232121458176568);
+
+    return Detail::finalize(Detail::scale(Detail::expm1_kernel(r) + T(1), n), x,
+                            L::max_2(), L::min_2(), T(0));
+}
+
+// exp10 {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> exp10(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using L = Detail::ExpLimits<T>;
+
+    // 10ˣ = 2ⁿ * 10ᶠ with n = ⌊x * log₂(10) + ½⌋ and f = x - n * log₁₀(2)
+    // n * log10_2_large is exact, which makes the subtraction exact as well.
+    const V z = floor(x * T(3.32192809488736234787031942948939018) + T(0.5));
+    const auto n = static_cast<SimdArray<int, V::Size>>(z);
+    V f = x - z * L::log10_2_large();
+    f -= z * L::log10_2_small();
+    const V r = f * T(2.30258509299404568401799145468436421);
+
+    return Detail::finalize(Detail::scale(Detail::expm1_kernel(r) + T(1), n), x,
+                            L::max_10(), L::min_10(), T(0));
+}
+
+// expm1 {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> expm1(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    using L = Detail::ExpLimits<T>;
+    using IV = SimdArray<int, V::Size>;
+
+    // The kernel covers [-½, ½] without reduction. Skipping it there avoids the
+    // cancellation in 2ⁿ(eʳ - 1) + (2ⁿ - 1) for n = ±1.
+    V z = floor(C::log2_e() * x + T(0.5));
+    z.setZero(abs(x) <= T(0.5));
+    const auto n = static_cast<IV>(z);
+    V r = x - z * C::ln2_large();
+    r -= z * C::ln2_small();
+    r = Detail::expm1_kernel(r);
+
+    // eˣ - 1 = 2ⁿ(eʳ - 1) + (2ⁿ - 1)
+    // The second term is exact for n ≤ digits. For larger n the -1 is lost to rounding and
+    // the result is eˣ, which may need the additional scaling by 2ⁿ⁻ᵈⁱᵍⁱᵗˢ.
+    const IV n0 = min(n, IV(L::digits()));
+    const V t = ldexp(V::One(), n0);
+    V t1 = t - T(1);
+    t1(z > T(L::digits())) = t;
+    r = (r * t + t1) * ldexp(V::One(), n - n0);
+    r(x == V::Zero()) = x;  // preserve the sign of zero
+    return Detail::finalize(r, x, L::max_e(), L::min_m1(), T(-1));
+}
+//}}}1
 
 #endif // Vc_COMMON_MATH_H_INTERNAL
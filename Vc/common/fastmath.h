@@ -0,0 +1,632 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_FASTMATH_H_
+#define VC_COMMON_FASTMATH_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Math
+ *
+ * Selects the accuracy of sin, cos, exp, log, and atan2 per call:
+ * \code
+ * Vc::float_v y = Vc::sin<Vc::precision::ulp4>(x);  // same as Vc::fast::sin(x)
+ * \endcode
+ */
+enum class precision {
+    /// The default implementations, e.g. `Vc::sin<precision::precise>(x)` is `Vc::sin(x)`.
+    precise,
+    /// The implementations in Vc::fast, which have a max. error of 4 ulp.
+    ulp4
+};
+
+namespace Detail
+{
+// FastMathConstants {{{1
+// The argument ranges of the fast implementations and the splits of π/2, π/4, and ln(2)
+// for their argument reductions. The leading parts have few enough mantissa bits that
+// their product with any multiple in range is exact.
+template <typename T> struct FastMathConstants;
+template <> struct FastMathConstants<float> {
+    static constexpr float max_trig() { return 8192.f; }
+    static constexpr float pi_2_0() { return 1.5703125f; }
+    static constexpr float pi_2_1() { return 4.83751297e-4f; }
+    static constexpr float pi_2_2() { return 7.54953362e-8f; }
+    static constexpr float pi_2_3() { return 2.56334407e-12f; }
+    static constexpr float pi_4_hi() { return 0.785398006f; }
+    static constexpr float pi_4_lo() { return 1.56958237e-7f; }
+    static constexpr float ln2_hi() { return 0.693359375f; }
+    static constexpr float ln2_lo() { return -2.12194440e-4f; }
+    static constexpr float max_exp() { return 88.7228394f; }
+    // slightly above -125.5·ln(2), below which 2ⁿ is not a normalized number
+    static constexpr float min_exp() { return -86.98f; }
+    // scales denormals to normalized numbers
+    static constexpr int denormal_shift() { return 25; }
+};
+template <> struct FastMathConstants<double> {
+    static constexpr double max_trig() { return 8192.; }
+    static constexpr double pi_2_0() { return 1.5707963267941523; }
+    static constexpr double pi_2_1() { return 7.4435474804802548e-13; }
+    static constexpr double pi_2_2() { return 6.3683171630773596e-25; }
+    static constexpr double pi_4_hi() { return 7.85398163397448278999e-01; }
+    static constexpr double pi_4_lo() { return 3.06161699786838301793e-17; }
+    static constexpr double ln2_hi() { return 0.69314718055920821; }
+    static constexpr double ln2_lo() { return 7.3710025651619959e-13; }
+    static constexpr double max_exp() { return 7.09782712893383996843E2; }
+    // slightly above -1021.5·ln(2)
+    static constexpr double min_exp() { return -708.04; }
+    static constexpr int denormal_shift() { return 54; }
+};
+
+// fast_reduce_pi_2 {{{1
+// Returns a - k·π/2 for integral k with |k| < 2¹³.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> fast_reduce_pi_2(Vector<float, Abi> a,
+                                                     const Vector<float, Abi> &k)
+{
+    using C = FastMathConstants<float>;
+    a -= k * C::pi_2_0();  // exact
+    a -= k * C::pi_2_1();
+    a -= k * C::pi_2_2();
+    a -= k * C::pi_2_3();
+    return a;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> fast_reduce_pi_2(Vector<double, Abi> a,
+                                                      const Vector<double, Abi> &k)
+{
+    using C = FastMathConstants<double>;
+    a -= k * C::pi_2_0();  // exact
+    a -= k * C::pi_2_1();
+    a -= k * C::pi_2_2();
+    return a;
+}
+
+// fast_sin_poly {{{1
+// Returns sin(r) for |r| ≤ π/2. The minimax polynomials cover the whole interval,
+// which saves the cosine series and the selection between the two.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> fast_sin_poly(const Vector<float, Abi> &r)
+{
+    const Vector<float, Abi> z = r * r;
+    return (((2.60578066e-6f * z
+            - 1.98096029e-4f) * z
+            + 8.33306625e-3f) * z
+            - 1.66666596e-1f) * z * r
+            + r;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> fast_sin_poly(const Vector<double, Abi> &r)
+{
+    const Vector<double, Abi> z = r * r;
+    return (((((((2.7211749807755081e-15 * z
+                 - 7.6429914911693802e-13) * z
+                 + 1.6058939705974581e-10) * z
+                 - 2.5052106872803966e-08) * z
+                 + 2.7557319211137296e-06) * z
+                 - 1.9841269841209219e-04) * z
+                 + 8.3333333333331943e-03) * z
+                 - 1.6666666666666666e-01) * z * r
+                 + r;
+}
+
+// fast_expm1_poly {{{1
+// Returns eʳ - 1 for |r| ≤ ½ln(2).
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> fast_expm1_poly(const Vector<float, Abi> &r)
+{
+    return ((((1.38146131e-3f * r
+             + 8.36870983e-3f) * r
+             + 4.16683874e-2f) * r
+             + 1.66665207e-1f) * r
+             + 4.99999935e-1f) * (r * r)
+             + r;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> fast_expm1_poly(const Vector<double, Abi> &r)
+{
+    return (((((((((2.5000069792886608e-08 * r
+                  + 2.7630233976470121e-07) * r
+                  + 2.7557586274096519e-06) * r
+                  + 2.4801493136021496e-05) * r
+                  + 1.9841269506771306e-04) * r
+                  + 1.3888888943597859e-03) * r
+                  + 8.3333333334943367e-03) * r
+                  + 4.1666666666530265e-02) * r
+                  + 1.6666666666666413e-01) * r
+                  + 5.0000000000000106e-01) * (r * r)
+                  + r;
+}
+
+// fast_log_poly {{{1
+// Returns 2·atanh(s) - 2s for |s| ≤ (√2 - 1) / (√2 + 1).
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> fast_log_poly(const Vector<float, Abi> &s)
+{
+    const Vector<float, Abi> z = s * s;
+    return ((2.98709372e-1f * z
+           + 3.99775740e-1f) * z
+           + 6.66667761e-1f) * z * s;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> fast_log_poly(const Vector<double, Abi> &s)
+{
+    const Vector<double, Abi> z = s * s;
+    return ((((((1.4795474316971284e-01 * z
+               + 1.5314098919266242e-01) * z
+               + 1.8183562401907452e-01) * z
+               + 2.2222198610843710e-01) * z
+               + 2.8571428742014960e-01) * z
+               + 3.9999999999416374e-01) * z
+               + 6.6666666666667342e-01) * z * s;
+}
+
+// fast_atan_poly {{{1
+// Returns atan(t) for |t| ≤ √2 - 1.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<float, Abi> fast_atan_poly(const Vector<float, Abi> &t)
+{
+    const Vector<float, Abi> z = t * t;
+    return (((8.05372285e-2f * z
+            - 1.38776788e-1f) * z
+            + 1.99777100e-1f) * z
+            - 3.33329491e-1f) * z * t
+            + t;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> fast_atan_poly(const Vector<double, Abi> &t)
+{
+    const Vector<double, Abi> z = t * t;
+    return ((((((((((-1.7905046094057485e-02 * z
+                    + 3.8062146102121679e-02) * z
+                    - 5.0391906785238089e-02) * z
+                    + 5.8478593315191677e-02) * z
+                    - 6.6630992121134167e-02) * z
+                    + 7.6920597182003889e-02) * z
+                    - 9.0908977252975347e-02) * z
+                    + 1.1111110782156712e-01) * z
+                    - 1.4285714280166599e-01) * z
+                    + 1.9999999999953248e-01) * z
+                    - 3.3333333333333196e-01) * z * t
+                    + t;
+}
+
+// is_odd {{{1
+// Returns whether the integral values in \p q are odd.
+template <typename V> Vc_INTRINSIC typename V::Mask is_odd(const V &q)
+{
+    using T = typename V::EntryType;
+    return floor(q * T(0.5)) != q * T(0.5);
+}
+
+// has_fast_math {{{1
+// The fast implementations only pay off for the SSE and AVX vectors. The Scalar and
+// Generic ABIs evaluate <cmath> per entry and use the default implementations.
+template <typename Abi>
+using has_fast_math =
+    std::integral_constant<bool, (std::is_same<Abi, VectorAbi::Sse>::value ||
+                                  std::is_same<Abi, VectorAbi::Avx>::value)>;
+
+// fixed_size_simd uses the SimdArray overloads below
+template <typename T, typename Abi>
+using enable_if_fast_math_real =
+    enable_if<std::is_floating_point<T>::value, Vector<T, detail::not_fixed_size_abi<Abi>>>;
+
+// fast_sin {{{1
+template <typename V> Vc_INTRINSIC V fast_sin_impl(const V &x, std::false_type)
+{
+    return Vc::sin(x);
+}
+template <typename V> Vc_INTRINSIC V fast_sin_impl(const V &x, std::true_type)
+{
+    using T = typename V::EntryType;
+    using C = FastMathConstants<T>;
+    // !(a <= max) also catches NaN and ±∞
+    if (Vc_IS_UNLIKELY(any_of(!(abs(x) <= C::max_trig())))) {
+        return Vc::sin(x);
+    }
+    // sin(x) = sign(x)·(-1)^q·sin(|x| - qπ) with q = round(|x| / π)
+    const V a = abs(x);
+    const V q = round(a * T(0.318309886183790671537767526745028724));
+    V r = fast_reduce_pi_2(a, q + q);
+    r(is_odd(q) ^ isnegative(x)) = -r;
+    V y = fast_sin_poly(r);
+    y(a == V::Zero()) = x;  // the polynomial turns -0 into +0
+    return y;
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if_fast_math_real<T, Abi> fast_sin(const Vector<T, Abi> &x)
+{
+    return fast_sin_impl(x, has_fast_math<Abi>());
+}
+
+// fast_cos {{{1
+template <typename V> Vc_INTRINSIC V fast_cos_impl(const V &x, std::false_type)
+{
+    return Vc::cos(x);
+}
+template <typename V> Vc_INTRINSIC V fast_cos_impl(const V &x, std::true_type)
+{
+    using T = typename V::EntryType;
+    using C = FastMathConstants<T>;
+    if (Vc_IS_UNLIKELY(any_of(!(abs(x) <= C::max_trig())))) {
+        return Vc::cos(x);
+    }
+    // cos(x) = -(-1)^q·sin(|x| - (q + ½)π) with q = round(|x| / π - ½)
+    const V a = abs(x);
+    const V q = round(a * T(0.318309886183790671537767526745028724) - T(0.5));
+    V r = fast_reduce_pi_2(a, q + q + T(1));
+    r(!is_odd(q)) = -r;
+    return fast_sin_poly(r);
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if_fast_math_real<T, Abi> fast_cos(const Vector<T, Abi> &x)
+{
+    return fast_cos_impl(x, has_fast_math<Abi>());
+}
+
+// fast_exp {{{1
+template <typename V> Vc_INTRINSIC V fast_exp_impl(const V &x, std::false_type)
+{
+    return Vc::exp(x);
+}
+template <typename V> Vc_INTRINSIC V fast_exp_impl(const V &x, std::true_type)
+{
+    using T = typename V::EntryType;
+    using C = FastMathConstants<T>;
+    // eˣ = 2ⁿ·eʳ as in Vc::exp, but with a shorter polynomial and a single ldexp, which
+    // restricts the results to normalized numbers
+    const V n = round(x * T(1.44269504088896340735992468100189214));
+    V r = x - n * C::ln2_hi();  // exact
+    r -= n * C::ln2_lo();
+    V y = ldexp(fast_expm1_poly(r) + T(1), static_cast<SimdArray<int, V::Size>>(n));
+    y(x >= C::max_exp()) = std::numeric_limits<T>::infinity();  // n = 128 (1024) yields NaN
+    y(x < C::min_exp()) = T(0);
+    y(isnan(x)) = x;
+    return y;
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if_fast_math_real<T, Abi> fast_exp(const Vector<T, Abi> &x)
+{
+    return fast_exp_impl(x, has_fast_math<Abi>());
+}
+
+// fast_log {{{1
+template <typename V> Vc_INTRINSIC V fast_log_impl(const V &x, std::false_type)
+{
+    return Vc::log(x);
+}
+#ifdef Vc_IMPL_SSE
+// Detail::Const and Detail::exponent exist for SSE and AVX only
+template <typename V> Vc_INTRINSIC V fast_log_impl(const V &x, std::true_type)
+{
+    using T = typename V::EntryType;
+    using C = FastMathConstants<T>;
+    using C2 = Detail::Const<T, typename V::abi>;
+    // x = 2ᵉ·m with m ∈ [√½, √2[ as in Vc::log, and log(x) = e·ln(2) + 2·atanh(s) with
+    // s = (m - 1) / (m + 1). The division buys a polynomial in s² of much lower degree
+    // than the series in m - 1 that Vc::log uses.
+    const auto denormal = x <= C2::min();
+    V m = x;
+    m(denormal) *= T(std::uint64_t(1) << C::denormal_shift());
+    V e = Detail::exponent(m.data());
+    e(denormal) -= T(C::denormal_shift());
+    m.setZero(C2::exponentMask());
+    m = Detail::operator|(m, C2::_1_2());  // m ∈ [½, 1[
+    const auto small = m < C2::_1_sqrt2();
+    m(small) += m;
+    e(!small) += T(1);
+    const V s = (m - T(1)) / (m + T(1));  // m - 1 is exact
+    V r = fast_log_poly(s) + e * C::ln2_lo();
+    r += s + s;
+    r += e * C::ln2_hi();
+    r(!(x < std::numeric_limits<T>::infinity())) = x;  // +∞ and NaN
+    r(x < V::Zero()) = std::numeric_limits<T>::quiet_NaN();
+    r(x == V::Zero()) = -std::numeric_limits<T>::infinity();
+    return r;
+}
+#endif  // Vc_IMPL_SSE
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if_fast_math_real<T, Abi> fast_log(const Vector<T, Abi> &x)
+{
+    return fast_log_impl(x, has_fast_math<Abi>());
+}
+
+// fast_atan2 {{{1
+template <typename V>
+Vc_INTRINSIC V fast_atan2_impl(const V &y, const V &x, std::false_type)
+{
+    return Vc::atan2(y, x);
+}
+template <typename V>
+Vc_INTRINSIC V fast_atan2_impl(const V &y, const V &x, std::true_type)
+{
+    using T = typename V::EntryType;
+    using C = FastMathConstants<T>;
+    V ax = abs(x);
+    V ay = abs(y);
+    // two infinities yield the same angle as |x| = |y| = 1
+    const auto infinite = isinf(ax) && isinf(ay);
+    ax(infinite) = T(1);
+    ay(infinite) = T(1);
+    V lo = min(ax, ay);
+    V hi = max(ax, ay);
+    // keep lo + hi below overflow
+    const auto huge = hi > std::numeric_limits<T>::max() * T(0.25);
+    lo(huge) *= T(0.25);
+    hi(huge) *= T(0.25);
+
+    // atan(lo / hi) for lo / hi ∈ [0, 1]. Above √2 - 1 the identity
+    // atan(t) = π/4 + atan((t - 1) / (t + 1)) maps the argument to [1 - √2, 0], and
+    // (t - 1) / (t + 1) = (lo - hi) / (lo + hi) needs no additional division.
+    const auto upper = lo > hi * T(0.414213562373095048801688724209698079);
+    V num = lo;
+    V den = hi;
+    num(upper) = lo - hi;
+    den(upper) = lo + hi;
+    den(hi == V::Zero()) = T(1);  // atan2(±0, ±0)
+    const V p = fast_atan_poly(num / den);
+
+    // The octant reflections turn the result into j·π/4 ± p. Summing the multiple of π/4
+    // from a split constant last avoids accumulating the rounding of each reflection.
+    V j = V::Zero();
+    j(upper) = T(1);
+    V sign = T(1);
+    const auto swapped = ay > ax;
+    j(swapped) = T(2) - j;
+    sign(swapped) = T(-1);
+    const auto negative = isnegative(x);
+    j(negative) = T(4) - j;
+    sign(negative) = -sign;
+    V r = j * C::pi_4_lo() + sign * p;
+    r += j * C::pi_4_hi();  // exact product
+    r = copysign(r, y);
+    r(isnan(x) || isnan(y)) = x + y;
+    return r;
+}
+template <typename T, typename Abi>
+Vc_INTRINSIC enable_if_fast_math_real<T, Abi> fast_atan2(const Vector<T, Abi> &y,
+                                                         const Vector<T, Abi> &x)
+{
+    return fast_atan2_impl(y, x, has_fast_math<Abi>());
+}
+
+// SimdArray {{{1
+// applies the fast implementations to the native vectors a SimdArray consists of
+#define Vc_FAST_MATH_FORWARD(name_)                                                      \
+    struct ForwardFast_##name_ : public Common::Operations::tag {                        \
+        template <typename... Args,                                                      \
+                  typename = decltype(fast_##name_(std::declval<Args>()...))>            \
+        Vc_INTRINSIC void operator()(decltype(fast_##name_(std::declval<Args>()...)) &v, \
+                                     Args &&... args)                                    \
+        {                                                                                \
+            v = fast_##name_(std::forward<Args>(args)...);                               \
+        }                                                                                \
+    };                                                                                   \
+    template <typename T, std::size_t N, typename V, std::size_t M>                      \
+    Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, fixed_size_simd<T, N>>      \
+        fast_##name_(const SimdArray<T, N, V, M> &x)                                     \
+    {                                                                                    \
+        return fixed_size_simd<T, N>::fromOperation(ForwardFast_##name_(), x);           \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_FAST_MATH_FORWARD(sin);
+Vc_FAST_MATH_FORWARD(cos);
+Vc_FAST_MATH_FORWARD(exp);
+Vc_FAST_MATH_FORWARD(log);
+#undef Vc_FAST_MATH_FORWARD
+
+struct ForwardFast_atan2 : public Common::Operations::tag {
+    template <typename... Args,
+              typename = decltype(fast_atan2(std::declval<Args>()...))>
+    Vc_INTRINSIC void operator()(decltype(fast_atan2(std::declval<Args>()...)) &v,
+                                 Args &&... args)
+    {
+        v = fast_atan2(std::forward<Args>(args)...);
+    }
+};
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, fixed_size_simd<T, N>>
+fast_atan2(const SimdArray<T, N, V, M> &y, const SimdArray<T, N, V, M> &x)
+{
+    return fixed_size_simd<T, N>::fromOperation(ForwardFast_atan2(), y, x);
+}
+
+// MathPolicy {{{1
+template <precision P> struct MathPolicy;
+template <> struct MathPolicy<precision::precise> {
+    template <typename V>
+    static Vc_INTRINSIC auto sin(const V &x) -> decltype(Vc::sin(x)) { return Vc::sin(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto cos(const V &x) -> decltype(Vc::cos(x)) { return Vc::cos(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto exp(const V &x) -> decltype(Vc::exp(x)) { return Vc::exp(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto log(const V &x) -> decltype(Vc::log(x)) { return Vc::log(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto atan2(const V &y, const V &x) -> decltype(Vc::atan2(y, x))
+    {
+        return Vc::atan2(y, x);
+    }
+};
+template <> struct MathPolicy<precision::ulp4> {
+    template <typename V>
+    static Vc_INTRINSIC auto sin(const V &x) -> decltype(fast_sin(x)) { return fast_sin(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto cos(const V &x) -> decltype(fast_cos(x)) { return fast_cos(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto exp(const V &x) -> decltype(fast_exp(x)) { return fast_exp(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto log(const V &x) -> decltype(fast_log(x)) { return fast_log(x); }
+    template <typename V>
+    static Vc_INTRINSIC auto atan2(const V &y, const V &x) -> decltype(fast_atan2(y, x))
+    {
+        return fast_atan2(y, x);
+    }
+};
+//}}}1
+}  // namespace Detail
+
+/**
+ * \ingroup Math
+ *
+ * Faster variants of the math functions for code that tolerates a max. error of 4 ulp,
+ * e.g. graphics or ML inference. They use shorter minimax polynomials than the default
+ * implementations, and sin and cos reduce to a single polynomial on [-π/2, π/2] instead
+ * of evaluating the sine and cosine series. The functions are inline and branch-free on
+ * their main path.
+ *
+ * The fast variants apply to the SSE and AVX vectors and to SimdArray built from them.
+ * The Scalar and Generic ABIs call the default implementations.
+ *
+ * \see precision
+ */
+namespace fast
+{
+/**
+ * Returns the sine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 3 ulp (mean 0.21 ulp)
+ * in the range [-8192, 8192].
+ * \note The double-precision implementation has an error of max. 3 ulp (mean 0.18 ulp)
+ * in the range [-8192, 8192].
+ * \note Vectors with an entry outside of [-8192, 8192] use Vc::sin.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE auto sin(const V &x) -> decltype(Detail::fast_sin(x))
+{
+    return Detail::fast_sin(x);
+}
+
+/**
+ * Returns the cosine of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 3 ulp (mean 0.21 ulp)
+ * in the range [-8192, 8192].
+ * \note The double-precision implementation has an error of max. 3 ulp (mean 0.19 ulp)
+ * in the range [-8192, 8192].
+ * \note Vectors with an entry outside of [-8192, 8192] use Vc::cos.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE auto cos(const V &x) -> decltype(Detail::fast_cos(x))
+{
+    return Detail::fast_cos(x);
+}
+
+/**
+ * Returns \f$e^x\f$.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.06 ulp).
+ * \note The double-precision implementation has an error of max. 2 ulp (mean 0.06 ulp).
+ * \note Results below \f$2^{-125}\f$ (\f$2^{-1021}\f$ for double) may be flushed to
+ * zero, where Vc::exp returns denormals.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE auto exp(const V &x) -> decltype(Detail::fast_exp(x))
+{
+    return Detail::fast_exp(x);
+}
+
+/**
+ * Returns the natural logarithm of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 2 ulp (mean 0.12 ulp),
+ * including denormals.
+ * \note The double-precision implementation has an error of max. 3 ulp (mean 0.12 ulp),
+ * including denormals.
+ */
+template <typename V>
+Vc_ALWAYS_INLINE auto log(const V &x) -> decltype(Detail::fast_log(x))
+{
+    return Detail::fast_log(x);
+}
+
+/**
+ * Returns the angle of the point (\p x, \p y) with the same special values as Vc::atan2.
+ *
+ * \note The single-precision implementation has an error of max. 4 ulp (mean 0.17 ulp).
+ * \note The double-precision implementation has an error of max. 4 ulp (mean 0.15 ulp).
+ */
+template <typename V>
+Vc_ALWAYS_INLINE auto atan2(const V &y, const V &x) -> decltype(Detail::fast_atan2(y, x))
+{
+    return Detail::fast_atan2(y, x);
+}
+}  // namespace fast
+
+/**
+ * \ingroup Math
+ *
+ * Returns the sine of \p x with the accuracy selected by \p P, i.e.
+ * Vc::sin for precision::precise and Vc::fast::sin for precision::ulp4.
+ */
+template <precision P, typename V>
+Vc_ALWAYS_INLINE auto sin(const V &x) -> decltype(Detail::MathPolicy<P>::sin(x))
+{
+    return Detail::MathPolicy<P>::sin(x);
+}
+
+/// \ingroup Math
+/// Returns the cosine of \p x with the accuracy selected by \p P.
+template <precision P, typename V>
+Vc_ALWAYS_INLINE auto cos(const V &x) -> decltype(Detail::MathPolicy<P>::cos(x))
+{
+    return Detail::MathPolicy<P>::cos(x);
+}
+
+/// \ingroup Math
+/// Returns \f$e^x\f$ with the accuracy selected by \p P.
+template <precision P, typename V>
+Vc_ALWAYS_INLINE auto exp(const V &x) -> decltype(Detail::MathPolicy<P>::exp(x))
+{
+    return Detail::MathPolicy<P>::exp(x);
+}
+
+/// \ingroup Math
+/// Returns the natural logarithm of \p x with the accuracy selected by \p P.
+template <precision P, typename V>
+Vc_ALWAYS_INLINE auto log(const V &x) -> decltype(Detail::MathPolicy<P>::log(x))
+{
+    return Detail::MathPolicy<P>::log(x);
+}
+
+/// \ingroup Math
+/// Returns the angle of the point (\p x, \p y) with the accuracy selected by \p P.
+template <precision P, typename V>
+Vc_ALWAYS_INLINE auto atan2(const V &y, const V &x)
+    -> decltype(Detail::MathPolicy<P>::atan2(y, x))
+{
+    return Detail::MathPolicy<P>::atan2(y, x);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_FASTMATH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,159 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The tanh polynomials are taken from Cephes, which carries the
+following Copyright notice:
+
+Cephes Math Library Release 2.2:  June, 1992
+Copyright 1984, 1987, 1989 by Stephen L. Moshier
+Direct inquiries to 30 Frost Street, Cambridge, MA 02140
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// HyperbolicLimits {{{1
+template <typename T> struct HyperbolicLimits;
+template <> struct HyperbolicLimits<float> {
+    // sinh and cosh overflow beyond ln(2·max)
+    static constexpr float max() { return 89.41598629223294f; }
+};
+template <> struct HyperbolicLimits<double> {
+    static constexpr double max() { return 7.10475860073943942e2; }
+};
+
+// sinh_small {{{1
+// Returns sinh(x) for |x| ≤ 1.
+template <typename Abi> Vc_ALWAYS_INLINE Vector<float, Abi> sinh_small(Vector<float, Abi> x)
+{
+    const Vector<float, Abi> z = x * x;
+    return ((2.03721912945E-4f * z
+           + 8.33028376239E-3f) * z
+           + 1.66667160211E-1f) * z * x
+           + x;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> sinh_small(Vector<double, Abi> x)
+{
+    const Vector<double, Abi> z = x * x;
+    const Vector<double, Abi> p =
+        ((-7.89474443963537015605E-1 * z - 1.63725857525983828727E2) * z -
+         1.15614435765005216044E4) * z -
+        3.51754964808151394800E5;
+    const Vector<double, Abi> q =
+        ((z - 2.77711081420602794433E2) * z + 3.61578279834431989373E4) * z -
+        2.11052978884890840399E6;
+    return x + x * z * p / q;
+}
+
+// tanh_small {{{1
+// Returns tanh(x) for |x| < 0.625.
+template <typename Abi> Vc_ALWAYS_INLINE Vector<float, Abi> tanh_small(Vector<float, Abi> x)
+{
+    const Vector<float, Abi> z = x * x;
+    return ((((-5.70498872745E-3f * z
+              + 2.06390887954E-2f) * z
+              - 5.37397155531E-2f) * z
+              + 1.33314422036E-1f) * z
+              - 3.33332819422E-1f) * z * x
+              + x;
+}
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> tanh_small(Vector<double, Abi> x)
+{
+    const Vector<double, Abi> z = x * x;
+    const Vector<double, Abi> p =
+        (-9.64399179425052238628E-1 * z - 9.92877231001918586564E1) * z -
+        1.61468768441708447952E3;
+    const Vector<double, Abi> q =
+        ((z + 1.12811678491632931402E2) * z + 2.23548839060100448583E3) * z +
+        4.84406305325125486048E3;
+    return x + x * z * p / q;
+}
+//}}}1
+}  // namespace Detail
+
+// sinh {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> sinh(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using L = Detail::HyperbolicLimits<T>;
+
+    // sinh(a) = eᵃ / 2 - 1 / (4 · eᵃ / 2), where eᵃ / 2 overflows only where sinh does
+    const V a = abs(x);
+    const V h = Detail::exp_scaled(min(a, V(L::max())), -1);
+    V r = h - T(0.25) / h;
+    r(a > L::max()) = std::numeric_limits<T>::infinity();
+    r = copysign(r, x);
+    const auto small = a <= T(1);
+    if (any_of(small)) {
+        // the subtraction cancels for small a
+        r(small) = Detail::sinh_small(x);
+    }
+    r(isnan(x)) = x;
+    return r;
+}
+
+// cosh {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> cosh(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using L = Detail::HyperbolicLimits<T>;
+
+    // cosh(a) = eᵃ / 2 + 1 / (4 · eᵃ / 2)
+    const V a = abs(x);
+    const V h = Detail::exp_scaled(min(a, V(L::max())), -1);
+    V r = h + T(0.25) / h;
+    r(a > L::max()) = std::numeric_limits<T>::infinity();
+    r(isnan(x)) = x;
+    return r;
+}
+
+// tanh {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> tanh(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+
+    // tanh(a) = 1 - 2 / (e²ᵃ + 1), which saturates at 1 once e²ᵃ overflows
+    const V a = abs(x);
+    V r = T(1) - T(2) / (expm1(a + a) + T(2));
+    r = copysign(r, x);
+    const auto small = a < T(0.625);
+    if (any_of(small)) {
+        // the subtraction cancels for small a; evaluating on a keeps the sign of -0
+        r(small) = copysign(Detail::tanh_small(a), x);
+    }
+    return r;
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
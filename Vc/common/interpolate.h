@@ -0,0 +1,308 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_INTERPOLATE_H_
+#define VC_COMMON_INTERPOLATE_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+/**
+ * \ingroup Math
+ * Selects how Vc::interpolate computes values between the samples of a Table.
+ */
+enum class Interpolation {
+    /// Linear interpolation between the two neighbouring samples.
+    Linear,
+    /// Catmull-Rom spline through the four surrounding samples. It passes through the
+    /// samples and has a continuous first derivative.
+    Cubic
+};
+
+/**
+ * \ingroup Math
+ * A function tabulated at the equidistant points \f$x_0 + i\,\Delta x\f$, for use with
+ * Vc::interpolate.
+ *
+ * The table refers to the samples; it does not copy them and they must outlive it. Small
+ * tables (up to 64 bytes) are also copied into the Table object, so that interpolate can
+ * keep them in registers and use permutes instead of gathers.
+ *
+ * \code
+ * const float samples[64] = {...};  // f(0), f(0.25), f(0.5), ...
+ * const Vc::Table<float> table(samples, 64, 0.f, 0.25f);
+ * float_v y = Vc::interpolate(table, x);
+ * \endcode
+ */
+template <typename T> class Table
+{
+    static_assert(std::is_floating_point<T>::value,
+                  "Vc::Table requires a floating-point sample type");
+
+public:
+    /// The number of samples that fit into the copy held by the object.
+    static constexpr std::size_t small_capacity = 64 / sizeof(T);
+
+    /**
+     * Refers to the \p size samples at \p data, the first at \p x0 and the others at
+     * steps of \p dx. \p size must be at least 2.
+     */
+    Table(const T *data, std::size_t size, T x0 = 0, T dx = 1)
+        : m_data(data), m_size(size), m_x0(x0), m_dx(dx), m_inv_dx(T(1) / dx)
+    {
+        Vc_ASSERT(size >= 2);
+        for (std::size_t i = 0; i < small_capacity; ++i) {
+            m_small[i] = i < size ? data[i] : T();
+        }
+    }
+
+    const T *data() const { return m_data; }
+    std::size_t size() const { return m_size; }
+    T x0() const { return m_x0; }
+    T dx() const { return m_dx; }
+    /// \internal 1 / dx
+    T inverse_dx() const { return m_inv_dx; }
+    /// \internal The first small_capacity samples, zero-padded.
+    const T *small_data() const { return m_small; }
+
+private:
+    const T *m_data;
+    std::size_t m_size;
+    T m_x0, m_dx, m_inv_dx;
+    T m_small[small_capacity];
+};
+
+namespace Detail
+{
+// GatherLookup {{{1
+// Looks up table entries with the gather of V, i.e. hardware gathers where available.
+template <typename V> struct GatherLookup {
+    const typename V::EntryType *data;
+    Vc_INTRINSIC V operator()(const typename V::IndexType &i) const { return V(data, i); }
+};
+
+// RegisterLookup {{{1
+// Holds a table of up to `capacity` entries in registers and looks up entries with
+// permutes. Without a specialization for V the capacity is 0 and interpolate always uses
+// GatherLookup.
+template <typename V, typename = void> struct RegisterLookup {
+    static constexpr std::size_t capacity = 0;
+    explicit RegisterLookup(const typename V::EntryType *) {}
+    Vc_INTRINSIC V operator()(const typename V::IndexType &) const { return V(); }
+};
+
+#ifdef Vc_IMPL_SSSE3
+// pshufb uses the low four bits of the byte indexes, i.e. the entry index modulo the
+// entries per register. Both registers are shuffled and the result selected by the index.
+Vc_INTRINSIC __m128i table_byte_offsets(__m128i idx, float)
+{
+    const __m128i b = _mm_shuffle_epi8(
+        _mm_slli_epi32(idx, 2), _mm_setr_epi8(0, 0, 0, 0, 4, 4, 4, 4, 8, 8, 8, 8, 12, 12, 12, 12));
+    return _mm_add_epi8(b, _mm_setr_epi8(0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3, 0, 1, 2, 3));
+}
+Vc_INTRINSIC __m128i table_byte_offsets(__m128i idx, double)
+{
+    const __m128i b = _mm_shuffle_epi8(
+        _mm_slli_epi32(idx, 3), _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4));
+    return _mm_add_epi8(b, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 0, 1, 2, 3, 4, 5, 6, 7));
+}
+Vc_INTRINSIC __m128i table_upper_half(__m128i idx, float)
+{
+    return _mm_cmpgt_epi32(idx, _mm_set1_epi32(3));
+}
+Vc_INTRINSIC __m128i table_upper_half(__m128i idx, double)
+{
+    return _mm_shuffle_epi32(_mm_cmpgt_epi32(idx, _mm_set1_epi32(1)), 0x50);
+}
+
+template <typename T>
+struct RegisterLookup<Vector<T, VectorAbi::Sse>,
+                      enable_if<std::is_floating_point<T>::value, void>> {
+    using V = Vector<T, VectorAbi::Sse>;
+    static constexpr std::size_t capacity = 2 * V::Size;
+    __m128i lo, hi;
+
+    explicit RegisterLookup(const T *data)
+        : lo(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data)))
+        , hi(_mm_loadu_si128(reinterpret_cast<const __m128i *>(data + V::Size)))
+    {
+    }
+
+    Vc_INTRINSIC V operator()(const typename V::IndexType &i) const
+    {
+        const __m128i idx = simd_cast<SSE::int_v>(i).data();
+        const __m128i bytes = table_byte_offsets(idx, T());
+        const __m128i upper = table_upper_half(idx, T());
+        const __m128i r = _mm_or_si128(_mm_andnot_si128(upper, _mm_shuffle_epi8(lo, bytes)),
+                                       _mm_and_si128(upper, _mm_shuffle_epi8(hi, bytes)));
+        return SSE::sse_cast<typename V::VectorType>(r);
+    }
+};
+#endif  // Vc_IMPL_SSSE3
+
+#ifdef Vc_IMPL_AVX2
+// vpermps uses the low three bits of the indexes, i.e. the entry index modulo 8. A double
+// is looked up as its two 32-bit halves.
+Vc_INTRINSIC __m256i table_word_indexes(const AVX2::float_v::IndexType &i, __m256i &upper,
+                                        float)
+{
+    const __m256i idx = simd_cast<AVX2::int_v>(i).data();
+    upper = _mm256_cmpgt_epi32(idx, _mm256_set1_epi32(7));
+    return idx;
+}
+Vc_INTRINSIC __m256i table_word_indexes(const AVX2::double_v::IndexType &i, __m256i &upper,
+                                        double)
+{
+    const __m256i q = _mm256_cvtepi32_epi64(simd_cast<SSE::int_v>(i).data());
+    upper = _mm256_cmpgt_epi64(q, _mm256_set1_epi64x(3));
+    return _mm256_add_epi32(_mm256_or_si256(_mm256_slli_epi64(q, 1), _mm256_slli_epi64(q, 33)),
+                            _mm256_set1_epi64x(1ll << 32));
+}
+
+template <typename T>
+struct RegisterLookup<Vector<T, VectorAbi::Avx>,
+                      enable_if<std::is_floating_point<T>::value, void>> {
+    using V = Vector<T, VectorAbi::Avx>;
+    static constexpr std::size_t capacity = 2 * V::Size;
+    __m256 lo, hi;
+
+    explicit RegisterLookup(const T *data)
+        : lo(_mm256_loadu_ps(reinterpret_cast<const float *>(data)))
+        , hi(_mm256_loadu_ps(reinterpret_cast<const float *>(data + V::Size)))
+    {
+    }
+
+    Vc_INTRINSIC V operator()(const typename V::IndexType &i) const
+    {
+        __m256i upper;
+        const __m256i words = table_word_indexes(i, upper, T());
+        const __m256 r = _mm256_blendv_ps(_mm256_permutevar8x32_ps(lo, words),
+                                          _mm256_permutevar8x32_ps(hi, words),
+                                          _mm256_castsi256_ps(upper));
+        return AVX::avx_cast<typename V::VectorType>(r);
+    }
+};
+#endif  // Vc_IMPL_AVX2
+
+// table_index {{{1
+// Converts the (integral) segment numbers to the index type of V.
+template <typename IV, typename V> Vc_INTRINSIC IV table_index(const V &segment)
+{
+    return simd_cast<IV>(segment);
+}
+#ifdef Vc_USE_BUILTIN_VECTOR_TYPES
+// there is no simd_cast from Generic::Vector to fixed_size_simd
+template <typename IV, typename T>
+Vc_INTRINSIC IV table_index(const Generic::Vector<T> &segment)
+{
+    return IV([&](int i) { return int(segment[i]); });
+}
+#endif
+
+// interpolate_segment {{{1
+// Evaluates the interpolation between sample i and i + 1 at t ∈ [0, 1].
+template <typename V, typename Lookup>
+Vc_INTRINSIC V interpolate_segment(
+    std::integral_constant<Interpolation, Interpolation::Linear>, const V &t,
+    const typename V::IndexType &i, std::size_t, const Lookup &lookup)
+{
+    const V a = lookup(i);
+    const V b = lookup(i + 1);
+    return polynomial_fma(t, b - a, a);
+}
+
+template <typename V, typename Lookup>
+Vc_INTRINSIC V interpolate_segment(
+    std::integral_constant<Interpolation, Interpolation::Cubic>, const V &t,
+    const typename V::IndexType &i, std::size_t size, const Lookup &lookup)
+{
+    using T = typename V::EntryType;
+    using IV = typename V::IndexType;
+    // the samples outside of the table repeat the first and last sample
+    const V p0 = lookup(Vc::max(i - 1, IV(0)));
+    const V p1 = lookup(i);
+    const V p2 = lookup(i + 1);
+    const V p3 = lookup(Vc::min(i + 2, IV(int(size - 1))));
+    return horner(t, p1, T(0.5) * (p2 - p0),
+                  p0 - T(2.5) * p1 + T(2) * p2 - T(0.5) * p3,
+                  T(0.5) * (p3 - p0) + T(1.5) * (p1 - p2));
+}
+
+// interpolate_impl {{{1
+template <Interpolation I, typename V, typename T, typename Lookup>
+Vc_INTRINSIC V interpolate_impl(const V &x, const Table<T> &table, const Lookup &lookup)
+{
+    using IV = typename V::IndexType;
+    const T last = T(table.size() - 1);
+    // clamp to [0, size - 1]; the comparisons are false for NaN, which thus cannot turn
+    // into an out-of-bounds index
+    const V scaled = (x - table.x0()) * table.inverse_dx();
+    const V nonnegative = iif(scaled > T(0), scaled, V(T(0)));
+    const V u = iif(nonnegative < last, nonnegative, V(last));
+    const V segment = Vc::min(floor(u), V(last - 1));
+    V r = interpolate_segment(std::integral_constant<Interpolation, I>(), u - segment,
+                              table_index<IV>(segment), table.size(), lookup);
+    where(isnan(x)) | r = x;
+    return r;
+}
+}  // namespace Detail
+
+// interpolate {{{1
+/**
+ * \ingroup Math
+ * Returns the values of the function tabulated in \p table at \p x.
+ *
+ * Arguments outside of the tabulated range are clamped to it, i.e. they return the first
+ * or last sample. NaN arguments return NaN.
+ *
+ * Entries are looked up with the gather of \p V, which uses the AVX2 gather instructions
+ * where available. Tables that fit into two registers of \p V use permutes instead (with
+ * SSSE3 for the SSE types and AVX2 for the AVX types).
+ *
+ * \tparam I Selects linear (the default) or cubic interpolation.
+ * \param table The samples.
+ * \param x The arguments.
+ */
+template <Interpolation I = Interpolation::Linear, typename T, typename V>
+Vc_INTRINSIC enable_if<(Traits::is_simd_vector<V>::value &&
+                        std::is_same<typename V::EntryType, T>::value),
+                       V>
+interpolate(const Table<T> &table, const V &x)
+{
+    using Registers = Detail::RegisterLookup<V>;
+    if (table.size() <= Registers::capacity) {
+        return Detail::interpolate_impl<I>(x, table, Registers(table.small_data()));
+    }
+    return Detail::interpolate_impl<I>(x, table, Detail::GatherLookup<V>{table.data()});
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_INTERPOLATE_H_
+
+// vim: foldmethod=marker
@@ -273,4 +273,18 @@ Vc_INTRINSIC Vc_CONST Vector<T, detail::not_fixed_size_abi<Abi>> log2(
     return Detail::LogImpl<Base2>::calc<T, Abi>(x);
 }
 
+template <typename T, typename Abi>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> log1p(const Vector<T, Abi> &x)
+{
+    typedef Vector<T, Abi> V;
+    // log(1 + x) = log(u) + (x - (u - 1)) / u with u = 1 + x, where the second term
+    // corrects for the rounding of u (Goldberg)
+    const V u = V::One() + x;
+    V r = log(u) + (x - (u - V::One())) / u;
+    // the correction is NaN for u = 0 and u = +∞; and keep the sign of zero
+    r(u == V::Zero()) = -std::numeric_limits<T>::infinity();
+    r(x == V::Zero() || x == std::numeric_limits<T>::infinity()) = x;
+    return r;
+}
+
 #endif // Vc_COMMON_MATH_H_INTERNAL
@@ -36,6 +36,8 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <initializer_list>
 #include "memoryfwd.h"
 #include "malloc.h"
+#include "allocationpolicy.h"
+#include "arena.h"
 #include "macros.h"
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -63,7 +65,7 @@ template<typename V, size_t Size> struct _MemorySizeCalculation
  * \param Size1 Number of rows
  * \param Size2 Number of columns
  */
-template <typename V, size_t Size1, size_t Size2, bool InitPadding>
+template <typename V, size_t Size1, size_t Size2, bool InitPadding, typename Allocation>
 #ifdef Vc_RECURSIVE_MEMORY
 class Memory : public MemoryBase<V, Memory<V, Size1, Size2, InitPadding>, 2,
                                  Memory<V, Size2, 0, InitPadding>>
@@ -222,7 +224,7 @@ private:
      * \headerfile memory.h <Vc/Memory>
      */
 template <typename V, size_t Size, bool InitPadding>
-class Memory<V, Size, 0u, InitPadding> :
+class Memory<V, Size, 0u, InitPadding, void> :
 #ifndef Vc_RECURSIVE_MEMORY
     public AlignedBase<V::MemoryAlignment>,
 #endif
@@ -342,6 +344,14 @@ class Memory<V, Size, 0u, InitPadding> :
                 std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
                 return *this;
             }
+            /**
+             * Evaluates the expression \p e in a single loop, see MemoryExpression.
+             */
+            template <typename Op, typename L, typename R>
+            Vc_ALWAYS_INLINE Memory &operator=(const MemoryExpression<V, Op, L, R> &e)
+            {
+                return Base::assign(e);
+            }
             inline Memory &operator=(const V &v) {
                 for (size_t i = 0; i < vectorsCount(); ++i) {
                     vector(i) = v;
@@ -383,21 +393,32 @@ class Memory<V, Size, 0u, InitPadding> :
      * the \c __restrict__ keyword you need to use a standard pointer to memory and do the vector
      * address calculation and loads and stores manually.
      *
+     * The memory is obtained from the allocation policy \p Allocation. Use e.g.
+     * Vc::TransparentHugePages or Vc::ParallelFirstTouch<Vc::NumaInterleave<>> for large
+     * arrays:
+     * \code
+        Vc::Memory<float_v, 0, 0, true, Vc::TransparentHugePages> data(1 << 24);
+     * \endcode
+     *
      * \param V The vector type you want to operate on. (e.g. float_v or uint_v)
+     * \param Allocation The allocation policy. Defaults to Vc::AlignedAllocation<>, the policy
+     *                   of Vc::malloc.
      *
      * \see Memory<V, Size>
      *
      * \ingroup Containers
      * \headerfile memory.h <Vc/Memory>
      */
-    template<typename V> class Memory<V, 0u, 0u, true> : public MemoryBase<V, Memory<V, 0u, 0u, true>, 1, void>
+    template <typename V, typename Allocation>
+    class Memory<V, 0u, 0u, true, Allocation>
+        : public MemoryBase<V, Memory<V, 0u, 0u, true, Allocation>, 1, void>
     {
         public:
             typedef typename V::EntryType EntryType;
         private:
-            typedef MemoryBase<V, Memory<V>, 1, void> Base;
-            friend class MemoryBase<V, Memory<V>, 1, void>;
-            friend class MemoryDimensionBase<V, Memory<V>, 1, void>;
+            typedef MemoryBase<V, Memory, 1, void> Base;
+            friend class MemoryBase<V, Memory, 1, void>;
+            friend class MemoryDimensionBase<V, Memory, 1, void>;
         enum InternalConstants {
             Alignment = V::Size,
             AlignmentMask = Alignment - 1
@@ -423,7 +444,7 @@ class Memory<V, Size, 0u, InitPadding> :
         Vc_ALWAYS_INLINE Memory(size_t size)
             : m_entriesCount(size),
             m_vectorsCount(calcPaddedEntriesCount(m_entriesCount)),
-            m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount))
+            m_mem(Vc::malloc<EntryType, Allocation>(m_vectorsCount))
         {
             m_vectorsCount /= V::Size;
             Base::lastVector() = V::Zero();
@@ -440,11 +461,25 @@ class Memory<V, Size, 0u, InitPadding> :
         Vc_ALWAYS_INLINE Memory(const MemoryBase<V, Parent, 1, RM> &rhs)
             : m_entriesCount(rhs.entriesCount()),
             m_vectorsCount(rhs.vectorsCount()),
-            m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount * V::Size))
+            m_mem(Vc::malloc<EntryType, Allocation>(m_vectorsCount * V::Size))
         {
             Detail::copyVectors(*this, rhs);
         }
 
+        /**
+         * Allocate memory for the result of the expression \p e and evaluate it.
+         *
+         * \param e The MemoryExpression to evaluate, e.g. \c b * c + d.
+         */
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Memory(const MemoryExpression<V, Op, L, R> &e)
+            : m_entriesCount(e.entriesCount()),
+            m_vectorsCount(e.vectorsCount()),
+            m_mem(Vc::malloc<EntryType, Allocation>(m_vectorsCount * V::Size))
+        {
+            Base::assign(e);
+        }
+
         /**
          * Overload of the above function.
          *
@@ -455,7 +490,7 @@ class Memory<V, Size, 0u, InitPadding> :
         Vc_ALWAYS_INLINE Memory(const Memory &rhs)
             : m_entriesCount(rhs.entriesCount()),
             m_vectorsCount(rhs.vectorsCount()),
-            m_mem(Vc::malloc<EntryType, Vc::AlignOnVector>(m_vectorsCount * V::Size))
+            m_mem(Vc::malloc<EntryType, Allocation>(m_vectorsCount * V::Size))
         {
             Detail::copyVectors(*this, rhs);
         }
@@ -465,7 +500,7 @@ class Memory<V, Size, 0u, InitPadding> :
          */
         Vc_ALWAYS_INLINE ~Memory()
         {
-            Vc::free(m_mem);
+            Vc::free<Allocation>(m_mem, m_vectorsCount * V::Size);
         }
 
         /**
@@ -524,6 +559,18 @@ class Memory<V, Size, 0u, InitPadding> :
             std::memcpy(m_mem, rhs, entriesCount() * sizeof(EntryType));
             return *this;
         }
+
+        /**
+         * Overwrite all entries with the result of the expression \p e, evaluated in a single
+         * loop (see MemoryExpression).
+         *
+         * \note this function requires the vectorsCount() of \p e to be equal.
+         */
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Memory &operator=(const MemoryExpression<V, Op, L, R> &e)
+        {
+            return Base::assign(e);
+        }
 };
 
 /**
@@ -614,7 +661,12 @@ using Common::prefetchFar;
 
 namespace std
 {
-    template<typename V> Vc_ALWAYS_INLINE void swap(Vc::Memory<V> &a, Vc::Memory<V> &b) { a.swap(b); }
+    template <typename V, typename Allocation>
+    Vc_ALWAYS_INLINE void swap(Vc::Memory<V, 0u, 0u, true, Allocation> &a,
+                               Vc::Memory<V, 0u, 0u, true, Allocation> &b)
+    {
+        a.swap(b);
+    }
 } // namespace std
 
 #endif // VC_COMMON_MEMORY_H_
@@ -202,6 +202,8 @@ public:
     MemoryVectorIterator<V, Flags> begin() const { return &m_parent->vector(m_first   , Flags()); }
     MemoryVectorIterator<V, Flags> end() const   { return &m_parent->vector(m_last + 1, Flags()); }
 };/*}}}*/
+template <typename V, typename Op, typename L, typename R> class MemoryExpression;
+
 template<typename V, typename Parent, int Dimension, typename RowMemory> class MemoryDimensionBase;
 template<typename V, typename Parent, typename RowMemory> class MemoryDimensionBase<V, Parent, 1, RowMemory> // {{{1
 {
@@ -611,6 +613,52 @@ template<typename V, typename Parent, int Dimension, typename RowMemory> class M
             for (size_t i = 0; i < vectorsCount(); ++i) {
                 vector(i) = std::forward<U>(x);
             }
+            return static_cast<Parent &>(*this);
+        }
+
+        /**
+         * Evaluates the expression \p e in a single loop over all vectors and stores the
+         * result. The loads of the Memory operands of \p e and the stores use the load/store
+         * flags \p f, e.g. Vc::Aligned | Vc::Streaming for non-temporal stores of an array
+         * that is not read again soon, or Vc::Aligned | Vc::PrefetchDefault.
+         *
+         * \note this function requires the vectorsCount() of \p e to be equal.
+         */
+        template <typename Op, typename L, typename R, typename Flags = AlignedTag>
+        Vc_ALWAYS_INLINE Parent &assign(const MemoryExpression<V, Op, L, R> &e,
+                                        Flags f = Flags())
+        {
+            assert(vectorsCount() == e.vectorsCount());
+            const size_t n = vectorsCount();
+            for (size_t i = 0; i < n; ++i) {
+                vector(i, f) = e.vector(i, f);
+            }
+            return static_cast<Parent &>(*this);
+        }
+
+        /**
+         * Fused versions of the compound assignment operators: evaluate \p e and update the
+         * array in a single loop.
+         */
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Parent &operator+=(const MemoryExpression<V, Op, L, R> &e)
+        {
+            return assign(*this + e);
+        }
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Parent &operator-=(const MemoryExpression<V, Op, L, R> &e)
+        {
+            return assign(*this - e);
+        }
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Parent &operator*=(const MemoryExpression<V, Op, L, R> &e)
+        {
+            return assign(*this * e);
+        }
+        template <typename Op, typename L, typename R>
+        Vc_ALWAYS_INLINE Parent &operator/=(const MemoryExpression<V, Op, L, R> &e)
+        {
+            return assign(*this / e);
         }
 
         /**
@@ -802,18 +850,21 @@ inline void copyVectors(MemoryBase<V, ParentL, Dimension, RowMemoryL> &dst,
                         const MemoryBase<V, ParentR, Dimension, RowMemoryR> &src)
 {
     const size_t vectorsCount = dst.vectorsCount();
-    size_t i = 3;
-    for (; i < vectorsCount; i += 4) {
-        const V tmp3 = src.vector(i - 3);
-        const V tmp2 = src.vector(i - 2);
-        const V tmp1 = src.vector(i - 1);
-        const V tmp0 = src.vector(i - 0);
-        dst.vector(i - 3) = tmp3;
-        dst.vector(i - 2) = tmp2;
-        dst.vector(i - 1) = tmp1;
-        dst.vector(i - 0) = tmp0;
+    // with an explicit bound for the unrolled loop GCC does not assume that i may wrap
+    // around (-Waggressive-loop-optimizations false positive)
+    const size_t unrolledCount = vectorsCount & ~size_t(3);
+    size_t i = 0;
+    for (; i < unrolledCount; i += 4) {
+        const V tmp0 = src.vector(i + 0);
+        const V tmp1 = src.vector(i + 1);
+        const V tmp2 = src.vector(i + 2);
+        const V tmp3 = src.vector(i + 3);
+        dst.vector(i + 0) = tmp0;
+        dst.vector(i + 1) = tmp1;
+        dst.vector(i + 2) = tmp2;
+        dst.vector(i + 3) = tmp3;
     }
-    for (i -= 3; i < vectorsCount; ++i) {
+    for (; i < vectorsCount; ++i) {
         dst.vector(i) = src.vector(i);
     }
 }
@@ -822,6 +873,8 @@ inline void copyVectors(MemoryBase<V, ParentL, Dimension, RowMemoryL> &dst,
 }  // namespace Common
 }  // namespace Vc
 
+#include "memoryexpression.h"
+
 #endif // VC_COMMON_MEMORYBASE_H_
 
 // vim: foldmethod=marker
@@ -0,0 +1,300 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_MEMORYEXPRESSION_H_
+#define VC_COMMON_MEMORYEXPRESSION_H_
+
+#include <assert.h>
+#include <cstddef>
+#include <type_traits>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/*dox{{{*/
+/**
+ * \internal
+ * \headerfile memoryexpression.h <Vc/Memory>
+ *
+ * Operand of a MemoryExpression that reads the vectors of a one-dimensional Memory object.
+ *//*}}}*/
+template <typename V, typename Parent> class MemoryLeaf  //{{{1
+{
+    const MemoryBase<V, Parent, 1, void> &m_mem;
+
+public:
+    typedef V VectorType;
+    static constexpr bool IsBroadcast = false;
+
+    Vc_ALWAYS_INLINE MemoryLeaf(const MemoryBase<V, Parent, 1, void> &mem) : m_mem(mem) {}
+
+    Vc_ALWAYS_INLINE size_t entriesCount() const { return m_mem.entriesCount(); }
+    Vc_ALWAYS_INLINE size_t vectorsCount() const { return m_mem.vectorsCount(); }
+
+    template <typename Flags> Vc_ALWAYS_INLINE V vector(size_t i, Flags f) const
+    {
+        return m_mem.vector(i, f);
+    }
+};
+
+/**
+ * \internal
+ * Operand of a MemoryExpression that yields the same vector for every index.
+ */
+template <typename V> class MemoryBroadcast  //{{{1
+{
+    const V m_value;
+
+public:
+    typedef V VectorType;
+    static constexpr bool IsBroadcast = true;
+
+    Vc_ALWAYS_INLINE MemoryBroadcast(const V &value) : m_value(value) {}
+
+    template <typename Flags> Vc_ALWAYS_INLINE V vector(size_t, Flags) const
+    {
+        return m_value;
+    }
+};
+
+namespace Detail
+{
+// operation functors {{{1
+struct MemoryPlus {
+    template <typename V> Vc_ALWAYS_INLINE V operator()(const V &a, const V &b) const
+    {
+        return a + b;
+    }
+};
+struct MemoryMinus {
+    template <typename V> Vc_ALWAYS_INLINE V operator()(const V &a, const V &b) const
+    {
+        return a - b;
+    }
+};
+struct MemoryMultiplies {
+    template <typename V> Vc_ALWAYS_INLINE V operator()(const V &a, const V &b) const
+    {
+        return a * b;
+    }
+};
+struct MemoryDivides {
+    template <typename V> Vc_ALWAYS_INLINE V operator()(const V &a, const V &b) const
+    {
+        return divide(a, b, std::is_integral<typename V::EntryType>());
+    }
+
+private:
+    template <typename V>
+    static Vc_ALWAYS_INLINE V divide(const V &a, const V &b, std::false_type)
+    {
+        return a / b;
+    }
+    // The zero padding of the last vector must not trap. Division by zero is undefined for
+    // the other entries, so replacing the divisor by 1 is as good as any result.
+    template <typename V>
+    static Vc_ALWAYS_INLINE V divide(const V &a, const V &b, std::true_type)
+    {
+        return a / Vc::iif(b == V::Zero(), V(typename V::EntryType(1)), b);
+    }
+};
+
+// sizeOperand {{{1
+// returns the operand that determines the size of the expression: broadcasts have none
+template <typename L, typename R>
+Vc_ALWAYS_INLINE const L &sizeOperand(const L &l, const R &, std::false_type)
+{
+    return l;
+}
+template <typename L, typename R>
+Vc_ALWAYS_INLINE const R &sizeOperand(const L &, const R &r, std::true_type)
+{
+    return r;
+}
+
+// haveEqualSize {{{1
+template <typename L, typename R>
+Vc_ALWAYS_INLINE bool haveEqualSize(const L &l, const R &r, std::false_type)
+{
+    return l.vectorsCount() == r.vectorsCount();
+}
+template <typename L, typename R>
+Vc_ALWAYS_INLINE bool haveEqualSize(const L &, const R &, std::true_type)
+{
+    return true;
+}
+//}}}1
+}  // namespace Detail
+
+/*dox{{{*/
+/**
+ * \headerfile memoryexpression.h <Vc/Memory>
+ *
+ * A lazily evaluated, element-wise operation on one-dimensional Memory objects.
+ *
+ * The arithmetic operators on Memory objects (and on the results of these operators) do not
+ * compute anything. They build a MemoryExpression tree that is evaluated by a single loop
+ * over the vectors once it is assigned to a Memory object:
+ * \code
+ * Vc::Memory<float_v> a(N), b(N), c(N), d(N);
+ * a = b * c + d;                                  // one pass, no temporaries
+ * a.assign(b * c + d, Vc::Aligned | Vc::Streaming); // with non-temporal stores
+ * a += 2.f * b;
+ * \endcode
+ *
+ * Operands can be Memory objects of the same vector type \p V and size, expressions,
+ * vectors of type \p V, and scalars. A scalar (or vector) is broadcast to every vector of the
+ * expression.
+ *
+ * The expression stores references to its Memory operands. It must not outlive them.
+ *
+ * \note The operation is applied to the padding entries of the last vector as well. Integer
+ * division therefore treats a zero divisor as 1 instead of trapping.
+ *//*}}}*/
+template <typename V, typename Op, typename L, typename R> class MemoryExpression  //{{{1
+{
+    static_assert(!(L::IsBroadcast && R::IsBroadcast),
+                  "a MemoryExpression requires at least one Memory operand");
+    const L m_l;
+    const R m_r;
+
+    Vc_ALWAYS_INLINE auto sizeOperand() const
+        -> decltype(Detail::sizeOperand(m_l, m_r, std::integral_constant<bool, L::IsBroadcast>()))
+    {
+        return Detail::sizeOperand(m_l, m_r, std::integral_constant<bool, L::IsBroadcast>());
+    }
+
+public:
+    typedef V VectorType;
+    static constexpr bool IsBroadcast = false;
+
+    Vc_ALWAYS_INLINE MemoryExpression(const L &l, const R &r) : m_l(l), m_r(r)
+    {
+        assert(Detail::haveEqualSize(
+            l, r, std::integral_constant<bool, L::IsBroadcast || R::IsBroadcast>()));
+    }
+
+    /// The number of scalar entries of the Memory operands.
+    Vc_ALWAYS_INLINE size_t entriesCount() const { return sizeOperand().entriesCount(); }
+    /// The number of vectors of the Memory operands.
+    Vc_ALWAYS_INLINE size_t vectorsCount() const { return sizeOperand().vectorsCount(); }
+
+    /**
+     * Evaluates the \p i-th vector of the expression. Memory operands are loaded with the
+     * load/store flags \p f.
+     */
+    template <typename Flags = AlignedTag>
+    Vc_ALWAYS_INLINE V vector(size_t i, Flags f = Flags()) const
+    {
+        return Op()(m_l.vector(i, f), m_r.vector(i, f));
+    }
+};
+
+namespace Detail
+{
+// memoryOperand {{{1
+template <typename V, typename Parent>
+Vc_ALWAYS_INLINE MemoryLeaf<V, Parent> memoryOperand(const MemoryBase<V, Parent, 1, void> &m)
+{
+    return m;
+}
+template <typename V, typename Op, typename L, typename R>
+Vc_ALWAYS_INLINE const MemoryExpression<V, Op, L, R> &memoryOperand(
+    const MemoryExpression<V, Op, L, R> &e)
+{
+    return e;
+}
+
+// memoryBroadcast {{{1
+/**\internal
+ * Wraps \p x as broadcast operand for the Memory operand \p e.
+ */
+template <typename E, typename T>
+Vc_ALWAYS_INLINE typename std::enable_if<
+    std::is_convertible<T, typename E::VectorType>::value,
+    MemoryBroadcast<typename E::VectorType>>::type
+memoryBroadcast(const E &, const T &x)
+{
+    return typename E::VectorType(x);
+}
+
+// makeMemoryExpression {{{1
+template <typename Op, typename L, typename R>
+Vc_ALWAYS_INLINE typename std::enable_if<
+    std::is_same<typename L::VectorType, typename R::VectorType>::value,
+    MemoryExpression<typename L::VectorType, Op, L, R>>::type
+makeMemoryExpression(const L &l, const R &r)
+{
+    return {l, r};
+}
+//}}}1
+}  // namespace Detail
+
+// operators {{{1
+#define Vc_MEMORY_EXPRESSION_OPERATOR(op_, Op_)                                         \
+    template <typename L, typename R>                                                    \
+    Vc_ALWAYS_INLINE auto operator op_(const L &l, const R &r)                           \
+        ->decltype(Detail::makeMemoryExpression<Detail::Op_>(Detail::memoryOperand(l),  \
+                                                             Detail::memoryOperand(r))) \
+    {                                                                                    \
+        return Detail::makeMemoryExpression<Detail::Op_>(Detail::memoryOperand(l),      \
+                                                         Detail::memoryOperand(r));     \
+    }                                                                                    \
+    template <typename L, typename R>                                                    \
+    Vc_ALWAYS_INLINE auto operator op_(const L &l, const R &r)                           \
+        ->decltype(Detail::makeMemoryExpression<Detail::Op_>(                            \
+            Detail::memoryOperand(l),                                                    \
+            Detail::memoryBroadcast(Detail::memoryOperand(l), r)))                       \
+    {                                                                                    \
+        return Detail::makeMemoryExpression<Detail::Op_>(                                \
+            Detail::memoryOperand(l),                                                    \
+            Detail::memoryBroadcast(Detail::memoryOperand(l), r));                       \
+    }                                                                                    \
+    template <typename L, typename R>                                                    \
+    Vc_ALWAYS_INLINE auto operator op_(const L &l, const R &r)                           \
+        ->decltype(Detail::makeMemoryExpression<Detail::Op_>(                            \
+            Detail::memoryBroadcast(Detail::memoryOperand(r), l),                        \
+            Detail::memoryOperand(r)))                                                   \
+    {                                                                                    \
+        return Detail::makeMemoryExpression<Detail::Op_>(                                \
+            Detail::memoryBroadcast(Detail::memoryOperand(r), l),                        \
+            Detail::memoryOperand(r));                                                   \
+    }
+Vc_MEMORY_EXPRESSION_OPERATOR(+, MemoryPlus)
+Vc_MEMORY_EXPRESSION_OPERATOR(-, MemoryMinus)
+Vc_MEMORY_EXPRESSION_OPERATOR(*, MemoryMultiplies)
+Vc_MEMORY_EXPRESSION_OPERATOR(/, MemoryDivides)
+#undef Vc_MEMORY_EXPRESSION_OPERATOR
+//}}}1
+}  // namespace Common
+}  // namespace Vc
+
+#endif  // VC_COMMON_MEMORYEXPRESSION_H_
+
+// vim: foldmethod=marker
@@ -32,8 +32,18 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
+template <Vc::MallocAlignment A = Vc::AlignOnVector> struct AlignedAllocation;
+
+/**\internal
+ * The default allocation policy of Memory. Only the dynamically sized Memory (\p Size1 == 0)
+ * allocates, all other variants store their data inline.
+ */
+template <std::size_t Size1> struct DefaultMemoryAllocation { typedef void type; };
+template <> struct DefaultMemoryAllocation<0> { typedef AlignedAllocation<> type; };
+
 template <typename V, std::size_t Size1 = 0, std::size_t Size2 = 0,
-          bool InitPadding = true>
+          bool InitPadding = true,
+          typename Allocation = typename DefaultMemoryAllocation<Size1>::type>
 class Memory;
 
 template <typename V, typename Parent, int Dimension, typename RowMemory>
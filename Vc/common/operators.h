@@ -118,12 +118,15 @@ struct ReturnTypeImpl<Vector<T, Abi>, uint, Uq, void> {
         Abi>;
 };
 // 4. Vector × {enum, arithmetic}
+//    A 64-bit integer scalar (e.g. size_t) must not widen a vector of smaller entries.
 template <class T, class U, class Abi, class Uq>
 struct ReturnTypeImpl<
     Vector<T, Abi>, U, Uq,
     enable_if<!std::is_class<U>::value && !std::is_same<U, int>::value &&
                   !std::is_same<U, uint>::value &&
-                  Traits::is_valid_vector_argument<fundamental_return_t<T, U>>::value,
+                  Traits::is_valid_vector_argument<fundamental_return_t<T, U>>::value &&
+                  !(std::is_integral<fundamental_return_t<T, U>>::value &&
+                    sizeof(fundamental_return_t<T, U>) == 8 && sizeof(T) < 8),
               void>> {
     using type = Vc::Vector<fundamental_return_t<T, U>, Abi>;
 };
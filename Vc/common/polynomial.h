@@ -0,0 +1,249 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_POLYNOMIAL_H_
+#define VC_COMMON_POLYNOMIAL_H_
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// polynomial_fma {{{1
+// Returns a·b + c, as a single instruction if the target has FMA. Vc::fma is not used for
+// the SSE types because without FMA4 it emulates the exact rounding in software.
+template <typename V>
+Vc_INTRINSIC enable_if<!Traits::isSimdArray<V>::value, V> polynomial_fma(const V &a,
+                                                                          const V &b,
+                                                                          const V &c)
+{
+    return a * b + c;
+}
+
+#if defined Vc_IMPL_SSE && (defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4)
+Vc_INTRINSIC Vector<float, VectorAbi::Sse> polynomial_fma(
+    const Vector<float, VectorAbi::Sse> &a, const Vector<float, VectorAbi::Sse> &b,
+    const Vector<float, VectorAbi::Sse> &c)
+{
+#ifdef Vc_IMPL_FMA4
+    return _mm_macc_ps(a.data(), b.data(), c.data());
+#else
+    return _mm_fmadd_ps(a.data(), b.data(), c.data());
+#endif
+}
+Vc_INTRINSIC Vector<double, VectorAbi::Sse> polynomial_fma(
+    const Vector<double, VectorAbi::Sse> &a, const Vector<double, VectorAbi::Sse> &b,
+    const Vector<double, VectorAbi::Sse> &c)
+{
+#ifdef Vc_IMPL_FMA4
+    return _mm_macc_pd(a.data(), b.data(), c.data());
+#else
+    return _mm_fmadd_pd(a.data(), b.data(), c.data());
+#endif
+}
+#endif
+
+#if defined Vc_IMPL_AVX && (defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4)
+template <typename T>
+Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, Vector<T, VectorAbi::Avx>>
+polynomial_fma(const Vector<T, VectorAbi::Avx> &a, const Vector<T, VectorAbi::Avx> &b,
+               const Vector<T, VectorAbi::Avx> &c)
+{
+    return fma(a, b, c);
+}
+#endif
+
+// SimdArray forwards to the Vector types it stores
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC fixed_size_simd<T, N> polynomial_fma(const SimdArray<T, N, V, N> &a,
+                                                  const SimdArray<T, N, V, N> &b,
+                                                  const SimdArray<T, N, V, N> &c)
+{
+    return {private_init,
+            polynomial_fma(internal_data(a), internal_data(b), internal_data(c))};
+}
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC enable_if<(N != M), fixed_size_simd<T, N>> polynomial_fma(
+    const SimdArray<T, N, V, M> &a, const SimdArray<T, N, V, M> &b,
+    const SimdArray<T, N, V, M> &c)
+{
+    return {polynomial_fma(internal_data0(a), internal_data0(b), internal_data0(c)),
+            polynomial_fma(internal_data1(a), internal_data1(b), internal_data1(c))};
+}
+
+// polynomial_coefficient {{{1
+// Coefficients may be given as scalars or as vectors of the argument type.
+template <typename V> Vc_INTRINSIC const V &polynomial_coefficient(const V &c) { return c; }
+template <typename V, typename U>
+Vc_INTRINSIC enable_if<std::is_arithmetic<U>::value, V> polynomial_coefficient(const U &c)
+{
+    return V(static_cast<typename V::EntryType>(c));
+}
+
+// Horner {{{1
+// Evaluates c[0] + c[1]·x + … + c[N-1]·xᴺ⁻¹ as c[0] + x·(c[1] + x·(…)). Every step
+// depends on the previous one, which makes this the choice for low degrees.
+template <std::size_t N> struct Horner {
+    template <typename V> static Vc_INTRINSIC V eval(const V &x, const V *c)
+    {
+        return polynomial_fma(Horner<N - 1>::eval(x, c + 1), x, c[0]);
+    }
+};
+template <> struct Horner<1> {
+    template <typename V> static Vc_INTRINSIC V eval(const V &, const V *c)
+    {
+        return c[0];
+    }
+};
+
+// Estrin {{{1
+// Evaluates c[0] + c[1]·x + … + c[N-1]·xᴺ⁻¹ as lo + hi·xᴴ, where H is the largest power
+// of two below N and lo and hi are the polynomials of the lower H and the remaining
+// coefficients. lo and hi are independent, so the dependency chain is only about
+// log₂(N) multiply-adds long. p[k] holds x^(2ᵏ).
+constexpr std::size_t estrin_split(std::size_t n, std::size_t h = 1)
+{
+    return 2 * h < n ? estrin_split(n, 2 * h) : h;
+}
+constexpr std::size_t estrin_log2(std::size_t h) { return h <= 1 ? 0 : 1 + estrin_log2(h / 2); }
+
+template <std::size_t N> struct Estrin {
+    static constexpr std::size_t H = estrin_split(N);
+    template <typename V> static Vc_INTRINSIC V eval(const V *p, const V *c)
+    {
+        return polynomial_fma(Estrin<N - H>::eval(p, c + H), p[estrin_log2(H)],
+                              Estrin<H>::eval(p, c));
+    }
+};
+template <> struct Estrin<1> {
+    template <typename V> static Vc_INTRINSIC V eval(const V *, const V *c)
+    {
+        return c[0];
+    }
+};
+
+template <std::size_t N, typename V> Vc_INTRINSIC V estrin_eval(const V &x, const V *c)
+{
+    V p[estrin_log2(estrin_split(N)) + 1];
+    p[0] = x;
+    for (std::size_t k = 1; k < sizeof(p) / sizeof(V); ++k) {
+        p[k] = p[k - 1] * p[k - 1];
+    }
+    return Estrin<N>::eval(p, c);
+}
+}  // namespace Detail
+
+// horner {{{1
+/**
+ * \ingroup Math
+ * Evaluates the polynomial \f$c_0 + c_1 x + \ldots + c_n x^n\f$ with Horner's method.
+ *
+ * \code
+ * // 1 + 2x + 3x²
+ * float_v y = Vc::horner(x, 1.f, 2.f, 3.f);
+ * \endcode
+ *
+ * The degree is known at compile time and the evaluation is fully unrolled. Every step
+ * is a multiply-add, which is a single FMA instruction if the target supports it.
+ *
+ * \param x The values to evaluate the polynomial at.
+ * \param c The coefficients in order of increasing power, either scalars or objects of
+ *          type \p V.
+ *
+ * \see estrin for high degrees.
+ */
+template <typename V, typename... Cs>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> horner(const V &x,
+                                                                    const Cs &... c)
+{
+    static_assert(sizeof...(Cs) > 0, "horner requires at least one coefficient");
+    const V coeff[] = {Detail::polynomial_coefficient<V>(c)...};
+    return Detail::Horner<sizeof...(Cs)>::eval(x, coeff);
+}
+
+/**
+ * \ingroup Math
+ * Evaluates the polynomial with the coefficients \p c, in order of increasing power, with
+ * Horner's method.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> horner(const V &x,
+                                                                    const T (&c)[N])
+{
+    V coeff[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        coeff[i] = Detail::polynomial_coefficient<V>(c[i]);
+    }
+    return Detail::Horner<N>::eval(x, coeff);
+}
+
+// estrin {{{1
+/**
+ * \ingroup Math
+ * Evaluates the polynomial \f$c_0 + c_1 x + \ldots + c_n x^n\f$ with Estrin's scheme.
+ *
+ * The coefficients are combined pairwise with \f$x\f$, the pairs with \f$x^2\f$, those
+ * with \f$x^4\f$, and so on. This needs a few more multiplications than horner, but the
+ * longest chain of dependent multiply-adds grows with \f$\log_2 n\f$ instead of \f$n\f$.
+ * For high degrees the independent operations keep the pipelines busy and the result is
+ * available earlier. Rounding differs from horner in the last bits.
+ *
+ * \param x The values to evaluate the polynomial at.
+ * \param c The coefficients in order of increasing power, either scalars or objects of
+ *          type \p V.
+ */
+template <typename V, typename... Cs>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> estrin(const V &x,
+                                                                    const Cs &... c)
+{
+    static_assert(sizeof...(Cs) > 0, "estrin requires at least one coefficient");
+    const V coeff[] = {Detail::polynomial_coefficient<V>(c)...};
+    return Detail::estrin_eval<sizeof...(Cs)>(x, coeff);
+}
+
+/**
+ * \ingroup Math
+ * Evaluates the polynomial with the coefficients \p c, in order of increasing power, with
+ * Estrin's scheme.
+ */
+template <typename V, typename T, std::size_t N>
+Vc_INTRINSIC enable_if<Traits::is_simd_vector<V>::value, V> estrin(const V &x,
+                                                                    const T (&c)[N])
+{
+    V coeff[N];
+    for (std::size_t i = 0; i < N; ++i) {
+        coeff[i] = Detail::polynomial_coefficient<V>(c[i]);
+    }
+    return Detail::estrin_eval<N>(x, coeff);
+}
+// }}}1
+}  // namespace Vc
+
+#endif  // VC_COMMON_POLYNOMIAL_H_
+
+// vim: foldmethod=marker
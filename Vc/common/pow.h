@@ -0,0 +1,283 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+-------------------------------------------------------------------
+
+The cbrt polynomial is taken from Cephes, which carries the
+following Copyright notice:
+
+Cephes Math Library Release 2.2:  June, 1992
+Copyright 1984, 1987, 1989 by Stephen L. Moshier
+Direct inquiries to 30 Frost Street, Cambridge, MA 02140
+
+}}}*/
+
+#ifdef Vc_COMMON_MATH_H_INTERNAL
+
+namespace Detail
+{
+// error-free transformations {{{1
+// The returned value is the rounded result of the operation and err receives its exact
+// rounding error, i.e. a + b == s + err and a * b == p + err (Knuth, Dekker).
+template <typename V> Vc_ALWAYS_INLINE V two_sum(V a, V b, V &err)
+{
+    const V s = a + b;
+    const V bb = s - a;
+    err = (a - (s - bb)) + (b - bb);
+    return s;
+}
+
+// requires |a| ≥ |b|
+template <typename V> Vc_ALWAYS_INLINE V fast_two_sum(V a, V b, V &err)
+{
+    const V s = a + b;
+    err = b - (s - a);
+    return s;
+}
+
+template <typename T, typename Abi>
+Vc_ALWAYS_INLINE Vector<T, Abi> two_prod(Vector<T, Abi> a, Vector<T, Abi> b,
+                                         Vector<T, Abi> &err)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+    const V p = a * b;
+#if defined Vc_IMPL_FMA || defined Vc_IMPL_FMA4
+    // the SSE fma is emulated without the exact rounding this needs
+    if (std::is_same<Abi, VectorAbi::Avx>::value) {
+        err = fma(a, b, -p);
+        return p;
+    }
+#endif
+    // split the factors into halves whose products are exact
+    const V a_hi = Detail::operator&(a, C::highMask());
+    const V b_hi = Detail::operator&(b, C::highMask());
+    const V a_lo = a - a_hi;
+    const V b_lo = b - b_hi;
+    err = ((a_hi * b_hi - p) + a_hi * b_lo + a_lo * b_hi) + a_lo * b_lo;
+    return p;
+}
+
+// log_extended {{{1
+// Returns ln(x) = hi + lo for finite x > 0 with a relative error of about 2⁻⁶⁴. pow
+// multiplies the logarithm with arguments up to 2¹⁰ / ln(x) before passing it to exp,
+// which scales the error of the logarithm accordingly.
+template <typename Abi>
+Vc_ALWAYS_INLINE Vector<double, Abi> log_extended(Vector<double, Abi> x,
+                                                  Vector<double, Abi> &lo)
+{
+    using V = Vector<double, Abi>;
+    using C = Detail::Const<double, Abi>;
+
+    const auto denormal = x < C::min();
+    x(denormal) *= V(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V k = Detail::exponent(x.data()) + 1.;                                    // x = m·2ᵏ, m ∈ [½, 1[
+    k(denormal) -= 54.;
+    x.setZero(C::exponentMask());
+    x = Detail::operator|(x, C::_1_2());
+    const auto smallX = x < C::_1_sqrt2();
+    x(smallX) += x;  // m ∈ [√½, √2[
+    k(smallX) -= 1.;
+    const V f = x - 1.;  // exact
+
+    // ln(1 + f) = 2 atanh(s) = 2s + ⅔s³ + 2s⁵/5 + … with s = f / (2 + f) and |s| < 0.172
+    V t_lo, p_lo;
+    const V t = fast_two_sum(V(2.), f, t_lo);
+    const V s = f / t;
+    const V p = two_prod(s, t, p_lo);
+    const V s_lo = (((f - p) - p_lo) - s * t_lo) / t;
+
+    // ⅔s³ in double-double
+    const double c_hi = 6.66666666666666629659e-01;
+    const double c_lo = 3.70074341541718826389e-17;  // ⅔ - c_hi
+    V s2_lo, s3_lo, u_lo;
+    const V s2 = two_prod(s, s, s2_lo);
+    s2_lo += 2. * s * s_lo;
+    const V s3 = two_prod(s2, s, s3_lo);
+    s3_lo += s2 * s_lo + s2_lo * s;
+    const V u = two_prod(s3, V(c_hi), u_lo);
+    u_lo += s3 * c_lo + s3_lo * c_hi;
+
+    // the remaining terms are less than 2⁻¹³ of the result: double precision suffices
+    const V tail =
+        s2 * s3 *
+        (((((((((2. / 23. * s2 + 2. / 21.) * s2 + 2. / 19.) * s2 + 2. / 17.) * s2 +
+               2. / 15.) * s2 + 2. / 13.) * s2 + 2. / 11.) * s2 + 2. / 9.) * s2 +
+          2. / 7.) * s2 + 2. / 5.);
+
+    // k·ln(2) with ln2_hi·k exact for |k| < 2¹¹
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+    V e1, e2;
+    V hi = two_sum(k * ln2_hi, s + s, e1);
+    hi = two_sum(hi, u, e2);
+    lo = (e1 + e2) + ((s_lo + s_lo) + u_lo + tail + k * ln2_lo);
+    return fast_two_sum(hi, lo, lo);
+}
+
+// HypotScaling {{{1
+// Powers of two that bring the larger argument of hypot into a range where its square
+// neither overflows nor becomes denormal.
+template <typename T> struct HypotScaling;
+template <> struct HypotScaling<float> {
+    static constexpr float large() { return 1.12589991e+15f; }         // 2⁵⁰
+    static constexpr float scale_large() { return 8.47032947e-22f; }   // 2⁻⁷⁰
+    static constexpr float small() { return 8.8817842e-16f; }          // 2⁻⁵⁰
+    static constexpr float scale_small() { return 1.23794004e+27f; }   // 2⁹⁰
+};
+template <> struct HypotScaling<double> {
+    static constexpr double large() { return 3.2733906078961419e+150; }        // 2⁵⁰⁰
+    static constexpr double scale_large() { return 2.4099198651028841e-181; }  // 2⁻⁶⁰⁰
+    static constexpr double small() { return 3.0549363634996047e-151; }        // 2⁻⁵⁰⁰
+    static constexpr double scale_small() { return 4.149515568880993e+180; }   // 2⁶⁰⁰
+};
+//}}}1
+}  // namespace Detail
+
+// pow {{{1
+template <typename Abi, typename = Detail::enable_if_sse_or_avx_real<double, Abi>>
+inline Vector<double, detail::not_fixed_size_abi<Abi>> pow(Vector<double, Abi> x,
+                                                           Vector<double, Abi> y)
+{
+    using V = Vector<double, Abi>;
+    using L = Detail::ExpLimits<double>;
+
+    // xʸ = e^(y·ln|x|) with the product in double-double
+    const V ax = abs(x);
+    V l_lo;
+    V l = Detail::log_extended(ax, l_lo);
+    l(ax == V::Zero()) = -std::numeric_limits<double>::infinity();
+    l(!isfinite(ax)) = ax;
+    V z_lo;
+    const V z0 = Detail::two_prod(y, l, z_lo);
+    z_lo += y * l_lo;
+    const V z = Detail::fast_two_sum(z0, z_lo, z_lo);
+    V r = Detail::exp_extended(z, z_lo);
+
+    // The special cases follow C99 Annex F.9.4.4. z0 is ±∞ or NaN for the infinite and
+    // NaN arguments, where the error terms in z may be NaN.
+    r(z0 > L::max_e()) = std::numeric_limits<double>::infinity();
+    r(z0 < L::min_e()) = V::Zero();
+    r(isnan(z0)) = z0;
+    const V half_y = y * 0.5;
+    const auto y_integral = floor(y) == y;
+    const auto y_odd = y_integral && floor(half_y) != half_y;
+    r(y_odd && copysign(V::One(), x) < V::Zero()) = -r;
+    r(x < V::Zero() && isfinite(x) && !y_integral) = std::numeric_limits<double>::quiet_NaN();
+    r(y == V::Zero() || x == V::One() || (ax == V::One() && isinf(y))) = V::One();
+    return r;
+}
+
+// The float implementation evaluates the double implementation, which leaves only the
+// final rounding to float as an error of note.
+template <typename Abi, typename = Detail::enable_if_sse_or_avx_real<float, Abi>>
+inline Vector<float, detail::not_fixed_size_abi<Abi>> pow(Vector<float, Abi> x,
+                                                          Vector<float, Abi> y)
+{
+    using V = Vector<float, Abi>;
+    using D = SimdArray<double, V::Size>;
+    return simd_cast<V>(pow(simd_cast<D>(x), simd_cast<D>(y)));
+}
+
+// cbrt {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> cbrt(Vector<T, Abi> x)
+{
+    using V = Vector<T, Abi>;
+    using C = Detail::Const<T, Abi>;
+
+    const V ax = abs(x);
+    V m = ax;
+    const auto denormal = m < C::min();
+    m(denormal) *= T(Vc::Detail::doubleConstant<1, 0, 54>());  // 2⁵⁴
+    V k = Detail::exponent(m.data()) + T(1);                                  // |x| = m·2ᵏ, m ∈ [½, 1[
+    k(denormal) -= T(54);
+    m.setZero(C::exponentMask());
+    m = Detail::operator|(m, C::_1_2());
+
+    // Cephes polynomial for ∛m with a relative error of about 1e-4 in [½, 1[
+    V r = (((T(-1.3466110473359520655053e-1) * m + T(5.4664601366395524503440e-1)) * m -
+            T(9.5438224771509446525043e-1)) * m + T(1.1399983354717293273738e0)) * m +
+          T(4.0238979564544752126924e-1);
+
+    // ∛(2ᵏ) = 2^q · ∛(2^rem) with k = 3q + rem and rem ∈ {0, 1, 2}
+    const V q = floor(k / T(3));
+    const V rem = k - q * T(3);
+    r(rem == T(1)) *= T(1.2599210498948731647672);  // ∛2
+    r(rem == T(2)) *= T(1.5874010519681994747517);  // ∛4
+    r = ldexp(r, static_cast<SimdArray<int, V::Size>>(q));
+
+    // Newton-Raphson iterations double the number of correct digits each
+    r -= (r - ax / (r * r)) * T(1. / 3.);
+    r -= (r - ax / (r * r)) * T(1. / 3.);
+    if (std::is_same<T, double>::value) {
+        r -= (r - ax / (r * r)) * T(1. / 3.);
+    }
+
+    r = copysign(r, x);
+    r(x == V::Zero() || !isfinite(x)) = x;
+    return r;
+}
+
+// hypot {{{1
+template <typename T, typename Abi, typename = Detail::enable_if_sse_or_avx_real<T, Abi>>
+inline Vector<T, detail::not_fixed_size_abi<Abi>> hypot(Vector<T, Abi> x, Vector<T, Abi> y)
+{
+    using V = Vector<T, Abi>;
+    using S = Detail::HypotScaling<T>;
+
+    const V ax = abs(x);
+    const V ay = abs(y);
+    V a = max(ax, ay);
+    V b = min(ax, ay);
+    V scale = V::One();
+    V unscale = V::One();
+    scale(a > S::large()) = S::scale_large();
+    unscale(a > S::large()) = T(1) / S::scale_large();
+    scale(a < S::small()) = S::scale_small();
+    unscale(a < S::small()) = T(1) / S::scale_small();
+    a *= scale;
+    b *= scale;
+
+    // a² + b² in double-T, then its square root with one correction step
+    V e1, e2, s_lo;
+    const V p1 = Detail::two_prod(a, a, e1);
+    const V p2 = Detail::two_prod(b, b, e2);
+    const V s = Detail::fast_two_sum(p1, p2, s_lo);
+    s_lo += e1 + e2;
+    V h = sqrt(s);
+    V hh_lo;
+    const V hh = Detail::two_prod(h, h, hh_lo);
+    h += (((s - hh) - hh_lo) + s_lo) / (h + h);
+    h *= unscale;
+
+    h(a == V::Zero()) = V::Zero();
+    h(isnan(x) || isnan(y)) = std::numeric_limits<T>::quiet_NaN();
+    h(isinf(x) || isinf(y)) = std::numeric_limits<T>::infinity();
+    return h;
+}
+//}}}1
+
+#endif // Vc_COMMON_MATH_H_INTERNAL
@@ -0,0 +1,336 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_RANDOM_H_
+#define VC_COMMON_RANDOM_H_
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include "../type_traits"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// splitmix64 {{{
+/**\internal
+ * Advances the SplitMix64 state \p x and returns its next output. Used to expand a user
+ * seed into the per-lane states of RandomEngine.
+ */
+Vc_INTRINSIC std::uint64_t splitmix64(std::uint64_t &x)
+{
+    std::uint64_t z = (x += 0x9e3779b97f4a7c15ull);
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+// }}}
+// xoshiro_traits {{{
+/**\internal
+ * Parameters of xoshiro128+ (32-bit words) and xoshiro256+ (64-bit words).
+ */
+template <class W> struct xoshiro_traits;
+template <> struct xoshiro_traits<unsigned int> {
+    static constexpr int Shift = 9;
+    static constexpr int Rotate = 11;
+    static Vc_INTRINSIC unsigned int jump(int i)
+    {
+        return i == 0 ? 0x8764000bu : i == 1 ? 0xf542d2d3u : i == 2 ? 0x6fa035c3u
+                                                                      : 0x77f2db5bu;
+    }
+};
+template <> struct xoshiro_traits<unsigned long long> {
+    static constexpr int Shift = 17;
+    static constexpr int Rotate = 45;
+    static Vc_INTRINSIC unsigned long long jump(int i)
+    {
+        return i == 0 ? 0x180ec6d33cfd0abaull
+                      : i == 1 ? 0xd5a61266f0c9392cull
+                               : i == 2 ? 0xa9582618e03fc9aaull : 0x39abdc4529b1661cull;
+    }
+};
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * A pseudo-random number generator for the floating-point vector type \p V that keeps
+ * its own state.
+ *
+ * Every lane runs an independent xoshiro128+ (\c float) or xoshiro256+ (\c double)
+ * generator. The lane states are derived from a seed and a stream number, so two
+ * engines with the same arguments produce the same sequence on the same target, and
+ * engines with different stream numbers produce unrelated sequences. Give every thread
+ * its own engine, e.g. with the thread index as \p stream, instead of sharing
+ * V::Random(). Alternatively, copy an engine and call jump() on the copy to obtain a
+ * guaranteed non-overlapping substream.
+ *
+ * \code
+ * Vc::RandomEngine<Vc::float_v> engine(seed, threadIndex);
+ * engine.generate_normal(samples.data(), samples.data() + samples.size());
+ * \endcode
+ *
+ * \tparam V A Vc::Vector type with \c float or \c double entries.
+ */
+template <class V> class RandomEngine
+{
+    static_assert(is_simd_vector<V>::value && !Traits::isSimdArray<V>::value &&
+                      !Traits::is_fixed_size_simd<V>::value,
+                  "RandomEngine<V> requires V to be a Vc::Vector type");
+    static_assert(std::is_floating_point<typename V::EntryType>::value,
+                  "RandomEngine<V> requires V to have float or double entries");
+
+public:
+    typedef typename V::EntryType EntryType;
+    /// The unsigned integer type of a single state word.
+    typedef typename std::conditional<sizeof(EntryType) == 4, unsigned int,
+                                      unsigned long long>::type WordType;
+
+    /**
+     * Initializes the lane states from \p seed and \p stream.
+     */
+    explicit RandomEngine(std::uint64_t seed = 0x2545f4914f6cdd1dull,
+                          std::uint64_t stream = 0)
+    {
+        this->seed(seed, stream);
+    }
+
+    /**
+     * Reinitializes the lane states from \p seed and \p stream and discards a cached
+     * normal() result.
+     */
+    void seed(std::uint64_t seed, std::uint64_t stream = 0)
+    {
+        std::uint64_t x = seed ^ Detail::splitmix64(stream);
+        WordType mem[4][V::Size];
+        for (std::size_t i = 0; i < V::Size; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                mem[j][i] = static_cast<WordType>(Detail::splitmix64(x));
+            }
+        }
+        for (int j = 0; j < 4; ++j) {
+            for (std::size_t k = 0; k < Parts; ++k) {
+                s[j][k].load(&mem[j][k * W::Size], Vc::Unaligned);
+            }
+        }
+        hasCachedNormal = false;
+    }
+
+    /**
+     * Advances every lane by 2^64 (\c float) or 2^128 (\c double) steps. Use it on copies
+     * of one engine to split its sequence into non-overlapping substreams.
+     */
+    void jump()
+    {
+        typedef Detail::xoshiro_traits<WordType> X;
+        W t[4][Parts];
+        for (int j = 0; j < 4; ++j) {
+            for (std::size_t k = 0; k < Parts; ++k) {
+                t[j][k] = W::Zero();
+            }
+        }
+        W unused[Parts];
+        for (int i = 0; i < 4; ++i) {
+            for (int b = 0; b < int(sizeof(WordType)) * 8; ++b) {
+                if (X::jump(i) & (WordType(1) << b)) {
+                    for (int j = 0; j < 4; ++j) {
+                        for (std::size_t k = 0; k < Parts; ++k) {
+                            t[j][k] ^= s[j][k];
+                        }
+                    }
+                }
+                step(unused);
+            }
+        }
+        for (int j = 0; j < 4; ++j) {
+            for (std::size_t k = 0; k < Parts; ++k) {
+                s[j][k] = t[j][k];
+            }
+        }
+    }
+
+    /**
+     * Returns uniformly distributed values in [0, 1).
+     */
+    Vc_ALWAYS_INLINE V uniform()
+    {
+        // the high bits become the mantissa of a number in [1, 2)
+        constexpr int Digits = std::numeric_limits<EntryType>::digits - 1;
+        const W one(WordType(std::numeric_limits<EntryType>::max_exponent - 1) << Digits);
+        W bits[Parts];
+        step(bits);
+        WordType mem[V::Size];
+        for (std::size_t k = 0; k < Parts; ++k) {
+            ((bits[k] >> (int(sizeof(WordType)) * 8 - Digits)) | one)
+                .store(&mem[k * W::Size], Vc::Unaligned);
+        }
+        EntryType tmp[V::Size];
+        std::memcpy(&tmp[0], &mem[0], sizeof(tmp));
+        return V(&tmp[0], Vc::Unaligned) - V::One();
+    }
+
+    /**
+     * Returns uniformly distributed values in [\p a, \p b).
+     */
+    Vc_ALWAYS_INLINE V uniform(const V &a, const V &b) { return a + (b - a) * uniform(); }
+
+    /**
+     * Returns normally distributed values with mean 0 and standard deviation 1.
+     *
+     * Uses the Box-Muller transform, which yields two vectors of results per two vectors
+     * of uniform input. The second vector is cached and returned by the next call.
+     */
+    Vc_ALWAYS_INLINE V normal()
+    {
+        if (hasCachedNormal) {
+            hasCachedNormal = false;
+            return cachedNormal;
+        }
+        V r;
+        boxMuller(r, cachedNormal);
+        hasCachedNormal = true;
+        return r;
+    }
+
+    /**
+     * Returns normally distributed values with mean \p mean and standard deviation \p
+     * stddev.
+     */
+    Vc_ALWAYS_INLINE V normal(const V &mean, const V &stddev)
+    {
+        return mean + stddev * normal();
+    }
+
+    /**
+     * Returns exponentially distributed values with rate \p lambda.
+     */
+    Vc_ALWAYS_INLINE V exponential(const V &lambda = V::One())
+    {
+        return -Vc::log(V::One() - uniform()) / lambda;
+    }
+
+    /**
+     * Fills [\p first, \p last) with uniformly distributed values in [0, 1).
+     */
+    void generate_uniform(EntryType *first, EntryType *last)
+    {
+        for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+            uniform().store(first, Vc::Unaligned);
+        }
+        storePartial(uniform(), first, last);
+    }
+
+    /**
+     * Fills [\p first, \p last) with normally distributed values with mean 0 and standard
+     * deviation 1. Both results of the Box-Muller transform are stored, so the cache of
+     * normal() is not used.
+     */
+    void generate_normal(EntryType *first, EntryType *last)
+    {
+        V a, b;
+        for (; last - first >= 2 * std::ptrdiff_t(V::Size); first += 2 * V::Size) {
+            boxMuller(a, b);
+            a.store(first, Vc::Unaligned);
+            b.store(first + V::Size, Vc::Unaligned);
+        }
+        if (first != last) {
+            boxMuller(a, b);
+            if (last - first >= std::ptrdiff_t(V::Size)) {
+                a.store(first, Vc::Unaligned);
+                first += V::Size;
+                a = b;
+            }
+            storePartial(a, first, last);
+        }
+    }
+
+    /**
+     * Fills [\p first, \p last) with exponentially distributed values with rate \p
+     * lambda.
+     */
+    void generate_exponential(EntryType *first, EntryType *last, EntryType lambda = 1)
+    {
+        const V l(lambda);
+        for (; last - first >= std::ptrdiff_t(V::Size); first += V::Size) {
+            exponential(l).store(first, Vc::Unaligned);
+        }
+        storePartial(exponential(l), first, last);
+    }
+
+private:
+    /// The native vector of state words and the number of them that make up one V.
+    typedef Vc::Vector<WordType> W;
+    static constexpr std::size_t Parts = V::Size / W::Size;
+    static_assert(Parts * W::Size == V::Size,
+                  "RandomEngine<V> requires V::Size to be a multiple of the native "
+                  "integer vector size");
+
+    // one xoshiro step on every lane, writing the raw outputs to r
+    Vc_ALWAYS_INLINE void step(W *r)
+    {
+        typedef Detail::xoshiro_traits<WordType> X;
+        for (std::size_t k = 0; k < Parts; ++k) {
+            r[k] = s[0][k] + s[3][k];
+            const W t = s[1][k] << X::Shift;
+            s[2][k] ^= s[0][k];
+            s[3][k] ^= s[1][k];
+            s[1][k] ^= s[2][k];
+            s[0][k] ^= s[3][k];
+            s[2][k] ^= t;
+            s[3][k] = (s[3][k] << X::Rotate) |
+                      (s[3][k] >> (int(sizeof(WordType)) * 8 - X::Rotate));
+        }
+    }
+
+    Vc_ALWAYS_INLINE void boxMuller(V &a, V &b)
+    {
+        const V r = Vc::sqrt(EntryType(-2) * Vc::log(V::One() - uniform()));
+        V sin, cos;
+        Vc::sincos(EntryType(2 * 3.14159265358979323846) * uniform(), &sin, &cos);
+        a = r * cos;
+        b = r * sin;
+    }
+
+    static Vc_INTRINSIC void storePartial(const V &x, EntryType *first, EntryType *last)
+    {
+        for (std::size_t i = 0; first != last; ++i, ++first) {
+            *first = x[i];
+        }
+    }
+
+    W s[4][Parts];
+    V cachedNormal;
+    bool hasCachedNormal;
+};
+}  // namespace Vc
+
+#endif  // VC_COMMON_RANDOM_H_
+
+// vim: foldmethod=marker
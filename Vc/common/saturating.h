@@ -0,0 +1,210 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SATURATING_H_
+#define VC_COMMON_SATURATING_H_
+
+#include <limits>
+#include "../type_traits"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// scalar helpers {{{
+template <class T> Vc_INTRINSIC T add_sat_scalar(T a, T b)
+{
+    typedef std::numeric_limits<T> L;
+    if (std::is_unsigned<T>::value) {
+        const T r = T(a + b);
+        return r < a ? L::max() : r;
+    } else if (b > 0 && a > L::max() - b) {
+        return L::max();
+    } else if (b < 0 && a < L::min() - b) {
+        return L::min();
+    }
+    return T(a + b);
+}
+
+template <class T> Vc_INTRINSIC T sub_sat_scalar(T a, T b)
+{
+    typedef std::numeric_limits<T> L;
+    if (std::is_unsigned<T>::value) {
+        return a < b ? T(0) : T(a - b);
+    } else if (b < 0 && a > L::max() + b) {
+        return L::max();
+    } else if (b > 0 && a < L::min() + b) {
+        return L::min();
+    }
+    return T(a - b);
+}
+// }}}
+// generic implementation {{{
+template <class V> Vc_INTRINSIC V add_sat_impl(const V &a, const V &b)
+{
+    return V::generate([&](int i) {
+        return add_sat_scalar<typename V::EntryType>(a[i], b[i]);
+    });
+}
+
+template <class V> Vc_INTRINSIC V sub_sat_impl(const V &a, const V &b)
+{
+    return V::generate([&](int i) {
+        return sub_sat_scalar<typename V::EntryType>(a[i], b[i]);
+    });
+}
+
+template <class V> Vc_INTRINSIC V avg_impl(const V &a, const V &b)
+{
+    // a + b == 2 * (a | b) - (a ^ b), therefore this is (a + b + 1) / 2 rounded towards
+    // negative infinity without an intermediate overflow
+    return (a | b) - ((a ^ b) >> 1);
+}
+// }}}
+#ifdef Vc_IMPL_SSE
+// SSE {{{
+Vc_INTRINSIC SSE::schar_v add_sat_impl(SSE::schar_v a, SSE::schar_v b) { return _mm_adds_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE::uchar_v add_sat_impl(SSE::uchar_v a, SSE::uchar_v b) { return _mm_adds_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE::short_v add_sat_impl(SSE::short_v a, SSE::short_v b) { return _mm_adds_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v add_sat_impl(SSE::ushort_v a, SSE::ushort_v b) { return _mm_adds_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC SSE::schar_v sub_sat_impl(SSE::schar_v a, SSE::schar_v b) { return _mm_subs_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE::uchar_v sub_sat_impl(SSE::uchar_v a, SSE::uchar_v b) { return _mm_subs_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE::short_v sub_sat_impl(SSE::short_v a, SSE::short_v b) { return _mm_subs_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v sub_sat_impl(SSE::ushort_v a, SSE::ushort_v b) { return _mm_subs_epu16(a.data(), b.data()); }
+
+// pavg rounds up, i.e. it computes (a + b + 1) >> 1. The signed variants flip the sign
+// bit to map the signed range onto the unsigned range and back.
+Vc_INTRINSIC SSE::uchar_v avg_impl(SSE::uchar_v a, SSE::uchar_v b) { return _mm_avg_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE::ushort_v avg_impl(SSE::ushort_v a, SSE::ushort_v b) { return _mm_avg_epu16(a.data(), b.data()); }
+Vc_INTRINSIC SSE::schar_v avg_impl(SSE::schar_v a, SSE::schar_v b)
+{
+    const __m128i k = _mm_set1_epi8(-0x80);
+    return _mm_xor_si128(
+        _mm_avg_epu8(_mm_xor_si128(a.data(), k), _mm_xor_si128(b.data(), k)), k);
+}
+Vc_INTRINSIC SSE::short_v avg_impl(SSE::short_v a, SSE::short_v b)
+{
+    const __m128i k = _mm_set1_epi16(-0x8000);
+    return _mm_xor_si128(
+        _mm_avg_epu16(_mm_xor_si128(a.data(), k), _mm_xor_si128(b.data(), k)), k);
+}
+// }}}
+#endif  // Vc_IMPL_SSE
+#ifdef Vc_IMPL_AVX2
+// AVX2 {{{
+Vc_INTRINSIC AVX2::schar_v add_sat_impl(AVX2::schar_v a, AVX2::schar_v b) { return _mm256_adds_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2::uchar_v add_sat_impl(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_adds_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2::short_v add_sat_impl(AVX2::short_v a, AVX2::short_v b) { return _mm256_adds_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v add_sat_impl(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_adds_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC AVX2::schar_v sub_sat_impl(AVX2::schar_v a, AVX2::schar_v b) { return _mm256_subs_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2::uchar_v sub_sat_impl(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_subs_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2::short_v sub_sat_impl(AVX2::short_v a, AVX2::short_v b) { return _mm256_subs_epi16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v sub_sat_impl(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_subs_epu16(a.data(), b.data()); }
+
+Vc_INTRINSIC AVX2::uchar_v avg_impl(AVX2::uchar_v a, AVX2::uchar_v b) { return _mm256_avg_epu8 (a.data(), b.data()); }
+Vc_INTRINSIC AVX2::ushort_v avg_impl(AVX2::ushort_v a, AVX2::ushort_v b) { return _mm256_avg_epu16(a.data(), b.data()); }
+Vc_INTRINSIC AVX2::schar_v avg_impl(AVX2::schar_v a, AVX2::schar_v b)
+{
+    const __m256i k = _mm256_set1_epi8(-0x80);
+    return _mm256_xor_si256(
+        _mm256_avg_epu8(_mm256_xor_si256(a.data(), k), _mm256_xor_si256(b.data(), k)), k);
+}
+Vc_INTRINSIC AVX2::short_v avg_impl(AVX2::short_v a, AVX2::short_v b)
+{
+    const __m256i k = _mm256_set1_epi16(-0x8000);
+    return _mm256_xor_si256(
+        _mm256_avg_epu16(_mm256_xor_si256(a.data(), k), _mm256_xor_si256(b.data(), k)),
+        k);
+}
+// }}}
+#endif  // Vc_IMPL_AVX2
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns `a + b` with the result clamped to the range of the entry type instead of
+ * wrapping around.
+ *
+ * \code
+ * Vc::uchar_v pixel = ...;
+ * pixel = Vc::add_sat(pixel, Vc::uchar_v(40));  // brighten, 250 becomes 255
+ * \endcode
+ *
+ * \param a, b Vc::Vector or Vc::SimdArray objects of integral type.
+ *
+ * The 8- and 16-bit SSE and AVX2 vectors use the saturating add instructions, all other
+ * types compute every entry with the scalar equivalent.
+ */
+template <class V>
+Vc_ALWAYS_INLINE
+    enable_if<is_simd_vector<V>::value && std::is_integral<typename V::EntryType>::value, V>
+    add_sat(const V &a, const V &b)
+{
+    return Detail::add_sat_impl(a, b);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns `a - b` with the result clamped to the range of the entry type instead of
+ * wrapping around.
+ *
+ * \param a, b Vc::Vector or Vc::SimdArray objects of integral type.
+ */
+template <class V>
+Vc_ALWAYS_INLINE
+    enable_if<is_simd_vector<V>::value && std::is_integral<typename V::EntryType>::value, V>
+    sub_sat(const V &a, const V &b)
+{
+    return Detail::sub_sat_impl(a, b);
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the average of \p a and \p b, rounded up: `(a + b + 1) >> 1` evaluated without
+ * overflow. This matches the `pavgb`/`pavgw` instructions, which the 8- and 16-bit SSE and
+ * AVX2 vectors use.
+ *
+ * \param a, b Vc::Vector or Vc::SimdArray objects of integral type.
+ */
+template <class V>
+Vc_ALWAYS_INLINE
+    enable_if<is_simd_vector<V>::value && std::is_integral<typename V::EntryType>::value, V>
+    avg(const V &a, const V &b)
+{
+    return Detail::avg_impl(a, b);
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SATURATING_H_
+
+// vim: foldmethod=marker
@@ -36,19 +36,6 @@ namespace Vc_VERSIONED_NAMESPACE
 namespace Common
 {
 
-template <typename V, typename MT, typename IT>
-Vc_ALWAYS_INLINE void executeScatter(SetIndexZeroT,
-                                    V &v,
-                                    MT *mem,
-                                    IT indexes,
-                                    typename V::MaskArgument mask)
-{
-    indexes.setZeroInverted(static_cast<typename IT::Mask>(mask));
-    // Huh?
-    const V tmp(mem, indexes);
-    where(mask) | v = tmp;
-}
-
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeScatter(SimpleLoopT,
                                     V &v,
@@ -65,6 +52,18 @@ Vc_ALWAYS_INLINE void executeScatter(SimpleLoopT,
     });
 }
 
+// Zeroing the masked-off indexes, as the gather does, would make a scatter write to
+// mem[0]. Therefore Vc_USE_SET_GATHERS uses the simple loop for scatters.
+template <typename V, typename MT, typename IT>
+Vc_ALWAYS_INLINE void executeScatter(SetIndexZeroT,
+                                    V &v,
+                                    MT *mem,
+                                    const IT &indexes,
+                                    typename V::MaskArgument mask)
+{
+    executeScatter(SimpleLoopT(), v, mem, indexes, mask);
+}
+
 template <typename V, typename MT, typename IT>
 Vc_ALWAYS_INLINE void executeScatter(BitScanLoopT,
                                     V &v,
@@ -444,7 +444,15 @@ public:
     Vc_INTRINSIC fixed_size_simd<T, N> shifted(int amount, const SimdArray<value_type, NN> &shiftIn)
         const
     {
-        return {private_init, data.shifted(amount, simd_cast<VectorType>(shiftIn))};
+        if (amount >= 0 || NN == N) {
+            return {private_init, data.shifted(amount, simd_cast<VectorType>(shiftIn))};
+        }
+        // shifting right shifts in the last N entries of shiftIn
+        return {private_init,
+                data.shifted(amount, NN > N ? simd_cast<VectorType>(
+                                                  shiftIn.shifted(int(NN) - int(N)))
+                                            : simd_cast<VectorType>(shiftIn).shifted(
+                                                  int(NN) - int(N)))};
     }
 
     Vc_INTRINSIC fixed_size_simd<T, N> rotated(int amount) const
@@ -1171,8 +1179,8 @@ public:
                 i += amount;
                 if (i >= 0) {
                     return operator[](i);
-                } else if (i >= -SSize) {
-                    return shiftIn[i + SSize];
+                } else if (i >= -int(NN)) {
+                    return shiftIn[i + int(NN)];
                 }
                 return 0;
             });
@@ -1287,7 +1295,7 @@ public:
             return {data0.shifted(amount, d1cvtd), std::move(d0cvtd)};
         } else if (int(size()) - amount < size1) {
             return {data0.shifted(amount - int(size()), d1cvtd.shifted(size1 - size0)),
-                    data1.shifted(amount - int(size()), data0.shifted(size0 - size1))};
+                    data1.shifted(amount - int(size()), data0)};
         } else if (int(size()) - amount == size1) {
             return {data0.shifted(-size1, d1cvtd.shifted(size1 - size0)),
                     simd_cast<storage_type1>(data0.shifted(size0 - size1))};
@@ -1797,6 +1805,61 @@ Vc_ALL_COMPARES(Vc_BINARY_OPERATORS_);
     }                                                                                    \
     Vc_NOTHING_EXPECTING_SEMICOLON
 
+// sincos_impl {{{1
+namespace Detail
+{
+/**\internal
+ * Computes sincos on the two halves \p x0 and \p x1 of a SimdArray. The default calls
+ * sincos twice; Vector types that can do better (i.e. interleave the two evaluations)
+ * specialize this class.
+ */
+template <typename V, typename = void> struct SincosPair {
+    static Vc_INTRINSIC void apply(const V &x0, const V &x1, V *s0, V *c0, V *s1, V *c1)
+    {
+        sincos(x0, s0, c0);
+        sincos(x1, s1, c1);
+    }
+};
+
+template <typename T, std::size_t N, typename V>
+Vc_INTRINSIC void sincos_impl(const SimdArray<T, N, V, N> &x, SimdArray<T, N, V, N> *sin,
+                              SimdArray<T, N, V, N> *cos)
+{
+    sincos(internal_data(x), &internal_data(*sin), &internal_data(*cos));
+}
+
+// both halves are a single V each: hand them to SincosPair together
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC enable_if<(N != M && std::is_same<typename SimdArrayTraits<T, N>::storage_type0,
+                                                 SimdArray<T, M, V, M>>::value &&
+                        std::is_same<typename SimdArrayTraits<T, N>::storage_type1,
+                                     SimdArray<T, M, V, M>>::value),
+                       void>
+sincos_impl(const SimdArray<T, N, V, M> &x, SimdArray<T, N, V, M> *sin,
+            SimdArray<T, N, V, M> *cos)
+{
+    SincosPair<V>::apply(internal_data(internal_data0(x)),
+                         internal_data(internal_data1(x)),
+                         &internal_data(internal_data0(*sin)),
+                         &internal_data(internal_data0(*cos)),
+                         &internal_data(internal_data1(*sin)),
+                         &internal_data(internal_data1(*cos)));
+}
+
+template <typename T, std::size_t N, typename V, std::size_t M>
+Vc_INTRINSIC enable_if<(N != M && !(std::is_same<typename SimdArrayTraits<T, N>::storage_type0,
+                                                   SimdArray<T, M, V, M>>::value &&
+                                      std::is_same<typename SimdArrayTraits<T, N>::storage_type1,
+                                                   SimdArray<T, M, V, M>>::value)),
+                       void>
+sincos_impl(const SimdArray<T, N, V, M> &x, SimdArray<T, N, V, M> *sin,
+            SimdArray<T, N, V, M> *cos)
+{
+    sincos_impl(internal_data0(x), &internal_data0(*sin), &internal_data0(*cos));
+    sincos_impl(internal_data1(x), &internal_data1(*sin), &internal_data1(*cos));
+}
+}  // namespace Detail
+
 /**
  * \name Math functions
  * These functions evaluate the
@@ -1806,10 +1869,17 @@ Vc_FORWARD_UNARY_OPERATOR(abs);
 Vc_FORWARD_UNARY_OPERATOR(asin);
 Vc_FORWARD_UNARY_OPERATOR(atan);
 Vc_FORWARD_BINARY_OPERATOR(atan2);
+Vc_FORWARD_UNARY_OPERATOR(cbrt);
 Vc_FORWARD_UNARY_OPERATOR(ceil);
 Vc_FORWARD_BINARY_OPERATOR(copysign);
 Vc_FORWARD_UNARY_OPERATOR(cos);
+Vc_FORWARD_UNARY_OPERATOR(cosh);
+Vc_FORWARD_UNARY_OPERATOR(erf);
+Vc_FORWARD_UNARY_OPERATOR(erfc);
 Vc_FORWARD_UNARY_OPERATOR(exp);
+Vc_FORWARD_UNARY_OPERATOR(exp2);
+Vc_FORWARD_UNARY_OPERATOR(exp10);
+Vc_FORWARD_UNARY_OPERATOR(expm1);
 Vc_FORWARD_UNARY_OPERATOR(exponent);
 Vc_FORWARD_UNARY_OPERATOR(floor);
 /// Applies the std::fma function component-wise and concurrently.
@@ -1819,6 +1889,7 @@ inline SimdArray<T, N> fma(const SimdArray<T, N> &a, const SimdArray<T, N> &b,
 {
     return SimdArray<T, N>::fromOperation(Common::Operations::Forward_fma(), a, b, c);
 }
+Vc_FORWARD_BINARY_OPERATOR(hypot);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isfinite);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isinf);
 Vc_FORWARD_UNARY_BOOL_OPERATOR(isnan);
@@ -1837,18 +1908,23 @@ inline SimdArray<T, N> ldexp(const SimdArray<T, N> &x, const SimdArray<int, N> &
 }
 Vc_FORWARD_UNARY_OPERATOR(log);
 Vc_FORWARD_UNARY_OPERATOR(log10);
+Vc_FORWARD_UNARY_OPERATOR(log1p);
 Vc_FORWARD_UNARY_OPERATOR(log2);
+Vc_FORWARD_BINARY_OPERATOR(pow);
 Vc_FORWARD_UNARY_OPERATOR(reciprocal);
 Vc_FORWARD_UNARY_OPERATOR(round);
 Vc_FORWARD_UNARY_OPERATOR(rsqrt);
 Vc_FORWARD_UNARY_OPERATOR(sin);
+Vc_FORWARD_UNARY_OPERATOR(sinh);
 /// Determines sine and cosine concurrently and component-wise on \p x.
 template <typename T, std::size_t N>
 void sincos(const SimdArray<T, N> &x, SimdArray<T, N> *sin, SimdArray<T, N> *cos)
 {
-    SimdArray<T, N>::callOperation(Common::Operations::Forward_sincos(), x, sin, cos);
+    Detail::sincos_impl(x, sin, cos);
 }
 Vc_FORWARD_UNARY_OPERATOR(sqrt);
+Vc_FORWARD_UNARY_OPERATOR(tan);
+Vc_FORWARD_UNARY_OPERATOR(tanh);
 Vc_FORWARD_UNARY_OPERATOR(trunc);
 Vc_FORWARD_BINARY_OPERATOR(min);
 Vc_FORWARD_BINARY_OPERATOR(max);
@@ -0,0 +1,316 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SIMDVECTOR_H_
+#define VC_COMMON_SIMDVECTOR_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include "memory.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**
+ * \ingroup Containers
+ * \headerfile simdvector.h <Vc/Memory>
+ *
+ * A growable array of \p T, stored vector-aligned and padded for Vc::Vector<T>.
+ *
+ * SimdVector combines the interface of std::vector (push_back, reserve, resize, amortized
+ * constant-time growth, moves that only transfer the pointer) with the vectorized access of
+ * Vc::Memory: it derives from MemoryBase, so vector(i), vectorAt(i), begin()/end() (which
+ * iterate over vectors, not scalars) and the entries()/operator[] scalar access work as for
+ * Memory<V>.
+ *
+ * The capacity is always a multiple of V::Size, and the member functions of SimdVector keep
+ * the entries of the last vector beyond size() zero (writes through vector(i) or the
+ * iterators can of course change them). Thus the loop
+ * \code
+ * Vc::SimdVector<float> data;
+ * for (...) data.push_back(x);
+ * for (auto &v : data) { v = Vc::sqrt(v); }
+ * \endcode
+ * processes the tail with a full vector load and store, without touching memory outside
+ * the allocation and without running into uninitialized values.
+ *
+ * \tparam T The entry type. SimdVector only supports the arithmetic types of Vc::Vector.
+ * \tparam Allocation The allocation policy, see Vc::AlignedAllocation.
+ */
+template <typename T, typename Allocation = AlignedAllocation<>>
+class SimdVector : public MemoryBase<Vector<T>, SimdVector<T, Allocation>, 1, void>
+{
+public:
+    typedef Vector<T> V;
+    typedef T EntryType;
+    typedef T value_type;
+    typedef std::size_t size_type;
+
+private:
+    typedef MemoryBase<V, SimdVector, 1, void> Base;
+    friend class MemoryBase<V, SimdVector, 1, void>;
+    friend class MemoryDimensionBase<V, SimdVector, 1, void>;
+
+    static size_t vectorsFor(size_t n) { return (n + V::Size - 1) / V::Size; }
+
+    T *m_mem;
+    size_t m_size;
+    size_t m_capacity;  // in entries, a multiple of V::Size
+
+public:
+    using Base::vector;
+
+    /// Creates an empty SimdVector without allocating.
+    SimdVector() noexcept : m_mem(nullptr), m_size(0), m_capacity(0) {}
+
+    /// Creates a SimdVector with \p n zero entries.
+    explicit SimdVector(size_t n) : SimdVector() { resize(n); }
+
+    /// Creates a SimdVector with \p n copies of \p value.
+    SimdVector(size_t n, T value) : SimdVector() { resize(n, value); }
+
+    SimdVector(std::initializer_list<T> init) : SimdVector()
+    {
+        reserve(init.size());
+        std::copy(init.begin(), init.end(), m_mem);
+        setSize(init.size());
+    }
+
+    /// Copies the entries of any one-dimensional Memory object.
+    template <typename Parent, typename RM>
+    explicit SimdVector(const MemoryBase<V, Parent, 1, RM> &rhs) : SimdVector()
+    {
+        reserve(rhs.entriesCount());
+        std::copy_n(rhs.entries(), rhs.entriesCount(), m_mem);
+        setSize(rhs.entriesCount());
+    }
+
+    /// Evaluates the MemoryExpression \p e into a new SimdVector.
+    template <typename Op, typename L, typename R>
+    SimdVector(const MemoryExpression<V, Op, L, R> &e) : SimdVector()
+    {
+        *this = e;
+    }
+
+    SimdVector(const SimdVector &rhs) : SimdVector()
+    {
+        reserve(rhs.m_size);
+        std::copy_n(rhs.m_mem, rhs.vectorsCount() * V::Size, m_mem);
+        m_size = rhs.m_size;
+    }
+
+    /// Takes over the allocation of \p rhs, which is left empty.
+    SimdVector(SimdVector &&rhs) noexcept
+        : m_mem(rhs.m_mem), m_size(rhs.m_size), m_capacity(rhs.m_capacity)
+    {
+        rhs.m_mem = nullptr;
+        rhs.m_size = 0;
+        rhs.m_capacity = 0;
+    }
+
+    ~SimdVector() { deallocate(); }
+
+    SimdVector &operator=(const SimdVector &rhs)
+    {
+        if (this != &rhs) {
+            clear();
+            reserve(rhs.m_size);
+            std::copy_n(rhs.m_mem, rhs.vectorsCount() * V::Size, m_mem);
+            m_size = rhs.m_size;
+        }
+        return *this;
+    }
+
+    SimdVector &operator=(SimdVector &&rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+
+    /**
+     * Resizes to the size of the Memory operands of \p e and evaluates \p e in a single
+     * loop (see MemoryExpression). The padding is zeroed afterwards.
+     */
+    template <typename Op, typename L, typename R>
+    SimdVector &operator=(const MemoryExpression<V, Op, L, R> &e)
+    {
+        resize(e.entriesCount());
+        Base::assign(e);
+        setSize(m_size);
+        return *this;
+    }
+
+    void swap(SimdVector &rhs) noexcept
+    {
+        std::swap(m_mem, rhs.m_mem);
+        std::swap(m_size, rhs.m_size);
+        std::swap(m_capacity, rhs.m_capacity);
+    }
+
+    /**
+     * \name Size and capacity
+     * entriesCount() and size() are synonyms; vectorsCount() is the number of (partially
+     * filled) vectors that span the entries.
+     */
+    ///@{
+    Vc_ALWAYS_INLINE Vc_PURE size_t entriesCount() const { return m_size; }
+    Vc_ALWAYS_INLINE Vc_PURE size_t vectorsCount() const { return vectorsFor(m_size); }
+    Vc_ALWAYS_INLINE Vc_PURE size_t size() const { return m_size; }
+    Vc_ALWAYS_INLINE Vc_PURE size_t capacity() const { return m_capacity; }
+    Vc_ALWAYS_INLINE Vc_PURE bool empty() const { return m_size == 0; }
+
+    Vc_ALWAYS_INLINE Vc_PURE T *data() { return m_mem; }
+    Vc_ALWAYS_INLINE Vc_PURE const T *data() const { return m_mem; }
+    ///@}
+
+    /**
+     * Makes room for at least \p n entries. Invalidates all pointers and references into
+     * the SimdVector if the capacity grows.
+     */
+    void reserve(size_t n)
+    {
+        if (n > m_capacity) {
+            reallocate(vectorsFor(n) * V::Size);
+        }
+    }
+
+    /// Reduces the capacity to the size, rounded up to whole vectors.
+    void shrink_to_fit()
+    {
+        if (vectorsFor(m_size) * V::Size < m_capacity) {
+            reallocate(vectorsFor(m_size) * V::Size);
+        }
+    }
+
+    /// Appends \p x. The capacity doubles if it is exhausted.
+    Vc_ALWAYS_INLINE void push_back(T x)
+    {
+        if (Vc_IS_UNLIKELY(m_size == m_capacity)) {
+            reallocate(std::max<size_t>(2 * m_capacity, V::Size));
+        }
+        if (m_size % V::Size == 0) {
+            // the first entry of a new vector: establish the zero padding
+            V::Zero().store(&m_mem[m_size], Vc::Aligned);
+        }
+        m_mem[m_size++] = x;
+    }
+
+    /// Removes the last entry.
+    Vc_ALWAYS_INLINE void pop_back()
+    {
+        assert(m_size > 0);
+        m_mem[--m_size] = T();
+    }
+
+    /**
+     * Changes the size to \p n. New entries are set to \p value, removed entries become
+     * padding (if they are part of the last vector) or unused capacity.
+     */
+    void resize(size_t n, T value = T())
+    {
+        if (n > m_size) {
+            if (n > m_capacity) {
+                reallocate(std::max(vectorsFor(n) * V::Size, 2 * m_capacity));
+            }
+            std::fill(m_mem + m_size, m_mem + n, value);
+        }
+        setSize(n);
+    }
+
+    /// Removes all entries. The capacity stays unchanged.
+    void clear() { setSize(0); }
+
+    /// Scalar access with bounds checking.
+    T &at(size_t i)
+    {
+        if (i >= m_size) {
+            throw std::out_of_range("Vc::SimdVector::at");
+        }
+        return m_mem[i];
+    }
+    const T &at(size_t i) const
+    {
+        if (i >= m_size) {
+            throw std::out_of_range("Vc::SimdVector::at");
+        }
+        return m_mem[i];
+    }
+
+    T &front() { return m_mem[0]; }
+    const T &front() const { return m_mem[0]; }
+    T &back() { return m_mem[m_size - 1]; }
+    const T &back() const { return m_mem[m_size - 1]; }
+
+private:
+    // sets m_size to n and zeroes the padding of the (new) last vector
+    void setSize(size_t n)
+    {
+        std::fill_n(m_mem + n, (V::Size - n % V::Size) % V::Size, T());
+        m_size = n;
+    }
+
+    // moves the entries into a new allocation of \p newCapacity entries
+    void reallocate(size_t newCapacity)
+    {
+        T *mem = newCapacity == 0 ? nullptr : Vc::malloc<T, Allocation>(newCapacity);
+        if (m_mem) {
+            std::memcpy(mem, m_mem, vectorsCount() * sizeof(V));
+        }
+        deallocate();
+        m_mem = mem;
+        m_capacity = newCapacity;
+    }
+
+    void deallocate()
+    {
+        if (m_mem) {
+            Vc::free<Allocation>(m_mem, m_capacity);
+        }
+    }
+};
+
+template <typename T, typename A>
+Vc_ALWAYS_INLINE void swap(SimdVector<T, A> &a, SimdVector<T, A> &b) noexcept
+{
+    a.swap(b);
+}
+}  // namespace Common
+
+using Common::SimdVector;
+}  // namespace Vc
+
+#endif  // VC_COMMON_SIMDVECTOR_H_
+
+// vim: foldmethod=marker
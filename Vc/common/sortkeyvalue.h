@@ -0,0 +1,247 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_SORTKEYVALUE_H_
+#define VC_COMMON_SORTKEYVALUE_H_
+
+#include <utility>
+#include "../type_traits"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+// lane_mask {{{
+/**\internal
+ * Converts the mask \p k of the lane index type to the mask type of \p V.
+ */
+template <class V, class K> Vc_INTRINSIC typename V::Mask lane_mask(const K &k)
+{
+    return simd_cast<typename V::Mask>(k);
+}
+// }}}
+// compare_exchange {{{
+/**\internal
+ * One layer of a sorting network on \p keys with the same exchanges applied to \p values.
+ *
+ * Every lane in \p lower is compared with the lane \p j entries above, every other lane
+ * with the lane \p j entries below. A lane in \p keepMin receives the smaller key of the
+ * pair, the other lanes the larger key. Lanes not in \p active keep their entries.
+ */
+template <class V, class W>
+Vc_INTRINSIC void compare_exchange(V &keys, W &values, int j, const typename V::Mask &lower,
+                                   const typename V::Mask &keepMin,
+                                   const typename V::Mask &active)
+{
+    typedef typename W::Mask WM;
+    const V otherKeys = iif(lower, keys.shifted(j), keys.shifted(-j));
+    const W otherValues =
+        iif(simd_cast<WM>(lower), values.shifted(j), values.shifted(-j));
+    const typename V::Mask take =
+        active && ((keepMin && otherKeys < keys) || (!keepMin && otherKeys > keys));
+    keys = iif(take, otherKeys, keys);
+    values = iif(simd_cast<WM>(take), otherValues, values);
+}
+// }}}
+// bitonic_merge_key_value {{{
+/**\internal
+ * Sorts the bitonic sequence in \p keys, which must have a power-of-two size, in
+ * ascending order and applies the same permutation to \p values.
+ */
+template <class V, class W> Vc_INTRINSIC void bitonic_merge_key_value(V &keys, W &values)
+{
+    typedef typename V::IndexType IV;
+    const IV lane(Vc::IndexesFromZero);
+    const typename V::Mask all(true);
+    for (int j = V::Size / 2; j >= 1; j /= 2) {
+        const auto lower = lane_mask<V>((lane & IV(j)) == IV(0));
+        compare_exchange(keys, values, j, lower, lower, all);
+    }
+}
+// }}}
+// sort_key_value_impl {{{
+/**\internal
+ * Bitonic sorting network for power-of-two sizes.
+ */
+template <class V, class W>
+Vc_INTRINSIC void sort_key_value_impl(V &keys, W &values, std::true_type)
+{
+    typedef typename V::IndexType IV;
+    const IV lane(Vc::IndexesFromZero);
+    const typename V::Mask all(true);
+    for (int k = 2; k <= int(V::Size); k *= 2) {
+        const auto ascending = (lane & IV(k)) == IV(0);
+        for (int j = k / 2; j >= 1; j /= 2) {
+            const auto lower = (lane & IV(j)) == IV(0);
+            compare_exchange(keys, values, j, lane_mask<V>(lower),
+                             lane_mask<V>(!(lower ^ ascending)), all);
+        }
+    }
+}
+
+/**\internal
+ * Odd-even transposition sorting network for all other sizes.
+ */
+template <class V, class W>
+Vc_INTRINSIC void sort_key_value_impl(V &keys, W &values, std::false_type)
+{
+    typedef typename V::IndexType IV;
+    const IV lane(Vc::IndexesFromZero);
+    for (int phase = 0; phase < int(V::Size); ++phase) {
+        const auto lower = (lane & IV(1)) == IV(phase & 1);
+        const auto active = (lower && lane < IV(int(V::Size) - 1)) || (!lower && lane > IV(0));
+        compare_exchange(keys, values, 1, lane_mask<V>(lower), lane_mask<V>(lower),
+                         lane_mask<V>(active));
+    }
+}
+// }}}
+// use_sorting_network {{{
+/**\internal
+ * Identifies the vector types whose sorted() uses an intrinsics sorting network. With
+ * fewer than 8 entries the generic network needs at most three layers and is faster than
+ * computing the ranks. The 64-bit integer masks cannot be cast to the payload masks, which
+ * the generic network requires.
+ */
+template <class V, class T = typename V::EntryType>
+struct use_sorting_network_impl
+    : public std::integral_constant<bool, (V::Size >= 8 || (std::is_integral<T>::value &&
+                                                            sizeof(T) == 8))> {
+};
+template <class V> struct use_sorting_network : public std::false_type {};
+template <class T>
+struct use_sorting_network<Vector<T, VectorAbi::Sse>>
+    : public use_sorting_network_impl<Vector<T, VectorAbi::Sse>> {
+};
+template <class T>
+struct use_sorting_network<Vector<T, VectorAbi::Avx>>
+    : public use_sorting_network_impl<Vector<T, VectorAbi::Avx>> {
+};
+// }}}
+// sort_key_value_nan {{{
+/**\internal
+ * Sorts with the generic network and returns \c true if any of the floating-point
+ * \p keys is NaN.
+ */
+template <class V, class W>
+Vc_INTRINSIC bool sort_key_value_nan(V &keys, W &values, std::true_type)
+{
+    if (any_of(isnan(keys))) {
+        sort_key_value_impl(keys, values, std::true_type());
+        return true;
+    }
+    return false;
+}
+template <class V, class W>
+Vc_INTRINSIC bool sort_key_value_nan(V &, W &, std::false_type)
+{
+    return false;
+}
+// }}}
+// sort_key_value_dispatch {{{
+/**\internal
+ * Sorts \p keys with sorted() and moves every entry of \p values to the rank of its key.
+ * The rank of a key counts the smaller keys and the equal keys in lower lanes. NaN keys
+ * have no rank and use the generic network instead.
+ */
+template <class V, class W>
+Vc_INTRINSIC void sort_key_value_dispatch(V &keys, W &values, std::true_type)
+{
+    typedef typename V::EntryType T;
+    if (sort_key_value_nan(keys, values, std::is_floating_point<T>())) {
+        return;
+    }
+    const V lane(Vc::IndexesFromZero);
+    V rank = V::Zero();
+    for (int r = 1; r < int(V::Size); ++r) {
+        // lane i compares against lane (i + r) % Size, which is a lower lane if i >= Size - r
+        const V other = keys.rotated(r);
+        const typename V::Mask lowerLane = lane >= V(T(int(V::Size) - r));
+        rank(other < keys || (lowerLane && other == keys)) += V(T(1));
+    }
+    alignas(static_cast<std::size_t>(W::MemoryAlignment)) typename W::EntryType
+        buffer[W::Size];
+    values.scatter(&buffer[0], simd_cast<typename W::IndexType>(rank));
+    values.load(&buffer[0], Vc::Aligned);
+    keys = keys.sorted();
+}
+
+template <class V, class W>
+Vc_INTRINSIC void sort_key_value_dispatch(V &keys, W &values, std::false_type)
+{
+    sort_key_value_impl(
+        keys, values, std::integral_constant<bool, (V::Size & (V::Size - 1)) == 0>());
+}
+// }}}
+}  // namespace Detail
+
+/**
+ * \ingroup Utilities
+ *
+ * Sorts the entries of \p keys in ascending order and permutes the entries of \p values
+ * the same way.
+ *
+ * \param keys   The vector to sort. Any Vc::Vector or Vc::SimdArray type.
+ * \param values The payload. Any Vc::Vector or Vc::SimdArray type with as many entries as
+ *               \p keys.
+ *
+ * \code
+ * float_v distance = ...;
+ * int_v id = ...;
+ * Vc::sort_key_value(distance, id);  // id[0] now identifies the smallest distance
+ * \endcode
+ *
+ * The order of entries with equal keys is unspecified.
+ */
+template <class V, class W>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value && is_simd_vector<W>::value &&
+                               V::Size == W::Size,
+                           void>
+sort_key_value(V &keys, W &values)
+{
+    Detail::sort_key_value_dispatch(keys, values, Detail::use_sorting_network<V>());
+}
+
+/**
+ * \ingroup Utilities
+ *
+ * Returns the sorted entries of \p x together with the lane indexes that sort \p x, i.e.
+ * `result.first[i] == x[result.second[i]]`.
+ *
+ * \param x Any Vc::Vector or Vc::SimdArray type.
+ */
+template <class V>
+Vc_ALWAYS_INLINE enable_if<is_simd_vector<V>::value, std::pair<V, typename V::IndexType>>
+sorted_with_index(const V &x)
+{
+    std::pair<V, typename V::IndexType> r(x, typename V::IndexType(Vc::IndexesFromZero));
+    sort_key_value(r.first, r.second);
+    return r;
+}
+}  // namespace Vc
+
+#endif  // VC_COMMON_SORTKEYVALUE_H_
@@ -0,0 +1,263 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_COMMON_THREADPOOL_H_
+#define VC_COMMON_THREADPOOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+/**\internal
+ * A small work-stealing thread pool that backs the Vc::par variants of the algorithms.
+ *
+ * The pool executes one parallel loop at a time. The index range of the loop is split
+ * evenly over one slot per participating thread (the workers plus the calling thread).
+ * Every thread consumes its own slot from the front and, once it runs dry, steals the
+ * back half of the range of another slot. parallel_for_static skips the stealing, so that
+ * the thread executing an index is known in advance.
+ */
+class ThreadPool
+{
+public:
+    /// Creates a pool with \p workers threads in addition to the calling thread.
+    explicit ThreadPool(unsigned workers) : slots(workers + 1)
+    {
+        threads.reserve(workers);
+        for (unsigned i = 1; i <= workers; ++i) {
+            threads.emplace_back([this, i]() { workerMain(i); });
+        }
+    }
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        wakeup.notify_all();
+        for (auto &t : threads) {
+            t.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// The process-wide pool, using one thread per hardware thread.
+    static ThreadPool &global()
+    {
+        static ThreadPool pool(std::max(1u, std::thread::hardware_concurrency()) - 1);
+        return pool;
+    }
+
+    /// The number of threads that execute a parallel loop, including the caller.
+    std::size_t size() const { return slots.size(); }
+
+    /**
+     * Calls \p f(i) for every i in [0, \p count) and returns after all calls completed.
+     * The calls are distributed over the threads of the pool. Calls from inside a
+     * parallel loop execute serially on the calling thread.
+     */
+    template <class F> void parallel_for(std::size_t count, F f)
+    {
+        execute(count, f, true);
+    }
+
+    /**
+     * Calls \p f(i) for every i in [0, \p count) and returns after all calls completed.
+     * Unlike parallel_for, the indexes are not rebalanced: thread s of the pool (0 is the
+     * calling thread) executes exactly the indexes in [count * s / size(),
+     * count * (s + 1) / size()). With \p count == size() thread s executes only index s.
+     * A single call (\p count == 1) and calls from inside a parallel loop execute on the
+     * calling thread.
+     */
+    template <class F> void parallel_for_static(std::size_t count, F f)
+    {
+        execute(count, f, false);
+    }
+
+private:
+    template <class F> void execute(std::size_t count, F &f, bool allowStealing)
+    {
+        if (count == 0) {
+            return;
+        }
+        if (insideLoop() || threads.empty() || count == 1) {
+            for (std::size_t i = 0; i < count; ++i) {
+                f(i);
+            }
+            return;
+        }
+
+        std::lock_guard<std::mutex> submitLock(submit);
+        job = &f;
+        run = [](void *ff, std::size_t i) { (*static_cast<F *>(ff))(i); };
+        failed = false;
+        const std::size_t n = slots.size();
+        for (std::size_t s = 0; s < n; ++s) {
+            std::lock_guard<std::mutex> lock(slots[s].mutex);
+            slots[s].begin = count * s / n;
+            slots[s].end = count * (s + 1) / n;
+        }
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stealing = allowStealing;
+            active = threads.size();
+            ++generation;
+        }
+        wakeup.notify_all();
+
+        insideLoop() = true;
+        work(0);
+        insideLoop() = false;
+
+        std::unique_lock<std::mutex> lock(mutex);
+        finished.wait(lock, [&]() { return active == 0; });
+        job = nullptr;
+        if (error) {
+            std::exception_ptr e = std::move(error);
+            error = nullptr;
+            std::rethrow_exception(e);
+        }
+    }
+
+    struct Slot {
+        std::mutex mutex;
+        std::size_t begin = 0;
+        std::size_t end = 0;
+    };
+
+    static bool &insideLoop()
+    {
+        static thread_local bool inside = false;
+        return inside;
+    }
+
+    bool pop(std::size_t s, std::size_t &i)
+    {
+        std::lock_guard<std::mutex> lock(slots[s].mutex);
+        if (slots[s].begin == slots[s].end) {
+            return false;
+        }
+        i = slots[s].begin++;
+        return true;
+    }
+
+    bool steal(std::size_t s)
+    {
+        const std::size_t n = slots.size();
+        for (std::size_t k = 1; k < n; ++k) {
+            Slot &victim = slots[(s + k) % n];
+            std::size_t begin, end;
+            {
+                std::lock_guard<std::mutex> lock(victim.mutex);
+                const std::size_t remaining = victim.end - victim.begin;
+                if (remaining == 0) {
+                    continue;
+                }
+                end = victim.end;
+                begin = end - (remaining + 1) / 2;
+                victim.end = begin;
+            }
+            std::lock_guard<std::mutex> lock(slots[s].mutex);
+            slots[s].begin = begin;
+            slots[s].end = end;
+            return true;
+        }
+        return false;
+    }
+
+    void work(std::size_t s)
+    {
+        std::size_t i;
+        while (pop(s, i) || (stealing && steal(s) && pop(s, i))) {
+            if (failed.load(std::memory_order_relaxed)) {
+                continue;  // drain the remaining indexes without executing them
+            }
+            try {
+                run(job, i);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                failed = true;
+            }
+        }
+    }
+
+    void workerMain(std::size_t s)
+    {
+        insideLoop() = true;
+        unsigned seen = 0;
+        std::unique_lock<std::mutex> lock(mutex);
+        for (;;) {
+            wakeup.wait(lock, [&]() { return stop || generation != seen; });
+            if (stop) {
+                return;
+            }
+            seen = generation;
+            lock.unlock();
+            work(s);
+            lock.lock();
+            if (--active == 0) {
+                finished.notify_all();
+            }
+        }
+    }
+
+    std::vector<Slot> slots;
+    std::vector<std::thread> threads;
+    std::mutex submit;
+    std::mutex mutex;
+    std::condition_variable wakeup;
+    std::condition_variable finished;
+    void *job = nullptr;
+    void (*run)(void *, std::size_t) = nullptr;
+    std::size_t active = 0;
+    unsigned generation = 0;
+    bool stealing = true;
+    bool stop = false;
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+};
+}  // namespace Common
+}  // namespace Vc
+
+#endif // VC_COMMON_THREADPOOL_H_
@@ -66,6 +66,8 @@ template<typename Impl> struct Trigonometric
     template<typename T> static T sin(const T &_x);
     template<typename T> static T cos(const T &_x);
     template<typename T> static void sincos(const T &_x, T *_sin, T *_cos);
+    template<typename T> static void sincos(const T &x0, const T &x1, T *sin0, T *cos0, T *sin1, T *cos1);
+    template<typename T> static T tan(const T &_x);
     template<typename T> static T asin (const T &_x);
     template<typename T> static T atan (const T &_x);
     template<typename T> static T atan2(const T &y, const T &x);
@@ -129,6 +131,8 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi>
  * vs. Windows; fpmath=sse vs. fpmath=387)
  *
  * \note Vc versions before 1.4 had different precision.
+ *
+ * \see fast::sin and precision for a faster variant with a larger error.
  */
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> sin(const Vector<T, Abi> &x)
@@ -146,6 +150,8 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> sin(const Vector<T, Abi>
  * \note The single-precision implementation has a precision of max. 2 ulp (mean 0.18 ulp) in the range [-8192, 8192].
  * \note The double-precision implementation has a precision of max. 3 ulp (mean 1160 ulp) in the range [-8192, 8192].
  * \note Vc versions before 1.4 had different precision.
+ *
+ * \see fast::cos and precision for a faster variant with a larger error.
  */
 template <typename T, typename Abi>
 Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi> &x)
@@ -154,6 +160,22 @@ Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> cos(const Vector<T, Abi>
 }
 #endif
 
+/**
+ * \ingroup Math
+ * Returns the tangent of all input values in \p x.
+ *
+ * \param x The values to apply the tangent function on.
+ * \returns the tangent of \p x.
+ *
+ * \note The single-precision implementation has an error of max. 5 ulp (mean 0.5 ulp) in the range [-8192, 8192].
+ * \note The double-precision implementation has an error of max. 4 ulp (mean 0.5 ulp) in the range [-8192, 8192].
+ */
+template <typename T, typename Abi>
+Vc_INTRINSIC Vector<T, detail::not_fixed_size_abi<Abi>> tan(const Vector<T, Abi> &x)
+{
+    return Detail::Trig<T, Abi>::tan(x);
+}
+
 /**
  * \ingroup Math
  * Returns the arcsine of all input values in \p x.
@@ -220,6 +242,25 @@ Vc_INTRINSIC void sincos(const Vector<T, Abi> &x,
 {
     Detail::Trig<T, Abi>::sincos(x, sin, cos);
 }
+
+namespace Detail
+{
+// SimdArray<T, N> with two halves of Vector<T, Abi> calls this instead of two sincos
+// calls, so that the range reduction and series of both halves can be interleaved.
+template <typename T, typename Abi>
+struct SincosPair<Vector<T, Abi>,
+                  enable_if<std::is_floating_point<T>::value &&
+                                (std::is_same<Abi, VectorAbi::Sse>::value ||
+                                 std::is_same<Abi, VectorAbi::Avx>::value),
+                            void>>
+{
+    using V = Vector<T, Abi>;
+    static Vc_INTRINSIC void apply(const V &x0, const V &x1, V *s0, V *c0, V *s1, V *c1)
+    {
+        Trig<T, Abi>::sincos(x0, x1, s0, c0, s1, c1);
+    }
+};
+}  // namespace Detail
 #endif
 }  // namespace Vc_VERSIONED_NAMESPACE
 
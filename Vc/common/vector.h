@@ -202,7 +202,8 @@ public:
      *
      * Currently the state of the random number generator cannot be modified and starts
      * off with the same state. Thus you will get the same sequence of numbers for the
-     * same sequence of calls.
+     * same sequence of calls. Every thread uses its own state, starting from the same
+     * seed. Use RandomEngine for seedable, independent sequences per thread.
      *
      * \return a new random vector. Floating-point values will be in the 0-1 range.
      * Integers will use the full range the integer representation allows.
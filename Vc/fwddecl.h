@@ -40,6 +40,7 @@ struct Scalar {};
 struct Sse {};
 struct Avx {};
 struct Mic {};
+struct Generic {};
 template <class T> struct DeduceCompatible;
 template <class T> struct DeduceBest;
 }  // namespace VectorAbi
@@ -93,6 +94,7 @@ template <class T> using compatible = typename VectorAbi::DeduceCompatible<T>::t
 template <class T> using native = typename VectorAbi::DeduceBest<T>::type;
 using __sse = VectorAbi::Sse;
 using __avx = VectorAbi::Avx;
+using __generic = VectorAbi::Generic;
 struct __avx512;
 struct __neon;
 }  // namespace simd_abi
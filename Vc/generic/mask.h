@@ -0,0 +1,262 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_GENERIC_MASK_H_
+#define VC_GENERIC_MASK_H_
+
+#include "types.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+template <typename T> class Mask<T, VectorAbi::Generic>
+{
+    using VectorTypeF = typename Generic::VectorTypeHelper<T>::Type;
+
+public:
+    using abi = VectorAbi::Generic;
+
+    static constexpr size_t Size = Vc_GENERIC_VECTOR_BYTES / sizeof(T);
+    static constexpr size_t MemoryAlignment = Size;
+    static constexpr std::size_t size() { return Size; }
+
+    /**
+     * The \c EntryType of masks is always bool, independent of \c T.
+     */
+    typedef bool EntryType;
+    using value_type = EntryType;
+
+    using EntryReference = Vc::Detail::ElementReference<Mask>;
+    using reference = EntryReference;
+
+    /**
+     * The \c VectorEntryType, in contrast to \c EntryType, reveals information about the SIMD
+     * implementation. This type is useful for the \c sizeof operator in generic functions.
+     */
+    typedef Common::MaskBool<sizeof(T)> VectorEntryType;
+
+    /**
+     * The \c VectorType reveals the implementation-specific internal type used for the SIMD
+     * type. It is the type a comparison of two generic vectors of \c T yields: a vector of
+     * signed integers of \c sizeof(T) with all bits set in the active lanes.
+     */
+    using VectorType = decltype(std::declval<VectorTypeF>() == std::declval<VectorTypeF>());
+
+    /**
+     * The associated Vector<T> type.
+     */
+    using Vector = Generic::Vector<T>;
+
+    /**
+     * The integer type returned from toInt(). It has at least \c Size bits.
+     */
+    using IntType = typename std::conditional<(Size > 32), unsigned long long, int>::type;
+
+    Vc_INTRINSIC Mask() = default;
+    Vc_INTRINSIC Mask(const VectorType &x) : k(x) {}
+    Vc_INTRINSIC explicit Mask(bool b) : k(b ? ~VectorType() : VectorType()) {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerZero) : k() {}
+    Vc_INTRINSIC explicit Mask(VectorSpecialInitializerOne) : k(~VectorType()) {}
+    Vc_INTRINSIC static Mask Zero() { return Mask(false); }
+    Vc_INTRINSIC static Mask One() { return Mask(true); }
+
+    // implicit cast
+    template <typename U>
+    Vc_INTRINSIC Mask(const Mask<U, abi> &rhs,
+                      Common::enable_if_mask_converts_implicitly<Mask, T, Mask<U, abi>> =
+                          nullarg)
+    {
+        static_assert(Mask<U, abi>::Size == Size, "implicit conversion requires equal Size");
+        for (size_t i = 0; i < Size; ++i) {
+            k[i] = rhs.data()[i] ? -1 : 0;
+        }
+    }
+
+#if Vc_IS_VERSION_1
+    // explicit cast, implemented via simd_cast (in generic/simd_cast_caller.tcc)
+    template <typename U>
+    Vc_DEPRECATED(
+        "use simd_cast instead of explicit type casting to convert between mask types")
+        Vc_INTRINSIC_L
+        explicit Mask(U &&rhs, Common::enable_if_mask_converts_explicitly<T, U> = nullarg)
+            Vc_INTRINSIC_R;
+#endif
+
+    Vc_ALWAYS_INLINE explicit Mask(const bool *mem) { load(mem); }
+    template <typename Flags> Vc_ALWAYS_INLINE explicit Mask(const bool *mem, Flags)
+    {
+        load(mem);
+    }
+
+    Vc_ALWAYS_INLINE void load(const bool *mem)
+    {
+        for (size_t i = 0; i < Size; ++i) {
+            k[i] = mem[i] ? -1 : 0;
+        }
+    }
+    template <typename Flags> Vc_ALWAYS_INLINE void load(const bool *mem, Flags)
+    {
+        load(mem);
+    }
+
+    Vc_ALWAYS_INLINE void store(bool *mem) const
+    {
+        for (size_t i = 0; i < Size; ++i) {
+            mem[i] = k[i] != 0;
+        }
+    }
+    template <typename Flags> Vc_ALWAYS_INLINE void store(bool *mem, Flags) const
+    {
+        store(mem);
+    }
+
+    Vc_ALWAYS_INLINE bool operator==(const Mask &rhs) const
+    {
+        for (size_t i = 0; i < Size; ++i) {
+            if (k[i] != rhs.k[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    Vc_ALWAYS_INLINE bool operator!=(const Mask &rhs) const { return !operator==(rhs); }
+
+    Vc_ALWAYS_INLINE Mask operator&&(const Mask &rhs) const { return Mask(k & rhs.k); }
+    Vc_ALWAYS_INLINE Mask operator& (const Mask &rhs) const { return Mask(k & rhs.k); }
+    Vc_ALWAYS_INLINE Mask operator||(const Mask &rhs) const { return Mask(k | rhs.k); }
+    Vc_ALWAYS_INLINE Mask operator| (const Mask &rhs) const { return Mask(k | rhs.k); }
+    Vc_ALWAYS_INLINE Mask operator^ (const Mask &rhs) const { return Mask(k ^ rhs.k); }
+    Vc_ALWAYS_INLINE Mask operator!() const { return Mask(~k); }
+
+    Vc_ALWAYS_INLINE Mask &operator&=(const Mask &rhs) { k &= rhs.k; return *this; }
+    Vc_ALWAYS_INLINE Mask &operator|=(const Mask &rhs) { k |= rhs.k; return *this; }
+    Vc_ALWAYS_INLINE Mask &operator^=(const Mask &rhs) { k ^= rhs.k; return *this; }
+
+    Vc_ALWAYS_INLINE bool isFull() const { return count() == int(Size); }
+    Vc_ALWAYS_INLINE bool isNotEmpty() const { return !isEmpty(); }
+    Vc_ALWAYS_INLINE bool isEmpty() const
+    {
+        for (size_t i = 0; i < Size; ++i) {
+            if (k[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+    Vc_ALWAYS_INLINE bool isMix() const { return !isEmpty() && !isFull(); }
+
+    Vc_ALWAYS_INLINE VectorType &data() { return k; }
+    Vc_ALWAYS_INLINE const VectorType &data() const { return k; }
+
+private:
+    friend reference;
+    static Vc_INTRINSIC bool get(const Mask &o, int i) noexcept { return o.k[i] != 0; }
+    template <typename U>
+    static Vc_INTRINSIC void set(Mask &o, int i, U &&v) noexcept(
+        noexcept(std::declval<bool &>() = std::declval<U>()))
+    {
+        o.k[i] = bool(std::forward<U>(v)) ? -1 : 0;
+    }
+
+public:
+    /**
+     * \note the returned object models the concept of a reference and
+     * as such it can exist longer than the data it is referencing.
+     * \note to avoid lifetime issues, we strongly advice not to store
+     * any reference objects.
+     */
+    Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+    {
+        return {*this, int(index)};
+    }
+    Vc_ALWAYS_INLINE value_type operator[](size_t index) const noexcept
+    {
+        return get(*this, int(index));
+    }
+
+    Vc_ALWAYS_INLINE int count() const
+    {
+        int n = 0;
+        for (size_t i = 0; i < Size; ++i) {
+            n += k[i] != 0;
+        }
+        return n;
+    }
+
+    /**
+     * Returns the index of the first one in the mask.
+     *
+     * The return value is undefined if the mask is empty.
+     */
+    Vc_ALWAYS_INLINE int firstOne() const
+    {
+        for (size_t i = 0; i < Size; ++i) {
+            if (k[i]) {
+                return int(i);
+            }
+        }
+        return int(Size);
+    }
+    Vc_ALWAYS_INLINE IntType toInt() const
+    {
+        IntType r = 0;
+        for (size_t i = 0; i < Size; ++i) {
+            r |= IntType(k[i] != 0) << i;
+        }
+        return r;
+    }
+
+    template <typename G> static Vc_INTRINSIC Mask generate(G &&gen)
+    {
+        Mask r;
+        for (size_t i = 0; i < Size; ++i) {
+            r.k[i] = gen(i) ? -1 : 0;
+        }
+        return r;
+    }
+
+    Vc_INTRINSIC Vc_PURE Mask shifted(int amount) const
+    {
+        Mask r(false);
+        for (int i = 0; i < int(Size); ++i) {
+            const int j = i + amount;
+            if (j >= 0 && j < int(Size)) {
+                r.k[i] = k[j];
+            }
+        }
+        return r;
+    }
+
+private:
+    VectorType k;
+};
+template <typename T> constexpr size_t Mask<T, VectorAbi::Generic>::Size;
+template <typename T> constexpr size_t Mask<T, VectorAbi::Generic>::MemoryAlignment;
+
+}  // namespace Vc
+
+#endif // VC_GENERIC_MASK_H_
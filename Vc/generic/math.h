@@ -0,0 +1,247 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_GENERIC_MATH_H_
+#define VC_GENERIC_MATH_H_
+
+#include <cmath>
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// min & max {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> min(const Generic::Vector<T> &x,
+                                        const Generic::Vector<T> &y)
+{
+    Generic::Vector<T> r = x;
+    r.assign(y, Generic::Mask<T>(y.data() < x.data()));
+    return r;
+}
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> max(const Generic::Vector<T> &x,
+                                        const Generic::Vector<T> &y)
+{
+    Generic::Vector<T> r = x;
+    r.assign(y, Generic::Mask<T>(y.data() > x.data()));
+    return r;
+}
+
+// abs & copysign {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE enable_if<std::is_floating_point<T>::value, Generic::Vector<T>>
+abs(const Generic::Vector<T> &x)
+{
+    using V = typename Generic::Vector<T>::VectorType;
+    using I = typename Generic::Mask<T>::VectorType;
+    // -0 has only the sign bit set
+    const I sign = I(Generic::Vector<T>(T(-0.)).data());
+    return Generic::Vector<T>(V(I(x.data()) & ~sign));
+}
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE
+    enable_if<std::is_integral<T>::value && std::is_signed<T>::value, Generic::Vector<T>>
+    abs(const Generic::Vector<T> &x)
+{
+    Generic::Vector<T> r = x;
+    r.assign(-x, Generic::Mask<T>(x.data() < Generic::Vector<T>::Zero().data()));
+    return r;
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE enable_if<std::is_floating_point<T>::value, Generic::Vector<T>>
+copysign(const Generic::Vector<T> &mag, const Generic::Vector<T> &sign)
+{
+    using V = typename Generic::Vector<T>::VectorType;
+    using I = typename Generic::Mask<T>::VectorType;
+    const I s = I(Generic::Vector<T>(T(-0.)).data());
+    return Generic::Vector<T>(V((I(mag.data()) & ~s) | (I(sign.data()) & s)));
+}
+
+// sqrt, rsqrt & reciprocal {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> sqrt(const Generic::Vector<T> &x)
+{
+    return x.apply([](T a) { return std::sqrt(a); });
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> rsqrt(const Generic::Vector<T> &x)
+{
+    return Generic::Vector<T>(T(1)) / sqrt(x);
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> reciprocal(const Generic::Vector<T> &x)
+{
+    return Generic::Vector<T>(T(1)) / x;
+}
+
+// elementwise <cmath> functions {{{1
+// There are no generic vector builtins for these, so they apply the scalar function to
+// every lane. The loops are simple enough for the auto-vectorizer (e.g. with libmvec).
+#define Vc_MATH_FUNCTION(name_, std_)                                                    \
+    template <typename T>                                                                \
+    Vc_ALWAYS_INLINE Generic::Vector<T> name_(const Generic::Vector<T> &x)               \
+    {                                                                                    \
+        return x.apply([](T a) { return T(std::std_(a)); });                             \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_MATH_FUNCTION(sin, sin);
+Vc_MATH_FUNCTION(cos, cos);
+Vc_MATH_FUNCTION(tan, tan);
+Vc_MATH_FUNCTION(asin, asin);
+Vc_MATH_FUNCTION(atan, atan);
+Vc_MATH_FUNCTION(log, log);
+Vc_MATH_FUNCTION(log10, log10);
+Vc_MATH_FUNCTION(log2, log2);
+Vc_MATH_FUNCTION(log1p, log1p);
+Vc_MATH_FUNCTION(exp, exp);
+Vc_MATH_FUNCTION(exp2, exp2);
+Vc_MATH_FUNCTION(expm1, expm1);
+Vc_MATH_FUNCTION(cbrt, cbrt);
+Vc_MATH_FUNCTION(sinh, sinh);
+Vc_MATH_FUNCTION(cosh, cosh);
+Vc_MATH_FUNCTION(tanh, tanh);
+Vc_MATH_FUNCTION(erf, erf);
+Vc_MATH_FUNCTION(erfc, erfc);
+Vc_MATH_FUNCTION(trunc, trunc);
+Vc_MATH_FUNCTION(floor, floor);
+Vc_MATH_FUNCTION(ceil, ceil);
+// Vc rounds halfway cases to even, which is what nearbyint does in the default rounding
+// mode
+Vc_MATH_FUNCTION(round, nearbyint);
+Vc_MATH_FUNCTION(exponent, logb);
+#undef Vc_MATH_FUNCTION
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> exp10(const Generic::Vector<T> &x)
+{
+    return x.apply([](T a) { return T(std::pow(T(10), a)); });
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE void sincos(const Generic::Vector<T> &x, Generic::Vector<T> *sin,
+                             Generic::Vector<T> *cos)
+{
+    for (size_t i = 0; i < Generic::Vector<T>::Size; ++i) {
+        sin->data()[i] = std::sin(x.data()[i]);
+        cos->data()[i] = std::cos(x.data()[i]);
+    }
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> atan2(const Generic::Vector<T> &y,
+                                          const Generic::Vector<T> &x)
+{
+    return Generic::Vector<T>::generate(
+        [&](size_t i) { return std::atan2(y.data()[i], x.data()[i]); });
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> pow(const Generic::Vector<T> &x,
+                                        const Generic::Vector<T> &y)
+{
+    return Generic::Vector<T>::generate(
+        [&](size_t i) { return std::pow(x.data()[i], y.data()[i]); });
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> hypot(const Generic::Vector<T> &x,
+                                          const Generic::Vector<T> &y)
+{
+    return Generic::Vector<T>::generate(
+        [&](size_t i) { return std::hypot(x.data()[i], y.data()[i]); });
+}
+
+// isfinite, isinf & isnan {{{1
+#ifdef isfinite
+#undef isfinite
+#endif
+#ifdef isnan
+#undef isnan
+#endif
+template <typename T>
+Vc_ALWAYS_INLINE typename Generic::Vector<T>::Mask isnan(const Generic::Vector<T> &x)
+{
+    return typename Generic::Vector<T>::Mask(x.data() != x.data());
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE typename Generic::Vector<T>::Mask isfinite(const Generic::Vector<T> &x)
+{
+    // x - x is NaN for infinities and NaNs, and 0 otherwise
+    return typename Generic::Vector<T>::Mask(x.data() - x.data() ==
+                                             Generic::Vector<T>::Zero().data());
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE typename Generic::Vector<T>::Mask isinf(const Generic::Vector<T> &x)
+{
+    return !isfinite(x) && !isnan(x);
+}
+
+// frexp & ldexp {{{1
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<std::is_floating_point<T>::value, Generic::Vector<T>> frexp(
+    const Generic::Vector<T> &x, fixed_size_simd<int, Generic::Vector<T>::Size> *e)
+{
+    return Generic::Vector<T>::generate([&](size_t i) {
+        int ei;
+        const T r = std::frexp(x.data()[i], &ei);
+        (*e)[i] = ei;
+        return r;
+    });
+}
+
+template <typename T>
+Vc_ALWAYS_INLINE enable_if<std::is_floating_point<T>::value, Generic::Vector<T>> ldexp(
+    const Generic::Vector<T> &x, const fixed_size_simd<int, Generic::Vector<T>::Size> &e)
+{
+    return Generic::Vector<T>::generate(
+        [&](size_t i) { return std::ldexp(x.data()[i], e[i]); });
+}
+
+// fma {{{1
+template <typename T>
+Vc_ALWAYS_INLINE Generic::Vector<T> fma(const Generic::Vector<T> &a,
+                                        const Generic::Vector<T> &b,
+                                        const Generic::Vector<T> &c)
+{
+    if (std::is_integral<T>::value) {
+        return a * b + c;
+    } else {
+        return Generic::Vector<T>::generate(
+            [&](size_t i) { return std::fma(a.data()[i], b.data()[i], c.data()[i]); });
+    }
+}
+
+// }}}1
+}  // namespace Vc
+
+#endif // VC_GENERIC_MATH_H_
+
+// vim: foldmethod=marker
@@ -0,0 +1,73 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_GENERIC_SIMD_CAST_H_
+#define VC_GENERIC_SIMD_CAST_H_
+
+#include "../common/simd_cast.h"
+#include "types.h"
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+// Generic::Vector to Generic::Vector
+// Lanes of the source beyond To::Size are dropped, lanes of To beyond the source's Size
+// are zero. The offset variant converts the offset-th chunk of To::Size lanes.
+template <typename To, int offset = 0, typename From>
+Vc_INTRINSIC Vc_CONST enable_if<Generic::is_vector<To>::value &&
+                                    (offset != 0 || !std::is_same<To, Generic::Vector<From>>::value),
+                                To>
+simd_cast(Generic::Vector<From> x)
+{
+    To r;
+    const size_t first = offset * To::Size;
+    for (size_t i = 0; i < To::Size && first + i < Generic::Vector<From>::Size; ++i) {
+        r[i] = static_cast<typename To::EntryType>(x.data()[first + i]);
+    }
+    return r;
+}
+
+// Generic::Mask to Generic::Mask
+template <typename To, int offset = 0, typename From>
+Vc_INTRINSIC Vc_CONST enable_if<Generic::is_mask<To>::value &&
+                                    (offset != 0 || !std::is_same<To, Generic::Mask<From>>::value),
+                                To>
+simd_cast(Generic::Mask<From> x)
+{
+    To r(false);
+    const size_t first = offset * To::Size;
+    for (size_t i = 0; i < To::Size && first + i < Generic::Mask<From>::Size; ++i) {
+        r[i] = x[first + i];
+    }
+    return r;
+}
+
+}  // namespace Vc
+
+#endif  // VC_GENERIC_SIMD_CAST_H_
+
+// vim: foldmethod=marker
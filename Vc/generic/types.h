@@ -0,0 +1,107 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "../common/types.h"
+#include "../common/vectorabi.h"
+
+#ifndef VC_GENERIC_TYPES_H_
+#define VC_GENERIC_TYPES_H_
+
+/**
+ * \ingroup Utilities
+ *
+ * The number of Bytes in one Vector<T, VectorAbi::Generic> object. Define this macro
+ * before including any Vc header to change the width of the generic vector types. The
+ * value must be a power of two and at least 8. The default is 64 (i.e. 512 bits).
+ */
+#ifndef Vc_GENERIC_VECTOR_BYTES
+#define Vc_GENERIC_VECTOR_BYTES 64
+#endif
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Generic
+{
+static_assert(Vc_GENERIC_VECTOR_BYTES >= 8 &&
+                  (Vc_GENERIC_VECTOR_BYTES & (Vc_GENERIC_VECTOR_BYTES - 1)) == 0,
+              "Vc_GENERIC_VECTOR_BYTES must be a power of two and at least 8");
+
+/**\internal
+ * The compiler's generic vector type for \p T. Arithmetic, bitwise, shift and compare
+ * operators on this type are lowered by the compiler to the instructions of the target.
+ *
+ * The alignment is fixed to the vector size. Otherwise the compiler would reduce it to the
+ * largest native register of the target, and the layout of the same type would differ
+ * between translation units compiled for different targets.
+ */
+template <typename T> struct VectorTypeHelper {
+    typedef T Type __attribute__((__vector_size__(Vc_GENERIC_VECTOR_BYTES),
+                                  __aligned__(Vc_GENERIC_VECTOR_BYTES)));
+};
+
+template <typename T> using Vector = Vc::Vector<T, VectorAbi::Generic>;
+typedef Vector<double>         double_v;
+typedef Vector<float>           float_v;
+typedef Vector<int>               int_v;
+typedef Vector<unsigned int>     uint_v;
+typedef Vector<short>           short_v;
+typedef Vector<unsigned short> ushort_v;
+typedef Vector<signed char>     schar_v;
+typedef Vector<unsigned char>   uchar_v;
+typedef Vector<long long>       llong_v;
+typedef Vector<unsigned long long> ullong_v;
+
+template <typename T> using Mask = Vc::Mask<T, VectorAbi::Generic>;
+typedef Mask<double>         double_m;
+typedef Mask<float>           float_m;
+typedef Mask<int>               int_m;
+typedef Mask<unsigned int>     uint_m;
+typedef Mask<short>           short_m;
+typedef Mask<unsigned short> ushort_m;
+typedef Mask<signed char>     schar_m;
+typedef Mask<unsigned char>   uchar_m;
+typedef Mask<long long>       llong_m;
+typedef Mask<unsigned long long> ullong_m;
+
+template <typename T> struct is_vector : public std::false_type {};
+template <typename T> struct is_vector<Vector<T>> : public std::true_type {};
+template <typename T> struct is_mask : public std::false_type {};
+template <typename T> struct is_mask<Mask<T>> : public std::true_type {};
+}  // namespace Generic
+
+namespace Traits
+{
+template <class T> struct
+is_simd_vector_internal<Vector<T, VectorAbi::Generic>>
+  : public is_valid_vector_argument<T> {};
+
+template<typename T> struct is_simd_mask_internal<Mask<T, VectorAbi::Generic>>
+  : public std::true_type {};
+}  // namespace Traits
+}  // namespace Vc
+
+#endif // VC_GENERIC_TYPES_H_
@@ -0,0 +1,435 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_GENERIC_VECTOR_H_
+#define VC_GENERIC_VECTOR_H_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "types.h"
+#include "mask.h"
+
+#include "macros.h"
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+#define Vc_CURRENT_CLASS_NAME Vector
+/**
+ * \internal
+ * Vector<T> implementation on top of the GCC/Clang generic vector extension
+ * (`__attribute__((vector_size(N)))`). The width is Vc_GENERIC_VECTOR_BYTES and independent
+ * of the SIMD target; the compiler lowers the operations to whatever the target supports,
+ * splitting them into several native registers if necessary.
+ */
+template <typename T> class Vector<T, VectorAbi::Generic>
+{
+    static_assert(std::is_arithmetic<T>::value,
+                  "Vector<T> only accepts arithmetic builtin types as template parameter T.");
+
+    public:
+        using abi = VectorAbi::Generic;
+        using EntryType = T;
+        using VectorEntryType = EntryType;
+        using value_type = EntryType;
+        using VectorType = typename Generic::VectorTypeHelper<T>::Type;
+        using vector_type = VectorType;
+        using reference = Detail::ElementReference<Vector>;
+
+    protected:
+        VectorType m_data = VectorType();
+        template <typename U> using V = Vector<U, abi>;
+
+    public:
+        typedef Generic::Mask<T> Mask;
+        using MaskType = Mask;
+        using mask_type = Mask;
+        typedef const Mask &MaskArgument;
+        typedef const Vector &AsArg;
+
+        Vc_ALWAYS_INLINE VectorType &data() { return m_data; }
+        Vc_ALWAYS_INLINE const VectorType &data() const { return m_data; }
+
+        static constexpr size_t Size = Vc_GENERIC_VECTOR_BYTES / sizeof(T);
+        static constexpr size_t MemoryAlignment = alignof(VectorType);
+        using IndexType = fixed_size_simd<int, Size>;
+
+#include "../common/generalinterface.h"
+
+        static Vc_INTRINSIC_L Vector Random() Vc_INTRINSIC_R;
+
+        Vc_ALWAYS_INLINE Vector(const VectorType &x) : m_data(x) {}
+
+        // implict conversion from compatible Vector<U, abi>
+        template <typename U>
+        Vc_INTRINSIC Vector(
+            V<U> x, typename std::enable_if<Traits::is_implicit_cast_allowed<U, T>::value,
+                                            void *>::type = nullptr)
+            // implicit casts are only allowed between integers of equal size, where the
+            // value conversion is a reinterpretation of the bits
+            : m_data(VectorType(x.data()))
+        {
+        }
+
+#if Vc_IS_VERSION_1
+        // static_cast from the remaining Vector<U, abi>
+        template <typename U>
+        Vc_DEPRECATED("use simd_cast instead of explicit type casting to convert between "
+                      "vector types") Vc_INTRINSIC
+            explicit Vector(
+                V<U> x,
+                typename std::enable_if<!Traits::is_implicit_cast_allowed<U, T>::value,
+                                        void *>::type = nullptr)
+        {
+            for (size_t i = 0; i < std::min(Size, V<U>::Size); ++i) {
+                m_data[i] = static_cast<EntryType>(x.data()[i]);
+            }
+        }
+#endif
+
+        ///////////////////////////////////////////////////////////////////////////////////////////
+        // broadcast
+        // a - 0 is a for every a, including -0 and NaN (whereas a + 0 turns -0 into +0)
+        Vc_INTRINSIC Vector(EntryType a) : m_data(a - VectorType()) {}
+        template <typename U>
+        Vc_INTRINSIC Vector(U a,
+                            typename std::enable_if<std::is_same<U, int>::value &&
+                                                        !std::is_same<U, EntryType>::value,
+                                                    void *>::type = nullptr)
+            : Vector(static_cast<EntryType>(a))
+        {
+        }
+
+#include "../common/loadinterface.h"
+#include "../common/storeinterface.h"
+
+        ///////////////////////////////////////////////////////////////////////////////////////////
+        // zeroing
+        Vc_ALWAYS_INLINE void setZero() { m_data = VectorType(); }
+        Vc_ALWAYS_INLINE void setZero(MaskArgument k) { assign(Zero(), k); }
+        Vc_ALWAYS_INLINE void setZeroInverted(MaskArgument k) { assign(Zero(), !k); }
+
+        Vc_INTRINSIC_L void setQnan() Vc_INTRINSIC_R;
+        Vc_INTRINSIC_L void setQnan(MaskArgument k) Vc_INTRINSIC_R;
+
+#include "../common/gatherinterface.h"
+#include "../common/scatterinterface.h"
+
+        //prefix
+        Vc_ALWAYS_INLINE Vector &operator++() { m_data += EntryType(1); return *this; }
+        Vc_ALWAYS_INLINE Vector &operator--() { m_data -= EntryType(1); return *this; }
+        //postfix
+        Vc_ALWAYS_INLINE Vector operator++(int) { const Vector r = *this; ++*this; return r; }
+        Vc_ALWAYS_INLINE Vector operator--(int) { const Vector r = *this; --*this; return r; }
+
+    private:
+        friend reference;
+        Vc_INTRINSIC static value_type get(const Vector &o, int i) noexcept
+        {
+            return o.m_data[i];
+        }
+        template <typename U>
+        Vc_INTRINSIC static void set(Vector &o, int i, U &&v) noexcept(
+            noexcept(std::declval<value_type &>() = v))
+        {
+            o.m_data[i] = v;
+        }
+
+    public:
+        /**
+         * \note the returned object models the concept of a reference and
+         * as such it can exist longer than the data it is referencing.
+         * \note to avoid lifetime issues, we strongly advice not to store
+         * any reference objects.
+         */
+        Vc_ALWAYS_INLINE reference operator[](size_t index) noexcept
+        {
+            static_assert(noexcept(reference{std::declval<Vector &>(), int()}), "");
+            return {*this, int(index)};
+        }
+        Vc_ALWAYS_INLINE value_type operator[](size_t index) const noexcept
+        {
+            return m_data[index];
+        }
+
+        Vc_ALWAYS_INLINE Mask operator!() const
+        {
+            return Mask(m_data == VectorType());
+        }
+        Vc_ALWAYS_INLINE Vector operator~() const
+        {
+#ifndef Vc_ENABLE_FLOAT_BIT_OPERATORS
+            static_assert(std::is_integral<T>::value, "bit-complement can only be used with Vectors of integral type");
+#endif
+            return Vector(~m_data);
+        }
+
+        Vc_ALWAYS_INLINE Vector operator-() const
+        {
+            return Vector(-m_data);
+        }
+        Vc_INTRINSIC Vector Vc_PURE operator+() const { return *this; }
+
+        Vc_ALWAYS_INLINE Vector  operator<< (AsArg shift) const { return Vector(m_data << shift.m_data); }
+        Vc_ALWAYS_INLINE Vector  operator>> (AsArg shift) const { return Vector(m_data >> shift.m_data); }
+        Vc_ALWAYS_INLINE Vector &operator<<=(AsArg shift) { m_data <<= shift.m_data; return *this; }
+        Vc_ALWAYS_INLINE Vector &operator>>=(AsArg shift) { m_data >>= shift.m_data; return *this; }
+
+        Vc_ALWAYS_INLINE Vector  operator<< (  int shift) const { return Vector(m_data << shift); }
+        Vc_ALWAYS_INLINE Vector  operator>> (  int shift) const { return Vector(m_data >> shift); }
+        Vc_ALWAYS_INLINE Vector &operator<<=(  int shift) { m_data <<= shift; return *this; }
+        Vc_ALWAYS_INLINE Vector &operator>>=(  int shift) { m_data >>= shift; return *this; }
+
+        Vc_ALWAYS_INLINE void assign(const Vector &v, MaskArgument k)
+        {
+            // casts between generic vector types of equal size reinterpret the bits
+            using I = typename Mask::VectorType;
+            m_data = VectorType((I(v.m_data) & k.data()) | (I(m_data) & ~k.data()));
+        }
+
+        Vc_ALWAYS_INLINE Common::WriteMaskedVector<Vector, Mask> operator()(MaskArgument k)
+        {
+            return {*this, k};
+        }
+
+        Vc_INTRINSIC EntryType min() const
+        {
+            EntryType r = m_data[0];
+            for (size_t i = 1; i < Size; ++i) {
+                r = std::min<EntryType>(r, m_data[i]);
+            }
+            return r;
+        }
+        Vc_INTRINSIC EntryType max() const
+        {
+            EntryType r = m_data[0];
+            for (size_t i = 1; i < Size; ++i) {
+                r = std::max<EntryType>(r, m_data[i]);
+            }
+            return r;
+        }
+        Vc_INTRINSIC EntryType product() const
+        {
+            EntryType r = m_data[0];
+            for (size_t i = 1; i < Size; ++i) {
+                r *= m_data[i];
+            }
+            return r;
+        }
+        Vc_INTRINSIC EntryType sum() const
+        {
+            EntryType r = m_data[0];
+            for (size_t i = 1; i < Size; ++i) {
+                r += m_data[i];
+            }
+            return r;
+        }
+        Vc_INTRINSIC Vector partialSum() const
+        {
+            Vector r = *this;
+            for (size_t i = 1; i < Size; ++i) {
+                r.m_data[i] += r.m_data[i - 1];
+            }
+            return r;
+        }
+        Vc_INTRINSIC EntryType min(MaskArgument k) const
+        {
+            Vector tmp = std::numeric_limits<EntryType>::max();
+            tmp.assign(*this, k);
+            return tmp.min();
+        }
+        Vc_INTRINSIC EntryType max(MaskArgument k) const
+        {
+            Vector tmp = std::numeric_limits<EntryType>::lowest();
+            tmp.assign(*this, k);
+            return tmp.max();
+        }
+        Vc_INTRINSIC EntryType product(MaskArgument k) const
+        {
+            Vector tmp(EntryType(1));
+            tmp.assign(*this, k);
+            return tmp.product();
+        }
+        Vc_INTRINSIC EntryType sum(MaskArgument k) const
+        {
+            Vector tmp(EntryType(0));
+            tmp.assign(*this, k);
+            return tmp.sum();
+        }
+
+        Vc_INTRINSIC Vector shifted(int amount, AsArg shiftIn) const
+        {
+            Vc_ASSERT(amount >= -int(Size) && amount <= int(Size));
+            return generate([&](int i) {
+                const int j = i + amount;
+                return j < 0 ? shiftIn.m_data[j + int(Size)]
+                             : j < int(Size) ? m_data[j] : shiftIn.m_data[j - int(Size)];
+            });
+        }
+        Vc_INTRINSIC Vector shifted(int amount) const
+        {
+            return generate([&](int i) {
+                const int j = i + amount;
+                return j >= 0 && j < int(Size) ? m_data[j] : EntryType(0);
+            });
+        }
+        Vc_INTRINSIC Vector rotated(int amount) const
+        {
+            return generate([&](int i) { return m_data[(i + amount) & int(Size - 1)]; });
+        }
+        Vc_INTRINSIC Vector reversed() const
+        {
+            return generate([&](int i) { return m_data[int(Size) - 1 - i]; });
+        }
+        Vc_INTRINSIC Vector sorted() const
+        {
+            EntryType tmp[Size];
+            store(tmp, Vc::Unaligned);
+            std::sort(tmp, tmp + Size);
+            return Vector(tmp, Vc::Unaligned);
+        }
+
+        template <typename F> void callWithValuesSorted(F &&f)
+        {
+            EntryType tmp[Size];
+            sorted().store(tmp, Vc::Unaligned);
+            f(tmp[0]);
+            for (size_t i = 1; i < Size; ++i) {
+                if (tmp[i] != tmp[i - 1]) {
+                    f(tmp[i]);
+                }
+            }
+        }
+
+        template <typename F> Vc_INTRINSIC void call(F &&f) const
+        {
+            for (size_t i = 0; i < Size; ++i) {
+                f(EntryType(m_data[i]));
+            }
+        }
+
+        template <typename F> Vc_INTRINSIC void call(F &&f, MaskArgument k) const
+        {
+            for (size_t i = 0; i < Size; ++i) {
+                if (k[i]) {
+                    f(EntryType(m_data[i]));
+                }
+            }
+        }
+
+        template <typename F> Vc_INTRINSIC Vector apply(F &&f) const
+        {
+            return generate([&](int i) { return f(EntryType(m_data[i])); });
+        }
+
+        template <typename F> Vc_INTRINSIC Vector apply(F &&f, MaskArgument k) const
+        {
+            Vector r = *this;
+            for (size_t i = 0; i < Size; ++i) {
+                if (k[i]) {
+                    r.m_data[i] = f(EntryType(m_data[i]));
+                }
+            }
+            return r;
+        }
+
+        template<typename IndexT> Vc_INTRINSIC void fill(EntryType (&f)(IndexT)) {
+            for (size_t i = 0; i < Size; ++i) {
+                m_data[i] = f(i);
+            }
+        }
+        Vc_INTRINSIC void fill(EntryType (&f)()) {
+            for (size_t i = 0; i < Size; ++i) {
+                m_data[i] = f();
+            }
+        }
+
+        template <typename G> static Vc_INTRINSIC Vector generate(G gen)
+        {
+            Vector r;
+            for (size_t i = 0; i < Size; ++i) {
+                r.m_data[i] = gen(i);
+            }
+            return r;
+        }
+
+        Vc_INTRINSIC Vector interleaveLow(AsArg x) const
+        {
+            return generate([&](int i) { return (i & 1 ? x.m_data : m_data)[i / 2]; });
+        }
+        Vc_INTRINSIC Vector interleaveHigh(AsArg x) const
+        {
+            return generate(
+                [&](int i) { return (i & 1 ? x.m_data : m_data)[int(Size) / 2 + i / 2]; });
+        }
+};
+#undef Vc_CURRENT_CLASS_NAME
+template <typename T> constexpr size_t Vector<T, VectorAbi::Generic>::Size;
+template <typename T> constexpr size_t Vector<T, VectorAbi::Generic>::MemoryAlignment;
+
+#define Vc_CONDITIONAL_ASSIGN(name_, op_)                                                \
+    template <Operator O, typename T, typename M, typename U>                            \
+    Vc_INTRINSIC enable_if<O == Operator::name_, void> conditional_assign(               \
+        Vector<T, VectorAbi::Generic> &lhs, M &&mask, U &&rhs)                           \
+    {                                                                                    \
+        lhs(mask) op_ rhs;                                                               \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(          Assign,  =);
+Vc_CONDITIONAL_ASSIGN(      PlusAssign, +=);
+Vc_CONDITIONAL_ASSIGN(     MinusAssign, -=);
+Vc_CONDITIONAL_ASSIGN(  MultiplyAssign, *=);
+Vc_CONDITIONAL_ASSIGN(    DivideAssign, /=);
+Vc_CONDITIONAL_ASSIGN( RemainderAssign, %=);
+Vc_CONDITIONAL_ASSIGN(       XorAssign, ^=);
+Vc_CONDITIONAL_ASSIGN(       AndAssign, &=);
+Vc_CONDITIONAL_ASSIGN(        OrAssign, |=);
+Vc_CONDITIONAL_ASSIGN( LeftShiftAssign,<<=);
+Vc_CONDITIONAL_ASSIGN(RightShiftAssign,>>=);
+#undef Vc_CONDITIONAL_ASSIGN
+
+#define Vc_CONDITIONAL_ASSIGN(name_, expr_)                                              \
+    template <Operator O, typename T, typename M>                                        \
+    Vc_INTRINSIC enable_if<O == Operator::name_, Vector<T, VectorAbi::Generic>>          \
+    conditional_assign(Vector<T, VectorAbi::Generic> &lhs, M &&mask)                     \
+    {                                                                                    \
+        return expr_;                                                                    \
+    }                                                                                    \
+    Vc_NOTHING_EXPECTING_SEMICOLON
+Vc_CONDITIONAL_ASSIGN(PostIncrement, lhs(mask)++);
+Vc_CONDITIONAL_ASSIGN( PreIncrement, ++lhs(mask));
+Vc_CONDITIONAL_ASSIGN(PostDecrement, lhs(mask)--);
+Vc_CONDITIONAL_ASSIGN( PreDecrement, --lhs(mask));
+#undef Vc_CONDITIONAL_ASSIGN
+
+}  // namespace Vc
+
+#include "vector.tcc"
+#include "simd_cast.h"
+
+#endif // VC_GENERIC_VECTOR_H_
@@ -0,0 +1,183 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <cstring>
+#include "../common/data.h"
+#include "../common/where.h"
+#include "operators.h"
+#include "macros.h"
+namespace Vc_VERSIONED_NAMESPACE
+{
+
+// special value constructors{{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Generic>::Vector(VectorSpecialInitializerZero)
+    : m_data()
+{
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Generic>::Vector(VectorSpecialInitializerOne)
+    : Vector(EntryType(1))
+{
+}
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Generic>::Vector(VectorSpecialInitializerIndexesFromZero)
+{
+    for (size_t i = 0; i < Size; ++i) {
+        m_data[i] = EntryType(i);
+    }
+}
+
+// load member functions{{{1
+template <typename T>
+template <typename U, typename Flags>
+Vc_INTRINSIC typename Vector<T, VectorAbi::Generic>::
+#ifndef Vc_MSVC
+template
+#endif
+load_concept<U, Flags>::type Vector<T, VectorAbi::Generic>::load(const U *mem, Flags)
+{
+    if (std::is_same<U, T>::value) {
+        // a single (possibly split) vector load; the aligned variant tells the compiler
+        // that it may use aligned load instructions
+        std::memcpy(&m_data,
+                    Flags::IsAligned ? __builtin_assume_aligned(mem, MemoryAlignment)
+                                     : static_cast<const void *>(mem),
+                    sizeof(VectorType));
+    } else {
+        for (size_t i = 0; i < Size; ++i) {
+            m_data[i] = static_cast<EntryType>(mem[i]);
+        }
+    }
+}
+
+// store member functions{{{1
+template <typename T>
+template <typename U, typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Generic>::store(U *mem, Flags) const
+{
+    if (std::is_same<U, T>::value) {
+        std::memcpy(Flags::IsAligned ? __builtin_assume_aligned(mem, MemoryAlignment)
+                                     : static_cast<void *>(mem),
+                    &m_data, sizeof(VectorType));
+    } else {
+        for (size_t i = 0; i < Size; ++i) {
+            mem[i] = static_cast<U>(m_data[i]);
+        }
+    }
+}
+template <typename T>
+template <typename U, typename Flags, typename>
+Vc_INTRINSIC void Vector<T, VectorAbi::Generic>::store(U *mem, Mask mask, Flags) const
+{
+    for (size_t i = 0; i < Size; ++i) {
+        if (mask[i]) {
+            mem[i] = static_cast<U>(m_data[i]);
+        }
+    }
+}
+
+// gather {{{1
+template <typename T>
+template <class MT, class IT, int Scale>
+Vc_ALWAYS_INLINE void Vector<T, VectorAbi::Generic>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args)
+{
+    for (size_t i = 0; i < Size; ++i) {
+        m_data[i] = args.address[Scale * args.indexes[i]];
+    }
+}
+
+template <typename T>
+template <class MT, class IT, int Scale>
+Vc_ALWAYS_INLINE void Vector<T, VectorAbi::Generic>::gatherImplementation(
+    const Common::GatherArguments<MT, IT, Scale> &args, MaskArgument mask)
+{
+    for (size_t i = 0; i < Size; ++i) {
+        if (mask[i]) {
+            m_data[i] = args.address[Scale * args.indexes[i]];
+        }
+    }
+}
+
+// scatter {{{1
+template <typename T>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void Vector<T, VectorAbi::Generic>::scatterImplementation(MT *mem,
+                                                                           IT &&indexes)
+    const
+{
+    for (size_t i = 0; i < Size; ++i) {
+        mem[indexes[i]] = m_data[i];
+    }
+}
+
+template <typename T>
+template <typename MT, typename IT>
+Vc_ALWAYS_INLINE void Vector<T, VectorAbi::Generic>::scatterImplementation(
+    MT *mem, IT &&indexes, MaskArgument mask) const
+{
+    for (size_t i = 0; i < Size; ++i) {
+        if (mask[i]) {
+            mem[indexes[i]] = m_data[i];
+        }
+    }
+}
+
+// Random {{{1
+template <typename T>
+Vc_INTRINSIC Vector<T, VectorAbi::Generic> Vector<T, VectorAbi::Generic>::Random()
+{
+    return generate([](size_t) { return Scalar::Vector<T>::Random().data(); });
+}
+
+// isnegative {{{1
+template <typename T>
+Vc_INTRINSIC Vc_CONST enable_if<std::is_floating_point<T>::value, Generic::Mask<T>>
+isnegative(const Generic::Vector<T> &x)
+{
+    // the sign bit is the sign bit of the equally sized signed integer
+    using I = typename Generic::Mask<T>::VectorType;
+    return Generic::Mask<T>(I(x.data()) < I());
+}
+
+// setQnan {{{1
+template <typename T> Vc_INTRINSIC void Vector<T, VectorAbi::Generic>::setQnan()
+{
+    m_data = VectorType(~typename Mask::VectorType());
+}
+template <typename T>
+Vc_INTRINSIC void Vector<T, VectorAbi::Generic>::setQnan(MaskArgument k)
+{
+    Vector nan;
+    nan.setQnan();
+    assign(nan, k);
+}
+// }}}1
+}  // namespace Vc
+
+// vim: foldmethod=marker
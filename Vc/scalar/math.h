@@ -70,6 +70,12 @@ Vc_INTRINSIC Vc_CONST Scalar::double_v copysign(Scalar::double_v mag,
         return Scalar::V(std::max(x.data(), y.data()));                                  \
     }
 Vc_ALL_VECTOR_TYPES(Vc_MINMAX);
+Vc_MINMAX(llong_v);
+Vc_MINMAX(ullong_v);
+#ifdef __LP64__
+Vc_MINMAX(Vector<long>);
+Vc_MINMAX(Vector<unsigned long>);
+#endif
 #undef Vc_MINMAX
 
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sqrt (const Scalar::Vector<T> &x)
@@ -85,7 +91,9 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> rsqrt(const Scala
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value ||
+                               std::is_same<T, long long>::value ||
+                               (std::is_same<T, long>::value && sizeof(long) == 8)>>
 Vc_ALWAYS_INLINE Vc_PURE Scalar::Vector<T> abs(Scalar::Vector<T> x)
 {
     return std::abs(x.data());
@@ -120,6 +128,11 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sin  (const Scala
     return Scalar::Vector<T>(std::sin(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tan  (const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tan(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> asin (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::asin(x.data()));
@@ -150,6 +163,66 @@ template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp (const Scalar
     return Scalar::Vector<T>(std::exp(x.data()));
 }
 
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp2(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::exp2(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> expm1(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::expm1(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> exp10(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::pow(T(10), x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> pow(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::pow(x.data(), y.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cbrt(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cbrt(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> hypot(const Scalar::Vector<T> &x, const Scalar::Vector<T> &y)
+{
+    return Scalar::Vector<T>(std::hypot(x.data(), y.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> sinh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::sinh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> cosh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::cosh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> tanh(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::tanh(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erf(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erf(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> erfc(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::erfc(x.data()));
+}
+
+template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> log1p(const Scalar::Vector<T> &x)
+{
+    return Scalar::Vector<T>(std::log1p(x.data()));
+}
+
 template<typename T> static Vc_ALWAYS_INLINE Scalar::Vector<T> atan (const Scalar::Vector<T> &x)
 {
     return Scalar::Vector<T>(std::atan( x.data() ));
@@ -150,6 +150,95 @@ Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , ushort>) { return con
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, ushort>) { return v; }
 Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, ushort>) { return convert(convert(v, ConvertTag<double, int>()), ConvertTag<int, ushort>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , short >) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , short >) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , ushort>) { return cvtepi8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , ushort>) { return cvtepu8_epi16(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , int   >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , int   >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uint  >) { return cvtepi8_epi32(v); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uint  >) { return cvtepu8_epi32(v); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<schar , float >) { return convert(convert(v, ConvertTag<schar, int>()), ConvertTag<int, float>()); }
+Vc_INTRINSIC __m128  convert(__m128i v, ConvertTag<uchar , float >) { return convert(convert(v, ConvertTag<uchar, int>()), ConvertTag<int, float>()); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<schar , double>) { return convert(convert(v, ConvertTag<schar, int>()), ConvertTag<int, double>()); }
+Vc_INTRINSIC __m128d convert(__m128i v, ConvertTag<uchar , double>) { return convert(convert(v, ConvertTag<uchar, int>()), ConvertTag<int, double>()); }
+// the conversions to 8-bit integers keep the low byte (as the integral conversions do)
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , schar >) { return _mm_packus_epi16(_mm_and_si128(v, _mm_set1_epi16(0xff)), _mm_setzero_si128()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, schar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , schar >) { return convert(_mm_packs_epi32(_mm_and_si128(v, _mm_set1_epi32(0xff)), _mm_setzero_si128()), ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , schar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , schar >) { return convert(_mm_cvttps_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, schar >) { return convert(_mm_cvttpd_epi32(v), ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , schar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<short , uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<ushort, uchar >) { return convert(v, ConvertTag<short, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<int   , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uint  , uchar >) { return convert(v, ConvertTag<int, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128  v, ConvertTag<float , uchar >) { return convert(v, ConvertTag<float, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128d v, ConvertTag<double, uchar >) { return convert(v, ConvertTag<double, schar>()); }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<schar , uchar >) { return v; }
+Vc_INTRINSIC __m128i convert(__m128i v, ConvertTag<uchar , uchar >) { return v; }
+
+// 64-bit integers {{{1
+// long long, unsigned long long, and long where it has 64 bits. The conversions from/to
+// floating-point have no SSE instruction and convert the two entries individually.
+template <typename T>
+using is_int64 = std::integral_constant<bool, std::is_integral<T>::value && sizeof(T) == 8>;
+
+template <typename From, typename To>
+Vc_INTRINSIC enable_if<is_int64<From>::value && is_int64<To>::value, __m128i> convert(
+    __m128i v, ConvertTag<From, To>)
+{
+    return v;
+}
+template <typename To>
+Vc_INTRINSIC enable_if<is_int64<To>::value, __m128i> convert(__m128i v, ConvertTag<int, To>)
+{
+#ifdef Vc_IMPL_SSE4_1
+    return _mm_cvtepi32_epi64(v);
+#else
+    return _mm_unpacklo_epi32(v, _mm_srai_epi32(v, 31));
+#endif
+}
+template <typename To>
+Vc_INTRINSIC enable_if<is_int64<To>::value, __m128i> convert(__m128i v, ConvertTag<uint, To>)
+{
+    return _mm_unpacklo_epi32(v, _mm_setzero_si128());
+}
+template <typename To>
+Vc_INTRINSIC enable_if<is_int64<To>::value, __m128i> convert(__m128d v, ConvertTag<double, To>)
+{
+    return _mm_set_epi64x(static_cast<To>(_mm_cvtsd_f64(_mm_unpackhi_pd(v, v))),
+                          static_cast<To>(_mm_cvtsd_f64(v)));
+}
+template <typename To>
+Vc_INTRINSIC enable_if<is_int64<To>::value, __m128i> convert(__m128 v, ConvertTag<float, To>)
+{
+    return convert(_mm_cvtps_pd(v), ConvertTag<double, To>());
+}
+template <typename From>
+Vc_INTRINSIC enable_if<is_int64<From>::value, __m128i> convert(__m128i v, ConvertTag<From, int>)
+{
+    return _mm_move_epi64(_mm_shuffle_epi32(v, _MM_SHUFFLE(2, 0, 2, 0)));
+}
+template <typename From>
+Vc_INTRINSIC enable_if<is_int64<From>::value, __m128i> convert(__m128i v, ConvertTag<From, uint>)
+{
+    return convert(v, ConvertTag<From, int>());
+}
+template <typename From>
+Vc_INTRINSIC enable_if<is_int64<From>::value, __m128d> convert(__m128i v, ConvertTag<From, double>)
+{
+    return _mm_setr_pd(static_cast<From>(cvtsi128_si64(v)),
+                       static_cast<From>(cvtsi128_si64(_mm_unpackhi_epi64(v, v))));
+}
+template <typename From>
+Vc_INTRINSIC enable_if<is_int64<From>::value, __m128> convert(__m128i v, ConvertTag<From, float>)
+{
+    return _mm_setr_ps(static_cast<From>(cvtsi128_si64(v)),
+                       static_cast<From>(cvtsi128_si64(_mm_unpackhi_epi64(v, v))), 0.f, 0.f);
+}
 
 // }}}1
 }  // namespace SSE
@@ -84,6 +84,28 @@ template<> struct c_log<double>
     alignas(64) static const unsigned long long data[21 * Size];
 };
 
+/**\internal
+ * A table of pshufb controls with one row per mask bit pattern.
+ */
+template <std::size_t Rows> struct alignas(16) ShuffleTable
+{
+    unsigned char data[Rows][16];
+};
+
+/**\internal
+ * pshufb controls for Detail::compress and Detail::expand, indexed by Mask::toInt(). The
+ * suffix is the entry size in bits.
+ */
+struct c_compress
+{
+    static const ShuffleTable<4> compress64;
+    static const ShuffleTable<16> compress32;
+    static const ShuffleTable<256> compress16;
+    static const ShuffleTable<4> expand64;
+    static const ShuffleTable<16> expand32;
+    static const ShuffleTable<256> expand16;
+};
+
 }  // namespace SSE
 }  // namespace Vc
 
@@ -497,6 +497,18 @@ Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::
     return _mm_sub_epi16(_mm_setzero_si128(), v);
 #endif
 }
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 1>)
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_sign_epi8(v, allone<__m128i>());
+#else
+    return _mm_sub_epi8(_mm_setzero_si128(), v);
+#endif
+}
+Vc_ALWAYS_INLINE Vc_CONST __m128i negate(__m128i v, std::integral_constant<std::size_t, 8>)
+{
+    return _mm_sub_epi64(_mm_setzero_si128(), v);
+}
 
 // xor_{{{1
 Vc_INTRINSIC __m128 xor_(__m128 a, __m128 b) { return _mm_xor_ps(a, b); }
@@ -532,6 +544,10 @@ Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  short) { return _mm_add_epi16(a,
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b, ushort) { return _mm_add_epi16(a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  schar) { return _mm_add_epi8 (a, b); }
 Vc_INTRINSIC __m128i add(__m128i a, __m128i b,  uchar) { return _mm_add_epi8 (a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,          long long) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b, unsigned long long) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,               long) { return _mm_add_epi64(a, b); }
+Vc_INTRINSIC __m128i add(__m128i a, __m128i b,      unsigned long) { return _mm_add_epi64(a, b); }
 
 // sub{{{1
 Vc_INTRINSIC __m128  sub(__m128  a, __m128  b,  float) { return _mm_sub_ps(a, b); }
@@ -542,6 +558,10 @@ Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  short) { return _mm_sub_epi16(a,
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, ushort) { return _mm_sub_epi16(a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  schar) { return _mm_sub_epi8 (a, b); }
 Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,  uchar) { return _mm_sub_epi8 (a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,          long long) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b, unsigned long long) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,               long) { return _mm_sub_epi64(a, b); }
+Vc_INTRINSIC __m128i sub(__m128i a, __m128i b,      unsigned long) { return _mm_sub_epi64(a, b); }
 
 // mul{{{1
 Vc_INTRINSIC __m128  mul(__m128  a, __m128  b,  float) { return _mm_mul_ps(a, b); }
@@ -582,6 +602,10 @@ Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,  uchar) {
         _mm_slli_epi16(_mm_mullo_epi16(_mm_srli_si128(a, 1), _mm_srli_si128(b, 1)), 8));
 #endif
 }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,          long long) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b, unsigned long long) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,               long) { return SSE::mullo_epi64(a, b); }
+Vc_INTRINSIC __m128i mul(__m128i a, __m128i b,      unsigned long) { return SSE::mullo_epi64(a, b); }
 
 // div{{{1
 Vc_INTRINSIC __m128  div(__m128  a, __m128  b,  float) { return _mm_div_ps(a, b); }
@@ -606,6 +630,10 @@ Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  short) { return _mm_min_epi16(a,
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b, ushort) { return SSE::min_epu16(a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  schar) { return SSE::min_epi8 (a, b); }
 Vc_INTRINSIC __m128i min(__m128i a, __m128i b,  uchar) { return _mm_min_epu8 (a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,          long long) { return SSE::min_epi64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b, unsigned long long) { return SSE::min_epu64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,               long) { return SSE::min_epi64(a, b); }
+Vc_INTRINSIC __m128i min(__m128i a, __m128i b,      unsigned long) { return SSE::min_epu64(a, b); }
 
 // max{{{1
 Vc_INTRINSIC __m128  max(__m128  a, __m128  b,  float) { return _mm_max_ps(a, b); }
@@ -616,6 +644,10 @@ Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  short) { return _mm_max_epi16(a,
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b, ushort) { return SSE::max_epu16(a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  schar) { return SSE::max_epi8 (a, b); }
 Vc_INTRINSIC __m128i max(__m128i a, __m128i b,  uchar) { return _mm_max_epu8 (a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,          long long) { return SSE::max_epi64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b, unsigned long long) { return SSE::max_epu64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,               long) { return SSE::max_epi64(a, b); }
+Vc_INTRINSIC __m128i max(__m128i a, __m128i b,      unsigned long) { return SSE::max_epu64(a, b); }
 
 // horizontal add{{{1
 Vc_INTRINSIC  float add(__m128  a,  float) {
@@ -648,6 +680,18 @@ Vc_INTRINSIC  schar add(__m128i a,  schar) {
     return _mm_cvtsi128_si32(a);  // & 0xff is implicit
 }
 Vc_INTRINSIC  uchar add(__m128i a,  uchar) { return add(a, schar()); }
+Vc_INTRINSIC          long long add(__m128i a,          long long) {
+    return SSE::cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), 0ll));
+}
+Vc_INTRINSIC unsigned long long add(__m128i a, unsigned long long) {
+    return SSE::cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), 0ull));
+}
+Vc_INTRINSIC               long add(__m128i a,               long) {
+    return SSE::cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), 0l));
+}
+Vc_INTRINSIC      unsigned long add(__m128i a,      unsigned long) {
+    return SSE::cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a), 0ul));
+}
 
 // horizontal mul{{{1
 Vc_INTRINSIC  float mul(__m128  a,  float) {
@@ -673,12 +717,25 @@ Vc_INTRINSIC  short mul(__m128i a,  short) {
 }
 Vc_INTRINSIC ushort mul(__m128i a, ushort) { return mul(a, short()); }
 Vc_INTRINSIC  schar mul(__m128i a,  schar) {
-    // convert to two short vectors, multiply them and then do horizontal reduction
-    const __m128i s0 = _mm_srai_epi16(a, 1);
-    const __m128i s1 = Detail::and_(a, _mm_set1_epi32(0x0f0f0f0f));
-    return mul(mul(s0, s1, short()), short());
+    // multiply the even and odd bytes as shorts and then do the horizontal reduction on
+    // the short vector; the low byte of each product is exact
+    const __m128i even = and_(a, _mm_set1_epi16(0x00ff));
+    const __m128i odd = _mm_srli_epi16(a, 8);
+    return mul(mul(even, odd, short()), short());
 }
 Vc_INTRINSIC  uchar mul(__m128i a,  uchar) { return mul(a, schar()); }
+Vc_INTRINSIC          long long mul(__m128i a,          long long) {
+    return SSE::cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), 0ll));
+}
+Vc_INTRINSIC unsigned long long mul(__m128i a, unsigned long long) {
+    return SSE::cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), 0ull));
+}
+Vc_INTRINSIC               long mul(__m128i a,               long) {
+    return SSE::cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), 0l));
+}
+Vc_INTRINSIC      unsigned long mul(__m128i a,      unsigned long) {
+    return SSE::cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a), 0ul));
+}
 
 // horizontal min{{{1
 Vc_INTRINSIC  float min(__m128  a,  float) {
@@ -719,11 +776,23 @@ Vc_INTRINSIC  schar min(__m128i a,  schar) {
     return std::min(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar min(__m128i a,  uchar) {
-    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = min(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = min(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::min((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC          long long min(__m128i a,          long long) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), 0ll));
+}
+Vc_INTRINSIC unsigned long long min(__m128i a, unsigned long long) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), 0ull));
+}
+Vc_INTRINSIC               long min(__m128i a,               long) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), 0l));
+}
+Vc_INTRINSIC      unsigned long min(__m128i a,      unsigned long) {
+    return SSE::cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a), 0ul));
+}
 
 // horizontal max{{{1
 Vc_INTRINSIC  float max(__m128  a,  float) {
@@ -764,11 +833,23 @@ Vc_INTRINSIC  schar max(__m128i a,  schar) {
     return std::max(schar(_mm_cvtsi128_si32(a) >> 8), schar(_mm_cvtsi128_si32(a)));
 }
 Vc_INTRINSIC  uchar max(__m128i a,  uchar) {
-    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), schar());
-    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), schar());
+    a = max(a, _mm_shuffle_epi32(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 0, 3, 2)), uchar());
+    a = max(a, _mm_shufflelo_epi16(a, _MM_SHUFFLE(1, 1, 1, 1)), uchar());
     return std::max((_mm_cvtsi128_si32(a) >> 8) & 0xff, _mm_cvtsi128_si32(a) & 0xff);
 }
+Vc_INTRINSIC          long long max(__m128i a,          long long) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), 0ll));
+}
+Vc_INTRINSIC unsigned long long max(__m128i a, unsigned long long) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), 0ull));
+}
+Vc_INTRINSIC               long max(__m128i a,               long) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), 0l));
+}
+Vc_INTRINSIC      unsigned long max(__m128i a,      unsigned long) {
+    return SSE::cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a), 0ul));
+}
 
 // sorted{{{1
 template <Vc::Implementation, typename T>
@@ -817,6 +898,52 @@ static Vc_INTRINSIC Vc_CONST enable_if<(sizeof(V) == 16), V> rotated(V v, int am
     return sse_cast<V>(_mm_setzero_si128());
 }
 
+// compress{{{1
+#ifdef Vc_IMPL_SSSE3
+/**\internal
+ * Moves the entries of \p x selected by the bits of \p k to the front and zeros the
+ * remaining entries. \p EntrySize is the size of one entry in bytes.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m128i compress(__m128i x, int k);
+template <> Vc_INTRINSIC __m128i compress<8>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress64.data[k])));
+}
+template <> Vc_INTRINSIC __m128i compress<4>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress32.data[k])));
+}
+template <> Vc_INTRINSIC __m128i compress<2>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::compress16.data[k])));
+}
+
+// expand{{{1
+/**\internal
+ * The inverse of compress: moves the front entries of \p x to the entries selected by the
+ * bits of \p k and zeros the remaining entries.
+ */
+template <size_t EntrySize> Vc_INTRINSIC __m128i expand(__m128i x, int k);
+template <> Vc_INTRINSIC __m128i expand<8>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand64.data[k])));
+}
+template <> Vc_INTRINSIC __m128i expand<4>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand32.data[k])));
+}
+template <> Vc_INTRINSIC __m128i expand<2>(__m128i x, int k)
+{
+    return _mm_shuffle_epi8(
+        x, _mm_load_si128(reinterpret_cast<const __m128i *>(SSE::c_compress::expand16.data[k])));
+}
+#endif  // Vc_IMPL_SSSE3
+
 //InterleaveImpl{{{1
 template<typename V, size_t Size, size_t VSize> struct InterleaveImpl;
 template<typename V> struct InterleaveImpl<V, 8, 16> {
@@ -78,10 +78,14 @@ namespace SseIntrinsics
     static Vc_INTRINSIC Vc_CONST __m128d _mm_setallone_pd() { return _mm_load_pd(reinterpret_cast<const double *>(Common::AllBitsSet)); }
     static Vc_INTRINSIC Vc_CONST __m128  _mm_setallone_ps() { return _mm_load_ps(reinterpret_cast<const float *>(Common::AllBitsSet)); }
 
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi8 ()  { return _mm_set1_epi8(1); }
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu8 ()  { return _mm_setone_epi8(); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi16()  { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::one16)); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu16()  { return _mm_setone_epi16(); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi32()  { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::one32)); }
     static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu32()  { return _mm_setone_epi32(); }
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epi64()  { return _mm_set_epi32(0, 1, 0, 1); }
+    static Vc_INTRINSIC __m128i Vc_CONST _mm_setone_epu64()  { return _mm_setone_epi64(); }
 
     static Vc_INTRINSIC __m128  Vc_CONST _mm_setone_ps()     { return _mm_load_ps(c_general::oneFloat); }
     static Vc_INTRINSIC __m128d Vc_CONST _mm_setone_pd()     { return _mm_load_pd(c_general::oneDouble); }
@@ -94,15 +98,24 @@ namespace SseIntrinsics
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi8 () { return _mm_set1_epi8(-0x80); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi16() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::minShort)); }
     static Vc_INTRINSIC __m128i Vc_CONST setmin_epi32() { return _mm_load_si128(reinterpret_cast<const __m128i *>(c_general::signMaskFloat)); }
+    static Vc_INTRINSIC __m128i Vc_CONST setmin_epi64() { return _mm_castpd_si128(_mm_load_pd(reinterpret_cast<const double *>(c_general::signMaskDouble))); }
 
 #if defined(Vc_IMPL_XOP)
+    static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b) { return _mm_comlt_epu8(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b) { return _mm_comgt_epu8(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu16(__m128i a, __m128i b) { return _mm_comlt_epu16(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu16(__m128i a, __m128i b) { return _mm_comgt_epu16(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu32(__m128i a, __m128i b) { return _mm_comlt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu32(__m128i a, __m128i b) { return _mm_comgt_epu32(a, b); }
     static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return _mm_comlt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b) { return _mm_comgt_epu64(a, b); }
+    static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epi64(__m128i a, __m128i b) { return _mm_comgt_epi64(a, b); }
 #else
+    static Vc_INTRINSIC __m128i Vc_CONST cmplt_epu8(__m128i a, __m128i b)
+    {
+        return _mm_cmplt_epi8(_mm_xor_si128(a, setmin_epi8()),
+                              _mm_xor_si128(b, setmin_epi8()));
+    }
     static Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu8(__m128i a, __m128i b)
     {
         return _mm_cmpgt_epi8(_mm_xor_si128(a, setmin_epi8()),
@@ -152,7 +165,13 @@ namespace SseIntrinsics
         return _mm_or_si128(gt2, lo);
 #endif
     }
+    Vc_INTRINSIC __m128i Vc_CONST cmpgt_epu64(__m128i a, __m128i b)
+    {
+        return cmpgt_epi64(_mm_xor_si128(a, setmin_epi64()), _mm_xor_si128(b, setmin_epi64()));
+    }
+    Vc_INTRINSIC __m128i Vc_CONST cmplt_epu64(__m128i a, __m128i b) { return cmpgt_epu64(b, a); }
 #endif
+    Vc_INTRINSIC __m128i Vc_CONST cmplt_epi64(__m128i a, __m128i b) { return cmpgt_epi64(b, a); }
 }  // namespace SseIntrinsics
 }  // namespace Vc
 
@@ -569,6 +588,50 @@ namespace SseIntrinsics
 }  // namespace Vc
 #endif
 
+// 64-bit integers
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace SseIntrinsics
+{
+    Vc_INTRINSIC Vc_CONST long long cvtsi128_si64(__m128i a)
+    {
+#ifdef __x86_64__
+        return _mm_cvtsi128_si64(a);
+#else
+        long long r;
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(&r), a);
+        return r;
+#endif
+    }
+
+    // SSE has no 64-bit min/max, multiplication, or arithmetic right shift. These are
+    // composed from the 32-bit instructions.
+    Vc_INTRINSIC Vc_CONST __m128i min_epi64(__m128i a, __m128i b) { return blendv_epi8(a, b, cmpgt_epi64(a, b)); }
+    Vc_INTRINSIC Vc_CONST __m128i max_epi64(__m128i a, __m128i b) { return blendv_epi8(b, a, cmpgt_epi64(a, b)); }
+    Vc_INTRINSIC Vc_CONST __m128i min_epu64(__m128i a, __m128i b) { return blendv_epi8(a, b, cmpgt_epu64(a, b)); }
+    Vc_INTRINSIC Vc_CONST __m128i max_epu64(__m128i a, __m128i b) { return blendv_epi8(b, a, cmpgt_epu64(a, b)); }
+    Vc_INTRINSIC Vc_CONST __m128i abs_epi64(__m128i a)
+    {
+        const __m128i neg = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_sub_epi64(_mm_xor_si128(a, neg), neg);
+    }
+    Vc_INTRINSIC Vc_CONST __m128i mullo_epi64(__m128i a, __m128i b)
+    {
+        // a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+        const __m128i lolo = _mm_mul_epu32(a, b);
+        const __m128i hilo = _mm_mul_epu32(_mm_srli_epi64(a, 32), b);
+        const __m128i lohi = _mm_mul_epu32(a, _mm_srli_epi64(b, 32));
+        return _mm_add_epi64(lolo, _mm_slli_epi64(_mm_add_epi64(hilo, lohi), 32));
+    }
+    Vc_INTRINSIC Vc_CONST __m128i srai_epi64(__m128i a, int shift)
+    {
+        // shift logically and fill the vacated bits with the sign (slli by 64 yields 0)
+        const __m128i sign = _mm_shuffle_epi32(_mm_srai_epi32(a, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        return _mm_or_si128(_mm_srli_epi64(a, shift), _mm_slli_epi64(sign, 64 - shift));
+    }
+}  // namespace SseIntrinsics
+}  // namespace Vc
+
 // SSE4.2
 namespace Vc_VERSIONED_NAMESPACE
 {
@@ -610,6 +673,18 @@ namespace SseIntrinsics
     static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned char *mem) {
         return _mm_stream_load(reinterpret_cast<const int *>(mem));
     }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned long long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
+    static Vc_INTRINSIC Vc_PURE __m128i _mm_stream_load(const unsigned long *mem) {
+        return _mm_stream_load(reinterpret_cast<const int *>(mem));
+    }
 
 #ifndef __x86_64__
     Vc_INTRINSIC Vc_PURE __m128i _mm_cvtsi64_si128(int64_t x) {
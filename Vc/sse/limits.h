@@ -82,6 +82,80 @@ template<> struct numeric_limits< ::Vc::SSE::int_v> : public numeric_limits<int>
     static Vc_INTRINSIC Vc_CONST ::Vc::SSE::int_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::int_v::Zero(); }
     static Vc_INTRINSIC Vc_CONST ::Vc::SSE::int_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::int_v::Zero(); }
 };
+template<> struct numeric_limits< ::Vc::SSE::uchar_v> : public numeric_limits<unsigned char>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v min()           Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::uchar_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::uchar_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::schar_v> : public numeric_limits<signed char>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v max()           Vc_NOEXCEPT { return _mm_set1_epi8(0x7f); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v min()           Vc_NOEXCEPT { return _mm_set1_epi8(-0x80); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::schar_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::schar_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::ullong_v> : public numeric_limits<unsigned long long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v min()           Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::ullong_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::ullong_v::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::llong_v> : public numeric_limits<long long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v max()           Vc_NOEXCEPT { return _mm_srli_epi64(::Vc::SSE::_mm_setallone_si128(), 1); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v min()           Vc_NOEXCEPT { return ::Vc::SSE::setmin_epi64(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v round_error()   Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v infinity()      Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::llong_v denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::llong_v::Zero(); }
+};
+#ifdef __LP64__
+template<> struct numeric_limits< ::Vc::SSE::Vector<unsigned long>> : public numeric_limits<unsigned long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> max()           Vc_NOEXCEPT { return ::Vc::SSE::_mm_setallone_si128(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> min()           Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> round_error()   Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> infinity()      Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<unsigned long> denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::Vector<unsigned long>::Zero(); }
+};
+template<> struct numeric_limits< ::Vc::SSE::Vector<long>> : public numeric_limits<long>
+{
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> max()           Vc_NOEXCEPT { return _mm_srli_epi64(::Vc::SSE::_mm_setallone_si128(), 1); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> min()           Vc_NOEXCEPT { return ::Vc::SSE::setmin_epi64(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> lowest()        Vc_NOEXCEPT { return min(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> epsilon()       Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> round_error()   Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> infinity()      Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> quiet_NaN()     Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> signaling_NaN() Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+    static Vc_INTRINSIC Vc_CONST ::Vc::SSE::Vector<long> denorm_min()    Vc_NOEXCEPT { return ::Vc::SSE::Vector<long>::Zero(); }
+};
+#endif
 } // namespace std
 
 #endif // VC_SSE_LIMITS_H_
@@ -98,6 +98,32 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v);
 Vc_SIMD_CAST_1( float_v, ushort_v);
 Vc_SIMD_CAST_1(double_v, ushort_v);
 Vc_SIMD_CAST_1( short_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v,    int_v);
+Vc_SIMD_CAST_1( schar_v,   uint_v);
+Vc_SIMD_CAST_1( schar_v,  short_v);
+Vc_SIMD_CAST_1( schar_v, ushort_v);
+Vc_SIMD_CAST_1( schar_v,  float_v);
+Vc_SIMD_CAST_1( schar_v, double_v);
+Vc_SIMD_CAST_1( schar_v,  uchar_v);
+Vc_SIMD_CAST_1( uchar_v,    int_v);
+Vc_SIMD_CAST_1( uchar_v,   uint_v);
+Vc_SIMD_CAST_1( uchar_v,  short_v);
+Vc_SIMD_CAST_1( uchar_v, ushort_v);
+Vc_SIMD_CAST_1( uchar_v,  float_v);
+Vc_SIMD_CAST_1( uchar_v, double_v);
+Vc_SIMD_CAST_1( uchar_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  schar_v);
+Vc_SIMD_CAST_1(   int_v,  uchar_v);
+Vc_SIMD_CAST_1(  uint_v,  schar_v);
+Vc_SIMD_CAST_1(  uint_v,  uchar_v);
+Vc_SIMD_CAST_1( short_v,  schar_v);
+Vc_SIMD_CAST_1( short_v,  uchar_v);
+Vc_SIMD_CAST_1(ushort_v,  schar_v);
+Vc_SIMD_CAST_1(ushort_v,  uchar_v);
+Vc_SIMD_CAST_1( float_v,  schar_v);
+Vc_SIMD_CAST_1( float_v,  uchar_v);
+Vc_SIMD_CAST_1(double_v,  schar_v);
+Vc_SIMD_CAST_1(double_v,  uchar_v);
 
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v);
@@ -111,6 +137,16 @@ Vc_SIMD_CAST_2(   int_v, ushort_v);
 Vc_SIMD_CAST_2(  uint_v, ushort_v);
 Vc_SIMD_CAST_2( float_v, ushort_v);
 Vc_SIMD_CAST_2(double_v, ushort_v);
+Vc_SIMD_CAST_2( short_v,  schar_v);
+Vc_SIMD_CAST_2(ushort_v,  schar_v);
+Vc_SIMD_CAST_2(   int_v,  schar_v);
+Vc_SIMD_CAST_2(  uint_v,  schar_v);
+Vc_SIMD_CAST_2( float_v,  schar_v);
+Vc_SIMD_CAST_2( short_v,  uchar_v);
+Vc_SIMD_CAST_2(ushort_v,  uchar_v);
+Vc_SIMD_CAST_2(   int_v,  uchar_v);
+Vc_SIMD_CAST_2(  uint_v,  uchar_v);
+Vc_SIMD_CAST_2( float_v,  uchar_v);
 
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 #define Vc_CAST_(To_)                                                                    \
@@ -122,6 +158,33 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c);
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v);
 Vc_SIMD_CAST_4(double_v, ushort_v);
+Vc_SIMD_CAST_4(   int_v,  schar_v);
+Vc_SIMD_CAST_4(  uint_v,  schar_v);
+Vc_SIMD_CAST_4( float_v,  schar_v);
+Vc_SIMD_CAST_4(   int_v,  uchar_v);
+Vc_SIMD_CAST_4(  uint_v,  uchar_v);
+Vc_SIMD_CAST_4( float_v,  uchar_v);
+
+// 64-bit integer vectors {{{2
+// casts between the 64-bit integer vectors and double_v, float_v, int_v, and uint_v
+template <typename V>
+using is_int64_vector =
+    std::integral_constant<bool, is_int64<typename V::EntryType>::value>;
+template <typename To, typename From>
+using enable_if_int64_cast =
+    enable_if<!std::is_same<To, From>::value && is_vector<To>::value &&
+                  is_vector<From>::value &&
+                  (is_int64_vector<To>::value || is_int64_vector<From>::value),
+              To>;
+template <typename To, typename From>
+using enable_if_int64_cast2 =
+    enable_if<is_vector<To>::value && is_vector<From>::value &&
+                  is_int64_vector<From>::value && To::Size == 2 * From::Size,
+              To>;
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST enable_if_int64_cast<To, From> simd_cast(From x);
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST enable_if_int64_cast2<To, From> simd_cast(From x0, From x1);
 //}}}2
 }  // namespace SSE
 using SSE::simd_cast;
@@ -178,6 +241,18 @@ Vc_INTRINSIC Vc_CONST Return
 simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
           enable_if<std::is_same<Return, SSE::ushort_v>::value> = nullarg);
 
+// 1 and 2 Scalar::Vector to 1 64-bit integer SSE::Vector {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<SSE::is_vector<Return>::value &&
+                    SSE::is_int64_vector<Return>::value> = nullarg);
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<SSE::is_vector<Return>::value &&
+                    SSE::is_int64_vector<Return>::value> = nullarg);
+
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -321,6 +396,11 @@ Vc_INTRINSIC __m128i convert_int32_to_int16(__m128i a, __m128i b)
     auto tmp3 = _mm_unpackhi_epi16(tmp0, tmp1);  // 1 3 5 7 X X X X
     return _mm_unpacklo_epi16(tmp2, tmp3);       // 0 1 2 3 4 5 6 7
 }
+Vc_INTRINSIC __m128i convert_int16_to_int8(__m128i a, __m128i b)
+{
+    const __m128i lo8 = _mm_set1_epi16(0xff);
+    return _mm_packus_epi16(_mm_and_si128(a, lo8), _mm_and_si128(b, lo8));
+}
 
 // 1 SSE::Vector to 1 SSE::Vector {{{2
 // to int_v {{{3
@@ -372,6 +452,34 @@ Vc_SIMD_CAST_1(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x.data()
 Vc_SIMD_CAST_1( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x)); }
 Vc_SIMD_CAST_1( short_v, ushort_v) { return x.data(); }
+// from schar_v and uchar_v {{{3
+Vc_SIMD_CAST_1( schar_v,    int_v) { return convert<schar, int>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,   uint_v) { return convert<schar, uint>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  short_v) { return convert<schar, short>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, ushort_v) { return convert<schar, ushort>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  float_v) { return convert<schar, float>(x.data()); }
+Vc_SIMD_CAST_1( schar_v, double_v) { return convert<schar, double>(x.data()); }
+Vc_SIMD_CAST_1( schar_v,  uchar_v) { return convert<schar, uchar>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,    int_v) { return convert<uchar, int>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,   uint_v) { return convert<uchar, uint>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  short_v) { return convert<uchar, short>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, ushort_v) { return convert<uchar, ushort>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  float_v) { return convert<uchar, float>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v, double_v) { return convert<uchar, double>(x.data()); }
+Vc_SIMD_CAST_1( uchar_v,  schar_v) { return convert<uchar, schar>(x.data()); }
+// to schar_v and uchar_v {{{3
+Vc_SIMD_CAST_1(   int_v,  schar_v) { return convert<   int, schar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  schar_v) { return convert<  uint, schar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  schar_v) { return convert< short, schar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  schar_v) { return convert<ushort, schar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  schar_v) { return convert< float, schar>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  schar_v) { return convert<double, schar>(x.data()); }
+Vc_SIMD_CAST_1(   int_v,  uchar_v) { return convert<   int, uchar>(x.data()); }
+Vc_SIMD_CAST_1(  uint_v,  uchar_v) { return convert<  uint, uchar>(x.data()); }
+Vc_SIMD_CAST_1( short_v,  uchar_v) { return convert< short, uchar>(x.data()); }
+Vc_SIMD_CAST_1(ushort_v,  uchar_v) { return convert<ushort, uchar>(x.data()); }
+Vc_SIMD_CAST_1( float_v,  uchar_v) { return convert< float, uchar>(x.data()); }
+Vc_SIMD_CAST_1(double_v,  uchar_v) { return convert<double, uchar>(x.data()); }
 // 2 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_2(double_v,    int_v) {
 #ifdef Vc_IMPL_AVX
@@ -405,6 +513,18 @@ Vc_SIMD_CAST_2(  uint_v, ushort_v) { return SSE::convert_int32_to_int16(x0.data(
 Vc_SIMD_CAST_2( float_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
 Vc_SIMD_CAST_2(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1)); }
 
+Vc_SIMD_CAST_2( short_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  schar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(   int_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(  uint_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
+
+Vc_SIMD_CAST_2( short_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(ushort_v,  uchar_v) { return SSE::convert_int16_to_int8(x0.data(), x1.data()); }
+Vc_SIMD_CAST_2(   int_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2(  uint_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::short_v>(x0, x1)); }
+Vc_SIMD_CAST_2( float_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1)); }
+
 // 3 SSE::Vector to 1 SSE::Vector {{{2
 Vc_CAST_(short_v) simd_cast(double_v a, double_v b, double_v c)
 {
@@ -419,6 +539,27 @@ Vc_CAST_(ushort_v) simd_cast(double_v a, double_v b, double_v c)
 // 4 SSE::Vector to 1 SSE::Vector {{{2
 Vc_SIMD_CAST_4(double_v,  short_v) { return _mm_packs_epi32(simd_cast<SSE::int_v>(x0, x1).data(), simd_cast<SSE::int_v>(x2, x3).data()); }
 Vc_SIMD_CAST_4(double_v, ushort_v) { return simd_cast<SSE::ushort_v>(simd_cast<SSE::int_v>(x0, x1), simd_cast<SSE::int_v>(x2, x3)); }
+
+Vc_SIMD_CAST_4(   int_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(  uint_v,  schar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4( float_v,  schar_v) { return simd_cast<SSE::schar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1), simd_cast<SSE::int_v>(x2), simd_cast<SSE::int_v>(x3)); }
+Vc_SIMD_CAST_4(   int_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4(  uint_v,  uchar_v) { return SSE::convert_int16_to_int8(SSE::convert_int32_to_int16(x0.data(), x1.data()), SSE::convert_int32_to_int16(x2.data(), x3.data())); }
+Vc_SIMD_CAST_4( float_v,  uchar_v) { return simd_cast<SSE::uchar_v>(simd_cast<SSE::int_v>(x0), simd_cast<SSE::int_v>(x1), simd_cast<SSE::int_v>(x2), simd_cast<SSE::int_v>(x3)); }
+
+// 64-bit integer vectors {{{2
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST enable_if_int64_cast<To, From> simd_cast(From x)
+{
+    return convert<typename From::EntryType, typename To::EntryType>(x.data());
+}
+template <typename To, typename From>
+Vc_INTRINSIC Vc_CONST enable_if_int64_cast2<To, From> simd_cast(From x0, From x1)
+{
+    return sse_cast<typename To::VectorType>(
+        _mm_unpacklo_epi64(sse_cast<__m128i>(simd_cast<To>(x0).data()),
+                           sse_cast<__m128i>(simd_cast<To>(x1).data())));
+}
 }  // namespace SSE
 
 // 1 Scalar::Vector to 1 SSE::Vector {{{2
@@ -520,6 +661,23 @@ Vc_INTRINSIC Vc_CONST Return
         x0.data(), x1.data(), 0, 0, 0, 0, 0, 0);  // FIXME: use register-register mov
 }
 
+// 1 and 2 Scalar::Vector to 1 64-bit integer SSE::Vector {{{2
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x,
+          enable_if<SSE::is_vector<Return>::value && SSE::is_int64_vector<Return>::value>)
+{
+    return _mm_set_epi64x(0, static_cast<typename Return::EntryType>(x.data()));
+}
+template <typename Return, typename T>
+Vc_INTRINSIC Vc_CONST Return
+simd_cast(Scalar::Vector<T> x0, Scalar::Vector<T> x1,
+          enable_if<SSE::is_vector<Return>::value && SSE::is_int64_vector<Return>::value>)
+{
+    return _mm_set_epi64x(static_cast<typename Return::EntryType>(x1.data()),
+                          static_cast<typename Return::EntryType>(x0.data()));
+}
+
 // 3 Scalar::Vector to 1 SSE::Vector {{{2
 template <typename Return, typename T>
 Vc_INTRINSIC Vc_CONST Return
@@ -220,10 +220,13 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         }
 
         ////////////////////////////////////////////////////////////////////////////////
-        // all remaining converting gathers
+        // all remaining converting gathers (via a SimdArray, which does not support 8-bit
+        // and 64-bit integral entries; those use the generic implementation)
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
                                 Traits::is_valid_vector_argument<MT>::value &&
+                                (sizeof(MT) == 2 || sizeof(MT) == 4 ||
+                                 std::is_same<MT, double>::value) &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
                                void>
@@ -236,6 +239,8 @@ template <typename T> class Vector<T, VectorAbi::Sse>
         template <class MT, class U, class A, int Scale>
         Vc_INTRINSIC enable_if<((sizeof(T) != 2 || sizeof(MT) > 2) &&
                                 Traits::is_valid_vector_argument<MT>::value &&
+                                (sizeof(MT) == 2 || sizeof(MT) == 4 ||
+                                 std::is_same<MT, double>::value) &&
                                 !std::is_same<MT, T>::value &&
                                 Vector<U, A>::size() >= size()),
                                void>
@@ -429,19 +434,37 @@ static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    min(const SSE::int_v    &x, const
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   min(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::min_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  min(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_min_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v min(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::min_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  min(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::min_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  min(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_min_epu8(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  min(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_min_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v min(const SSE::double_v &x, const SSE::double_v &y) { return _mm_min_pd(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::int_v    max(const SSE::int_v    &x, const SSE::int_v    &y) { return SSE::max_epi32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::uint_v   max(const SSE::uint_v   &x, const SSE::uint_v   &y) { return SSE::max_epu32(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::short_v  max(const SSE::short_v  &x, const SSE::short_v  &y) { return _mm_max_epi16(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::ushort_v max(const SSE::ushort_v &x, const SSE::ushort_v &y) { return SSE::max_epu16(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::schar_v  max(const SSE::schar_v  &x, const SSE::schar_v  &y) { return SSE::max_epi8(x.data(), y.data()); }
+static Vc_ALWAYS_INLINE Vc_PURE SSE::uchar_v  max(const SSE::uchar_v  &x, const SSE::uchar_v  &y) { return _mm_max_epu8(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::float_v  max(const SSE::float_v  &x, const SSE::float_v  &y) { return _mm_max_ps(x.data(), y.data()); }
 static Vc_ALWAYS_INLINE Vc_PURE SSE::double_v max(const SSE::double_v &x, const SSE::double_v &y) { return _mm_max_pd(x.data(), y.data()); }
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE enable_if<std::is_integral<T>::value && sizeof(T) == 8, Vector<T, VectorAbi::Sse>>
+min(const Vector<T, VectorAbi::Sse> &x, const Vector<T, VectorAbi::Sse> &y)
+{
+    return SSE::VectorHelper<T>::min(x.data(), y.data());
+}
+template <typename T>
+Vc_ALWAYS_INLINE Vc_PURE enable_if<std::is_integral<T>::value && sizeof(T) == 8, Vector<T, VectorAbi::Sse>>
+max(const Vector<T, VectorAbi::Sse> &x, const Vector<T, VectorAbi::Sse> &y)
+{
+    return SSE::VectorHelper<T>::max(x.data(), y.data());
+}
 
 template <typename T,
           typename = enable_if<std::is_same<T, double>::value || std::is_same<T, float>::value ||
                                std::is_same<T, short>::value ||
-                               std::is_same<T, int>::value>>
+                               std::is_same<T, int>::value || std::is_same<T, schar>::value ||
+                               std::is_same<T, long long>::value ||
+                               (std::is_same<T, long>::value && sizeof(long) == 8)>>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> abs(Vector<T, VectorAbi::Sse> x)
 {
     return SSE::VectorHelper<T>::abs(x.data());
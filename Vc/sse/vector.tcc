@@ -45,6 +45,8 @@ Vc_INTRINSIC SSE::   int_m operator==(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator==(SSE::  uint_v a, SSE::  uint_v b) { return _mm_cmpeq_epi32(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: short_m operator==(SSE:: short_v a, SSE:: short_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
 Vc_INTRINSIC SSE::ushort_m operator==(SSE::ushort_v a, SSE::ushort_v b) { return _mm_cmpeq_epi16(a.data(), b.data()); }
+Vc_INTRINSIC SSE:: schar_m operator==(SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpeq_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator==(SSE:: uchar_v a, SSE:: uchar_v b) { return _mm_cmpeq_epi8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator!=(SSE::double_v a, SSE::double_v b) { return _mm_cmpneq_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator!=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpneq_ps(a.data(), b.data()); }
@@ -52,6 +54,8 @@ Vc_INTRINSIC SSE::   int_m operator!=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator!=(SSE::  uint_v a, SSE::  uint_v b) { return not_(_mm_cmpeq_epi32(a.data(), b.data())); }
 Vc_INTRINSIC SSE:: short_m operator!=(SSE:: short_v a, SSE:: short_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
 Vc_INTRINSIC SSE::ushort_m operator!=(SSE::ushort_v a, SSE::ushort_v b) { return not_(_mm_cmpeq_epi16(a.data(), b.data())); }
+Vc_INTRINSIC SSE:: schar_m operator!=(SSE:: schar_v a, SSE:: schar_v b) { return not_(_mm_cmpeq_epi8 (a.data(), b.data())); }
+Vc_INTRINSIC SSE:: uchar_m operator!=(SSE:: uchar_v a, SSE:: uchar_v b) { return not_(_mm_cmpeq_epi8 (a.data(), b.data())); }
 
 Vc_INTRINSIC SSE::double_m operator> (SSE::double_v a, SSE::double_v b) { return _mm_cmpgt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator> (SSE:: float_v a, SSE:: float_v b) { return _mm_cmpgt_ps(a.data(), b.data()); }
@@ -71,6 +75,8 @@ Vc_INTRINSIC SSE::ushort_m operator> (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmpgt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator> (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmpgt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator> (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmpgt_epu8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator< (SSE::double_v a, SSE::double_v b) { return _mm_cmplt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator< (SSE:: float_v a, SSE:: float_v b) { return _mm_cmplt_ps(a.data(), b.data()); }
@@ -90,6 +96,8 @@ Vc_INTRINSIC SSE::ushort_m operator< (SSE::ushort_v a, SSE::ushort_v b) {
     return _mm_cmplt_epi16(a.data(), b.data());
 #endif
 }
+Vc_INTRINSIC SSE:: schar_m operator< (SSE:: schar_v a, SSE:: schar_v b) { return _mm_cmplt_epi8 (a.data(), b.data()); }
+Vc_INTRINSIC SSE:: uchar_m operator< (SSE:: uchar_v a, SSE:: uchar_v b) { return SSE::cmplt_epu8 (a.data(), b.data()); }
 
 Vc_INTRINSIC SSE::double_m operator>=(SSE::double_v a, SSE::double_v b) { return _mm_cmpnlt_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator>=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmpnlt_ps(a.data(), b.data()); }
@@ -97,6 +105,8 @@ Vc_INTRINSIC SSE::   int_m operator>=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator>=(SSE::  uint_v a, SSE::  uint_v b) { return !(a < b); }
 Vc_INTRINSIC SSE:: short_m operator>=(SSE:: short_v a, SSE:: short_v b) { return !(a < b); }
 Vc_INTRINSIC SSE::ushort_m operator>=(SSE::ushort_v a, SSE::ushort_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: schar_m operator>=(SSE:: schar_v a, SSE:: schar_v b) { return !(a < b); }
+Vc_INTRINSIC SSE:: uchar_m operator>=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a < b); }
 
 Vc_INTRINSIC SSE::double_m operator<=(SSE::double_v a, SSE::double_v b) { return _mm_cmple_pd(a.data(), b.data()); }
 Vc_INTRINSIC SSE:: float_m operator<=(SSE:: float_v a, SSE:: float_v b) { return _mm_cmple_ps(a.data(), b.data()); }
@@ -104,6 +114,44 @@ Vc_INTRINSIC SSE::   int_m operator<=(SSE::   int_v a, SSE::   int_v b) { return
 Vc_INTRINSIC SSE::  uint_m operator<=(SSE::  uint_v a, SSE::  uint_v b) { return !(a > b); }
 Vc_INTRINSIC SSE:: short_m operator<=(SSE:: short_v a, SSE:: short_v b) { return !(a > b); }
 Vc_INTRINSIC SSE::ushort_m operator<=(SSE::ushort_v a, SSE::ushort_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: schar_m operator<=(SSE:: schar_v a, SSE:: schar_v b) { return !(a > b); }
+Vc_INTRINSIC SSE:: uchar_m operator<=(SSE:: uchar_v a, SSE:: uchar_v b) { return !(a > b); }
+
+// long long, unsigned long long, and (where it is 64 bits wide) long
+template <typename T>
+using enable_if_int64 =
+    enable_if<std::is_integral<T>::value && sizeof(T) == 8, SSE::Mask<T>>;
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator==(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return SSE::cmpeq_epi64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator!=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return not_(SSE::cmpeq_epi64(a.data(), b.data()));
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator>(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return std::is_signed<T>::value ? SSE::cmpgt_epi64(a.data(), b.data())
+                                    : SSE::cmpgt_epu64(a.data(), b.data());
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator<(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return b > a;
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator>=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(b > a);
+}
+template <typename T>
+Vc_INTRINSIC enable_if_int64<T> operator<=(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    return !(a > b);
+}
 
 // bitwise operators {{{1
 template <typename T>
@@ -145,7 +193,9 @@ Vc_INTRINSIC enable_if<std::is_floating_point<T>::value, SSE::Vector<T>> operato
 }
 template <typename T>
 Vc_INTRINSIC
-    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value, SSE::Vector<T>>
+    enable_if<std::is_same<int, T>::value || std::is_same<uint, T>::value ||
+                  (std::is_integral<T>::value && sizeof(T) == 8),
+              SSE::Vector<T>>
     operator/(SSE::Vector<T> a, SSE::Vector<T> b)
 {
     return SSE::Vector<T>::generate([&](int i) { return a[i] / b[i]; });
@@ -163,6 +213,20 @@ operator/(SSE::Vector<T> a, SSE::Vector<T> b)
     return HT::concat(_mm_cvttps_epi32(lo), _mm_cvttps_epi32(hi));
 }
 template <typename T>
+Vc_INTRINSIC enable_if<std::is_same<schar, T>::value || std::is_same<uchar, T>::value,
+                       SSE::Vector<T>>
+operator/(SSE::Vector<T> a, SSE::Vector<T> b)
+{
+    // every quotient of two 8-bit integers is exact in the 16-bit division. Keep the low
+    // byte instead of saturating so that -128 / -1 wraps like the scalar division.
+    using HT = SSE::VectorHelper<T>;
+    using S = SSE::Vector<short>;
+    const S lo = S(HT::expand0(a.data())) / S(HT::expand0(b.data()));
+    const S hi = S(HT::expand1(a.data())) / S(HT::expand1(b.data()));
+    const __m128i lo8 = _mm_set1_epi16(0xff);
+    return _mm_packus_epi16(_mm_and_si128(lo.data(), lo8), _mm_and_si128(hi.data(), lo8));
+}
+template <typename T>
 Vc_INTRINSIC enable_if<std::is_integral<T>::value, SSE::Vector<T>> operator%(
     SSE::Vector<T> a, SSE::Vector<T> b)
 {
@@ -207,6 +271,20 @@ Vc_INTRINSIC Vector<double, VectorAbi::Sse>::Vector(VectorSpecialInitializerInde
 {
 }
 
+#define Vc_INDEXES_FROM_ZERO_64(T_)                                                      \
+    template <>                                                                          \
+    Vc_INTRINSIC Vector<T_, VectorAbi::Sse>::Vector(VectorSpecialInitializerIndexesFromZero) \
+        : d(_mm_set_epi64x(1, 0))                                                        \
+    {                                                                                    \
+    }
+Vc_INDEXES_FROM_ZERO_64(long long)
+Vc_INDEXES_FROM_ZERO_64(unsigned long long)
+#ifdef __LP64__
+Vc_INDEXES_FROM_ZERO_64(long)
+Vc_INDEXES_FROM_ZERO_64(unsigned long)
+#endif
+#undef Vc_INDEXES_FROM_ZERO_64
+
 // load member functions {{{1
 template <typename DstT>
 template <typename SrcT, typename Flags>
@@ -344,6 +422,24 @@ Vc_GATHER_IMPL(ushort_v)
     d.v() =
         Vc::set(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6), Vc_M(7));
 }
+Vc_GATHER_IMPL(schar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13),
+                          Vc_M(14), Vc_M(15));
+}
+Vc_GATHER_IMPL(uchar_v)
+{
+    d.v() = _mm_setr_epi8(Vc_M(0), Vc_M(1), Vc_M(2), Vc_M(3), Vc_M(4), Vc_M(5), Vc_M(6),
+                          Vc_M(7), Vc_M(8), Vc_M(9), Vc_M(10), Vc_M(11), Vc_M(12), Vc_M(13),
+                          Vc_M(14), Vc_M(15));
+}
+Vc_GATHER_IMPL(llong_v)  { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+Vc_GATHER_IMPL(ullong_v) { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+#ifdef __LP64__
+Vc_GATHER_IMPL(Vector<long>)          { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+Vc_GATHER_IMPL(Vector<unsigned long>) { d.v() = _mm_set_epi64x(Vc_M(1), Vc_M(0)); }
+#endif
 #undef Vc_M
 #undef Vc_GATHER_IMPL
 
@@ -534,6 +630,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  6: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case  7: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case  8: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case  9: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case 10: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case 11: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case 12: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case 13: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case 14: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case 15: return SSE::sse_cast<VectorType>(_mm_srli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     case -1: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 1 * EntryTypeSizeof));
     case -2: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 2 * EntryTypeSizeof));
     case -3: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 3 * EntryTypeSizeof));
@@ -542,6 +645,13 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case -6: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 6 * EntryTypeSizeof));
     case -7: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 7 * EntryTypeSizeof));
     case -8: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 8 * EntryTypeSizeof));
+    case -9: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 9 * EntryTypeSizeof));
+    case -10: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 10 * EntryTypeSizeof));
+    case -11: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 11 * EntryTypeSizeof));
+    case -12: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 12 * EntryTypeSizeof));
+    case -13: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 13 * EntryTypeSizeof));
+    case -14: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 14 * EntryTypeSizeof));
+    case -15: return SSE::sse_cast<VectorType>(_mm_slli_si128(SSE::sse_cast<__m128i>(d.v()), 15 * EntryTypeSizeof));
     }
     return Zero();
 }
@@ -588,7 +698,8 @@ template<typename T> Vc_INTRINSIC Vector<T, VectorAbi::Sse> Vector<T, VectorAbi:
         case 15: return fixup(SSE::alignr_epi8<15 * EntryTypeSizeof>(v1, v0));
         }
     }
-    return shiftIn.shifted(int(size()) + amount);
+    return amount > 0 ? shiftIn.shifted(amount - int(size()))
+                      : shiftIn.shifted(int(size()) + amount);
 }
 template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::rotated(int amount) const
 {
@@ -603,11 +714,19 @@ template<typename T> Vc_INTRINSIC Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, Ve
     case  3: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<3 * EntryTypeSizeof>(v, v));
              // warning "Immediate parameter to intrinsic call too large" disabled in VcMacros.cmake.
              // ICC fails to see that the modulo operation (Size == sizeof(VectorType) / sizeof(EntryType))
-             // disables the following four calls unless sizeof(EntryType) == 2.
+             // disables the following calls unless sizeof(EntryType) <= 2.
     case  4: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<4 * EntryTypeSizeof>(v, v));
     case  5: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<5 * EntryTypeSizeof>(v, v));
     case  6: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<6 * EntryTypeSizeof>(v, v));
     case  7: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<7 * EntryTypeSizeof>(v, v));
+    case  8: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<8 * EntryTypeSizeof>(v, v));
+    case  9: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<9 * EntryTypeSizeof>(v, v));
+    case 10: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<10 * EntryTypeSizeof>(v, v));
+    case 11: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<11 * EntryTypeSizeof>(v, v));
+    case 12: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<12 * EntryTypeSizeof>(v, v));
+    case 13: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<13 * EntryTypeSizeof>(v, v));
+    case 14: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<14 * EntryTypeSizeof>(v, v));
+    case 15: return SSE::sse_cast<VectorType>(SSE::alignr_epi8<15 * EntryTypeSizeof>(v, v));
     }
     return Zero();
 }
@@ -620,6 +739,20 @@ inline Vc_CONST SSE::double_v sorted(SSE::double_v x_)
     const __m128d y = _mm_shuffle_pd(x, x, _MM_SHUFFLE2(0, 1));
     return _mm_unpacklo_pd(_mm_min_sd(x, y), _mm_max_sd(x, y));
 }
+template <typename T> Vc_INTRINSIC Vc_CONST SSE::Vector<T> sorted2(SSE::Vector<T> x)
+{
+    const SSE::Vector<T> y = _mm_shuffle_epi32(x.data(), _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm_unpacklo_epi64(min(x, y).data(), max(x, y).data());
+}
+inline Vc_CONST SSE::llong_v sorted(SSE::llong_v x) { return sorted2(x); }
+inline Vc_CONST SSE::ullong_v sorted(SSE::ullong_v x) { return sorted2(x); }
+#ifdef __LP64__
+inline Vc_CONST SSE::Vector<long> sorted(SSE::Vector<long> x) { return sorted2(x); }
+inline Vc_CONST SSE::Vector<unsigned long> sorted(SSE::Vector<unsigned long> x)
+{
+    return sorted2(x);
+}
+#endif
 }  // namespace Detail
 template <typename T>
 Vc_ALWAYS_INLINE Vc_PURE Vector<T, VectorAbi::Sse> Vector<T, VectorAbi::Sse>::sorted()
@@ -696,7 +829,63 @@ template <> template <typename G> Vc_INTRINSIC SSE::ushort_v SSE::ushort_v::gene
     const auto tmp7 = gen(7);
     return _mm_setr_epi16(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7);
 }
+template <> template <typename G> Vc_INTRINSIC SSE::schar_v SSE::schar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9,
+                         tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+}
+template <> template <typename G> Vc_INTRINSIC SSE::uchar_v SSE::uchar_v::generate(G gen)
+{
+    const auto tmp0 = gen(0);
+    const auto tmp1 = gen(1);
+    const auto tmp2 = gen(2);
+    const auto tmp3 = gen(3);
+    const auto tmp4 = gen(4);
+    const auto tmp5 = gen(5);
+    const auto tmp6 = gen(6);
+    const auto tmp7 = gen(7);
+    const auto tmp8 = gen(8);
+    const auto tmp9 = gen(9);
+    const auto tmp10 = gen(10);
+    const auto tmp11 = gen(11);
+    const auto tmp12 = gen(12);
+    const auto tmp13 = gen(13);
+    const auto tmp14 = gen(14);
+    const auto tmp15 = gen(15);
+    return _mm_setr_epi8(tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7, tmp8, tmp9,
+                         tmp10, tmp11, tmp12, tmp13, tmp14, tmp15);
+}
 // }}}1
+#define Vc_GENERATE_64(V_)                                                                \
+    template <> template <typename G> Vc_INTRINSIC SSE::V_ SSE::V_::generate(G gen)      \
+    {                                                                                    \
+        const auto tmp0 = gen(0);                                                        \
+        const auto tmp1 = gen(1);                                                        \
+        return _mm_set_epi64x(tmp1, tmp0);                                               \
+    }
+Vc_GENERATE_64(llong_v)
+Vc_GENERATE_64(ullong_v)
+#ifdef __LP64__
+Vc_GENERATE_64(Vector<long>)
+Vc_GENERATE_64(Vector<unsigned long>)
+#endif
+#undef Vc_GENERATE_64
 // reversed {{{1
 template <> Vc_INTRINSIC Vc_PURE SSE::double_v SSE::double_v::reversed() const
 {
@@ -726,6 +915,33 @@ template <> Vc_INTRINSIC Vc_PURE SSE::ushort_v SSE::ushort_v::reversed() const
         Mem::shuffle<X1, Y0>(sse_cast<__m128d>(Mem::permuteHi<X7, X6, X5, X4>(d.v())),
                              sse_cast<__m128d>(Mem::permuteLo<X3, X2, X1, X0>(d.v()))));
 }
+template <> Vc_INTRINSIC Vc_PURE SSE::schar_v SSE::schar_v::reversed() const
+{
+#ifdef Vc_IMPL_SSSE3
+    return _mm_shuffle_epi8(
+        d.v(), _mm_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0));
+#else
+    // swap the bytes in each 16-bit word and then reverse the words
+    const __m128i swapped = _mm_or_si128(_mm_slli_epi16(d.v(), 8), _mm_srli_epi16(d.v(), 8));
+    return SSE::short_v(swapped).reversed().data();
+#endif
+}
+template <> Vc_INTRINSIC Vc_PURE SSE::uchar_v SSE::uchar_v::reversed() const
+{
+    return SSE::schar_v(d.v()).reversed().data();
+}
+#define Vc_REVERSED_64(V_)                                                                \
+    template <> Vc_INTRINSIC Vc_PURE SSE::V_ SSE::V_::reversed() const                   \
+    {                                                                                    \
+        return _mm_shuffle_epi32(d.v(), _MM_SHUFFLE(1, 0, 3, 2));                        \
+    }
+Vc_REVERSED_64(llong_v)
+Vc_REVERSED_64(ullong_v)
+#ifdef __LP64__
+Vc_REVERSED_64(Vector<long>)
+Vc_REVERSED_64(Vector<unsigned long>)
+#endif
+#undef Vc_REVERSED_64
 // }}}1
 // permutation via operator[] {{{1
 template <>
@@ -611,6 +611,225 @@ namespace SSE
 #undef Vc_SUFFIX
             static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
         };
+
+        template<> struct VectorHelper<signed char> {
+            typedef __m128i VectorType;
+            typedef signed char EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i concat(__m128i a, __m128i b) { return _mm_packs_epi16(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand0(__m128i x) { return _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand1(__m128i x) { return _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            // there are no 8-bit shifts: shift the 16-bit words and clear the bits that
+            // crossed over from the neighboring byte
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return _mm_and_si128(_mm_slli_epi16(a, shift),
+                                     _mm_set1_epi8(static_cast<char>(0xff << shift)));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                const __m128i hi = _mm_and_si128(_mm_srai_epi16(a, shift), _mm_set1_epi16(-0x100));
+                const __m128i lo = _mm_srli_epi16(_mm_srai_epi16(_mm_slli_epi16(a, 8), shift), 8);
+                return _mm_or_si128(hi, lo);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) {
+                v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi8(a); }
+
+            // the low byte of a 16-bit product does not depend on the high bytes of the
+            // factors nor on their signedness
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                const __m128i even = _mm_mullo_epi16(a, b);
+                const __m128i odd = _mm_mullo_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                return _mm_or_si128(_mm_and_si128(even, _mm_set1_epi16(0x00ff)),
+                                    _mm_slli_epi16(odd, 8));
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi8(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                a = mul(a, _mm_srli_si128(a, 8));
+                a = mul(a, _mm_srli_si128(a, 4));
+                a = mul(a, _mm_srli_si128(a, 2));
+                a = mul(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                // psadbw against zero sums the bytes of each 64-bit half; the sum modulo
+                // 256 is the same for signed and unsigned entries
+                a = _mm_sad_epu8(a, _mm_setzero_si128());
+                return _mm_cvtsi128_si32(a) + _mm_extract_epi16(a, 4); // & 0xff is implicit
+            }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned char> {
+            typedef __m128i VectorType;
+            typedef unsigned char EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i concat(__m128i a, __m128i b) { return _mm_packus_epi16(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand0(__m128i x) { return _mm_unpacklo_epi8(x, _mm_setzero_si128()); }
+            static Vc_ALWAYS_INLINE Vc_CONST __m128i expand1(__m128i x) { return _mm_unpackhi_epi8(x, _mm_setzero_si128()); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+            Vc_MINMAX
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi8
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return VectorHelper<signed char>::shiftLeft(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return _mm_and_si128(_mm_srli_epi16(a, shift),
+                                     _mm_set1_epi8(static_cast<char>(0xff >> shift)));
+            }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) {
+                return VectorHelper<signed char>::mul(a, b);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) {
+                a = min(a, _mm_srli_si128(a, 8));
+                a = min(a, _mm_srli_si128(a, 4));
+                a = min(a, _mm_srli_si128(a, 2));
+                a = min(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) {
+                a = max(a, _mm_srli_si128(a, 8));
+                a = max(a, _mm_srli_si128(a, 4));
+                a = max(a, _mm_srli_si128(a, 2));
+                a = max(a, _mm_srli_si128(a, 1));
+                return _mm_cvtsi128_si32(a); // & 0xff is implicit
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) {
+                return VectorHelper<signed char>::mul(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) {
+                return VectorHelper<signed char>::add(a);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return Vc_CAT2(_mm_set1_, Vc_SUFFIX)(a); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<long long> {
+            typedef __m128i VectorType;
+            typedef long long EntryType;
+#define Vc_SUFFIX si128
+
+            Vc_OP_(or_) Vc_OP_(and_) Vc_OP_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(srai_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType abs(const VectorType a) { return abs_epi64(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+        template<> struct VectorHelper<unsigned long long> {
+            typedef __m128i VectorType;
+            typedef unsigned long long EntryType;
+#define Vc_SUFFIX si128
+            Vc_OP_CAST_(or_) Vc_OP_CAST_(and_) Vc_OP_CAST_(xor_)
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType zero() { return Vc_CAT2(_mm_setzero_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType notMaskedToZero(VectorType a, __m128 mask) { return Vc_CAT2(_mm_and_, Vc_SUFFIX)(_mm_castps_si128(mask), a); }
+
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epu64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType one() { return Vc_CAT2(_mm_setone_, Vc_SUFFIX)(); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType min(VectorType a, VectorType b) { return min_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType max(VectorType a, VectorType b) { return max_epu64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType min(VectorType a) { return cvtsi128_si64(min(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType max(VectorType a) { return cvtsi128_si64(max(a, _mm_unpackhi_epi64(a, a))); }
+#undef Vc_SUFFIX
+#define Vc_SUFFIX epi64
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftLeft(VectorType a, int shift) {
+                return Vc_CAT2(_mm_slli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType shiftRight(VectorType a, int shift) {
+                return Vc_CAT2(_mm_srli_, Vc_SUFFIX)(a, shift);
+            }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a) { return _mm_set1_epi64x(a); }
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType set(const EntryType a, const EntryType b) { return _mm_set_epi64x(a, b); }
+
+            static Vc_ALWAYS_INLINE void fma(VectorType &v1, VectorType v2, VectorType v3) { v1 = add(mul(v1, v2), v3); }
+
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType mul(VectorType a, VectorType b) { return mullo_epi64(a, b); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType mul(VectorType a) { return cvtsi128_si64(mul(a, _mm_unpackhi_epi64(a, a))); }
+            static Vc_ALWAYS_INLINE Vc_CONST EntryType add(VectorType a) { return cvtsi128_si64(add(a, _mm_unpackhi_epi64(a, a))); }
+
+            Vc_OP(add) Vc_OP(sub)
+#undef Vc_SUFFIX
+            static Vc_ALWAYS_INLINE Vc_CONST VectorType round(VectorType a) { return a; }
+        };
+
+#ifdef __LP64__
+        // long is a distinct type from long long even where both have 64 bits
+        template<> struct VectorHelper<long> : public VectorHelper<long long> {
+            typedef long EntryType;
+        };
+        template<> struct VectorHelper<unsigned long> : public VectorHelper<unsigned long long> {
+            typedef unsigned long EntryType;
+        };
+#endif
 #undef Vc_OP1
 #undef Vc_OP
 #undef Vc_OP_
@@ -57,7 +57,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define Vc_VERSION_CHECK(major, minor, patch) ((major << 16) | (minor << 8) | (patch << 1))
 //@}
 
-#define Vc_LIBRARY_ABI_VERSION 5
+#define Vc_LIBRARY_ABI_VERSION 6
 
 ///\internal identify Vc 2.0
 #define Vc_IS_VERSION_2 (Vc_VERSION_NUMBER >= Vc_VERSION_CHECK(1, 70, 0))
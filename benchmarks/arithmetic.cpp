@@ -0,0 +1,104 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// integer only {{{1
+template <typename V> void integerOps(Suite &s, std::false_type)
+{
+    const V zero = opaque(V::Zero());
+    const V ones = opaque(~V::Zero());
+    const V init = opaque(V::IndexesFromZero());
+    latencyAndThroughput(s, "and", init, [&](V x) { return x & ones; });
+    latencyAndThroughput(s, "or", init, [&](V x) { return x | zero; });
+    latencyAndThroughput(s, "xor", init, [&](V x) { return x ^ zero; });
+    latencyAndThroughput(s, "shift_left_1", init, [&](V x) { return x << 1; });
+    latencyAndThroughput(s, "shift_right_1", init, [&](V x) { return x >> 1; });
+    latencyAndThroughput(s, "shift_left_vector", init, [&](V x) { return x << zero; });
+    latencyAndThroughput(s, "shift_right_vector", init, [&](V x) { return x >> zero; });
+}
+template <typename V> void integerOps(Suite &, std::true_type) {}
+
+// floating-point only {{{1
+template <typename V> void floatingPointOps(Suite &s, std::true_type)
+{
+    using T = typename V::EntryType;
+    const V zero = opaque(V::Zero());
+    const V one = opaque(V(T(1)));
+    const V two = opaque(V(2));
+    latencyAndThroughput(s, "fma", one, [&](V x) { return Vc::fma(x, one, zero); });
+    latencyAndThroughput(s, "sqrt", two, [&](V x) { return Vc::sqrt(x); });
+    latencyAndThroughput(s, "rsqrt", one, [&](V x) { return Vc::rsqrt(x); });
+    latencyAndThroughput(s, "reciprocal", one, [&](V x) { return Vc::reciprocal(x); });
+    latencyAndThroughput(s, "floor", two, [&](V x) { return Vc::floor(x); });
+    latencyAndThroughput(s, "round", two, [&](V x) { return Vc::round(x); });
+    latencyAndThroughput(s, "isnan_blend", one,
+                         [&](V x) { return Vc::iif(Vc::isnan(x), zero, x); });
+}
+template <typename V> void floatingPointOps(Suite &, std::false_type) {}
+
+// abs {{{1
+template <typename V> void absOp(Suite &s, std::true_type)
+{
+    latencyAndThroughput(s, "abs", opaque(V(-1)), [&](V x) { return Vc::abs(x); });
+}
+template <typename V> void absOp(Suite &, std::false_type) {}
+
+// arithmetic {{{1
+template <typename V> void arithmetic(Suite &s)
+{
+    using T = typename V::EntryType;
+    const V one = opaque(V(T(1)));
+    const V init = opaque(V(T(3)));
+    latencyAndThroughput(s, "add", init, [&](V x) { return x + one; });
+    latencyAndThroughput(s, "sub", init, [&](V x) { return x - one; });
+    latencyAndThroughput(s, "mul", init, [&](V x) { return x * one; });
+    latencyAndThroughput(s, "div", init, [&](V x) { return x / one; });
+    latencyAndThroughput(s, "min", init, [&](V x) { return Vc::min(x, init); });
+    latencyAndThroughput(s, "max", init, [&](V x) { return Vc::max(x, init); });
+    latencyAndThroughput(s, "compare_blend", init,
+                         [&](V x) { return Vc::iif(x < one, one, x); });
+    absOp<V>(s, std::integral_constant<bool, std::is_signed<T>::value>());
+    floatingPointOps<V>(s, std::is_floating_point<T>());
+    integerOps<V>(s, std::is_floating_point<T>());
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("arithmetic", argc, argv);
+    arithmetic<Vc::float_v>(s);
+    arithmetic<Vc::double_v>(s);
+    arithmetic<Vc::int_v>(s);
+    arithmetic<Vc::uint_v>(s);
+    arithmetic<Vc::short_v>(s);
+    arithmetic<Vc::ushort_v>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
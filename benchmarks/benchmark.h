@@ -0,0 +1,468 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_BENCHMARKS_BENCHMARK_H_
+#define VC_BENCHMARKS_BENCHMARK_H_
+
+#include <Vc/Vc>
+#include <Vc/support.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "../examples/perfcounters.h"
+#include "../examples/tsc.h"
+
+/**
+ * \file
+ * Minimal harness for the micro-benchmarks in this directory.
+ *
+ * Every benchmark executable is built once per implementation (and gather strategy) and
+ * writes one JSON document of the form
+ * \code
+ * {
+ *   "suite": "arithmetic", "implementation": "SSE4_2+FMA", "variant": "",
+ *   "vc_version": "1.4.1-dev", "compiler": "...",
+ *   "results": [
+ *     {"name": "mul", "type": "float_v", "entries": 4, "kind": "latency",
+ *      "calls": 1048576, "cycles": 4.01, "cycles_min": 4.00, "cycles_per_entry": 1.00,
+ *      "ns": 1.34, "overhead_cycles": 0, "core_cycles": 3.1, "ref_cycles": 4.0,
+ *      "instructions": 1.02, "l1d_misses": 0, "llc_misses": 0, "branch_misses": 0},
+ *     ...
+ *   ]
+ * }
+ * \endcode
+ * \c cycles and \c ns are the median time per call over several repetitions, \c
+ * cycles_min the fastest repetition. Cycles are read from the time stamp counter, i.e.
+ * they are reference cycles, not core cycles. \c kind is one of \c latency (every call
+ * depends on the result of the previous one) or \c throughput (independent calls).
+ * The hardware counters (see PerfCounters) are averaged over all repetitions and are
+ * \c null where unavailable. They include the reseeding overhead. \c core_cycles does
+ * not depend on the clock frequency, in contrast to \c cycles.
+ *
+ * Usage: `bench_<name>_<impl> [-o <file.json>] [-f <substring>]`, where \c -f restricts
+ * the run to the benchmarks whose `type/name` (e.g. `float_v/sin`) contains the
+ * substring.
+ */
+
+namespace Benchmark
+{
+// escape {{{1
+/**
+ * Makes the compiler forget what it knows about \p x, without costing an instruction.
+ * Use it on the inputs before and the results after a measured loop.
+ */
+template <typename T> Vc_ALWAYS_INLINE void escape(T &x)
+{
+#ifdef Vc_MSVC
+    volatile char *p = reinterpret_cast<volatile char *>(&x);
+    *p = *p;
+#else
+    asm volatile("" : "+m"(x)::"memory");
+#endif
+}
+
+// typeName {{{1
+template <typename T> struct EntryName;
+#define Vc_ENTRY_NAME_(T_, name_)                                                        \
+    template <> struct EntryName<T_> {                                                   \
+        static std::string get() { return name_; }                                       \
+    }
+Vc_ENTRY_NAME_(float, "float");
+Vc_ENTRY_NAME_(double, "double");
+Vc_ENTRY_NAME_(int, "int");
+Vc_ENTRY_NAME_(unsigned int, "uint");
+Vc_ENTRY_NAME_(short, "short");
+Vc_ENTRY_NAME_(unsigned short, "ushort");
+#undef Vc_ENTRY_NAME_
+
+template <typename V> struct TypeName;
+template <typename T, typename Abi> struct TypeName<Vc::Vector<T, Abi>> {
+    static std::string get() { return EntryName<T>::get() + "_v"; }
+};
+template <typename T, std::size_t N, typename V, std::size_t M>
+struct TypeName<Vc::SimdArray<T, N, V, M>> {
+    static std::string get()
+    {
+        std::ostringstream s;
+        s << "SimdArray<" << EntryName<T>::get() << ", " << N << '>';
+        return s.str();
+    }
+};
+template <typename V> std::string typeName() { return TypeName<V>::get(); }
+
+// implementationName {{{1
+inline std::string implementationName()
+{
+    using I = Vc::CurrentImplementation;
+    std::string name = I::is(Vc::ScalarImpl) ? "Scalar"
+                     : I::is(Vc::SSE2Impl)   ? "SSE2"
+                     : I::is(Vc::SSE3Impl)   ? "SSE3"
+                     : I::is(Vc::SSSE3Impl)  ? "SSSE3"
+                     : I::is(Vc::SSE41Impl)  ? "SSE4_1"
+                     : I::is(Vc::SSE42Impl)  ? "SSE4_2"
+                     : I::is(Vc::AVXImpl)    ? "AVX"
+                     : I::is(Vc::AVX2Impl)   ? "AVX2"
+                                             : "unknown";
+#ifdef Vc_IMPL_XOP
+    name += "+XOP";
+#endif
+#ifdef Vc_IMPL_FMA4
+    name += "+FMA4";
+#endif
+#ifdef Vc_IMPL_FMA
+    name += "+FMA";
+#endif
+#ifdef Vc_IMPL_POPCNT
+    name += "+POPCNT";
+#endif
+#ifdef Vc_IMPL_BMI2
+    name += "+BMI2";
+#endif
+    return name;
+}
+
+// Result {{{1
+struct Result {
+    std::string name;
+    std::string type;
+    std::size_t entries;
+    const char *kind;
+    std::size_t calls;
+    double cycles;
+    double cyclesMin;
+    double ns;
+    double overheadCycles;
+    double counters[PerfCounters::EventCount];
+};
+
+inline std::string quoted(const std::string &s)
+{
+    std::string r = "\"";
+    for (char c : s) {
+        if (c == '"' || c == '\\') {
+            r += '\\';
+        }
+        r += c;
+    }
+    return r += '"';
+}
+
+// Suite {{{1
+/**
+ * Collects the results of one benchmark executable and writes them as JSON on
+ * destruction, either to the file given with `-o` or to stdout.
+ */
+class Suite
+{
+public:
+    Suite(const char *name, int argc, char **argv, const char *variant = "")
+        : m_name(name), m_variant(variant)
+    {
+        if (!Vc::currentImplementationSupported()) {
+            std::cerr << "CPU or OS requirements not met for the compiled in vector unit!\n";
+            std::exit(-1);
+        }
+        for (int i = 1; i + 1 < argc; i += 2) {
+            if (std::strcmp(argv[i], "-o") == 0) {
+                m_output = argv[i + 1];
+            } else if (std::strcmp(argv[i], "-f") == 0) {
+                m_filter = argv[i + 1];
+            } else {
+                std::cerr << "usage: " << argv[0] << " [-o <file.json>] [-f <substring>]\n";
+                std::exit(1);
+            }
+        }
+    }
+
+    ~Suite()
+    {
+        std::ostringstream out;
+        out << "{\n  \"suite\": " << quoted(m_name)
+            << ",\n  \"implementation\": " << quoted(implementationName())
+            << ",\n  \"variant\": " << quoted(m_variant)
+            << ",\n  \"vc_version\": " << quoted(Vc::versionString())
+#ifdef __VERSION__
+            << ",\n  \"compiler\": " << quoted(__VERSION__)
+#endif
+            << ",\n  \"results\": [";
+        const char *separator = "\n";
+        for (const Result &r : m_results) {
+            out << separator << "    {\"name\": " << quoted(r.name)
+                << ", \"type\": " << quoted(r.type) << ", \"entries\": " << r.entries
+                << ", \"kind\": " << quoted(r.kind) << ", \"calls\": " << r.calls
+                << ", \"cycles\": " << r.cycles << ", \"cycles_min\": " << r.cyclesMin
+                << ", \"cycles_per_entry\": " << r.cycles / r.entries
+                << ", \"ns\": " << r.ns << ", \"overhead_cycles\": " << r.overheadCycles;
+            static const char *const counterNames[PerfCounters::EventCount] = {
+                "core_cycles", "ref_cycles",  "instructions",
+                "l1d_misses",  "llc_misses", "branch_misses"};
+            for (int e = 0; e < PerfCounters::EventCount; ++e) {
+                out << ", \"" << counterNames[e] << "\": ";
+                if (m_perf.available(static_cast<PerfCounters::Event>(e))) {
+                    out << r.counters[e];
+                } else {
+                    out << "null";
+                }
+            }
+            out << '}';
+            separator = ",\n";
+        }
+        out << "\n  ]\n}\n";
+        if (m_output.empty()) {
+            std::cout << out.str();
+        } else {
+            std::ofstream(m_output) << out.str();
+        }
+    }
+
+    /// Returns whether `type/name` matches the filter given with `-f`.
+    bool enabled(const std::string &name, const std::string &type) const
+    {
+        return m_filter.empty() || (type + '/' + name).find(m_filter) != std::string::npos;
+    }
+
+    /**
+     * Measures \p f, which must execute its argument number of calls of the benchmarked
+     * operation. The number of calls is doubled until one repetition takes long enough
+     * to be measured reliably; the median over several repetitions is recorded.
+     *
+     * \return the median number of cycles per call
+     */
+    template <typename F>
+    double run(const std::string &name, const std::string &type, std::size_t entries,
+               const char *kind, F &&f, double overheadCycles = 0)
+    {
+        constexpr int Repetitions = 9;
+        constexpr unsigned long long MinCycles = 2000000;
+        TimeStampCounter tsc;
+        std::size_t calls = 1024;
+        f(calls);  // warm up caches and let the clock ramp up
+        for (;;) {
+            tsc.start();
+            f(calls);
+            tsc.stop();
+            if (tsc.cycles() >= MinCycles || calls >= (std::size_t(1) << 30)) {
+                break;
+            }
+            calls *= 2;
+        }
+        double cycles[Repetitions];
+        double ns[Repetitions];
+        m_perf.start();
+        for (int rep = 0; rep < Repetitions; ++rep) {
+            const auto t0 = std::chrono::steady_clock::now();
+            tsc.start();
+            f(calls);
+            tsc.stop();
+            const auto t1 = std::chrono::steady_clock::now();
+            cycles[rep] = double(tsc.cycles()) / calls;
+            ns[rep] = std::chrono::duration<double, std::nano>(t1 - t0).count() / calls;
+        }
+        m_perf.stop();
+        const double cyclesMin = *std::min_element(cycles, cycles + Repetitions);
+        std::nth_element(cycles, cycles + Repetitions / 2, cycles + Repetitions);
+        std::nth_element(ns, ns + Repetitions / 2, ns + Repetitions);
+        const double median = cycles[Repetitions / 2];
+        Result r = {name, type, entries, kind, calls,
+                    std::max(0., median - overheadCycles),
+                    std::max(0., cyclesMin - overheadCycles), ns[Repetitions / 2],
+                    overheadCycles, {}};
+        for (int e = 0; e < PerfCounters::EventCount; ++e) {
+            r.counters[e] =
+                m_perf[static_cast<PerfCounters::Event>(e)] / (double(calls) * Repetitions);
+        }
+        m_results.push_back(r);
+        return median;
+    }
+
+private:
+    std::string m_name;
+    std::string m_variant;
+    std::string m_output;
+    std::string m_filter;
+    std::vector<Result> m_results;
+    PerfCounters m_perf;
+};
+
+// Buffer {{{1
+/// Page-aligned memory of \p size entries of type \p T, zero-initialized.
+template <typename T> class Buffer
+{
+public:
+    explicit Buffer(std::size_t size)
+        : m_size(size), m_data(Vc::malloc<T, Vc::AlignOnPage>(size))
+    {
+        std::fill_n(m_data, size, T());
+    }
+    ~Buffer() { Vc::free(m_data); }
+    Buffer(const Buffer &) = delete;
+    Buffer &operator=(const Buffer &) = delete;
+
+    T *data() { return m_data; }
+    std::size_t size() const { return m_size; }
+    T &operator[](std::size_t i) { return m_data[i]; }
+
+private:
+    std::size_t m_size;
+    T *m_data;
+};
+
+// latency / throughput {{{1
+/**
+ * Measures the latency of \p op by executing `x = op(x)` in a dependency chain, starting
+ * from \p init. \p op must map its domain onto itself, e.g. `x * one` with \c one
+ * opaque to the compiler.
+ *
+ * \return the median number of cycles per call before subtracting \p overheadCycles
+ */
+template <typename V, typename F>
+double latency(Suite &suite, const std::string &name, const V &init, F &&op,
+               double overheadCycles = 0)
+{
+    if (!suite.enabled(name, typeName<V>())) {
+        return 0;
+    }
+    return suite.run(name, typeName<V>(), V::size(), "latency", [&](std::size_t calls) {
+        V x = init;
+        escape(x);
+        for (std::size_t i = 0; i < calls; ++i) {
+            x = op(x);
+        }
+        escape(x);
+    }, overheadCycles);
+}
+
+/**
+ * Measures the reciprocal throughput of \p op by executing eight independent chains of
+ * `x = op(x)` interleaved.
+ */
+template <typename V, typename F>
+void throughput(Suite &suite, const std::string &name, const V &init, F &&op)
+{
+    if (!suite.enabled(name, typeName<V>())) {
+        return;
+    }
+    suite.run(name, typeName<V>(), V::size(), "throughput", [&](std::size_t calls) {
+        V x[8];
+        for (V &xi : x) {
+            xi = init;
+            escape(xi);
+        }
+        for (std::size_t i = 0; i < calls; i += 8) {
+            Vc::Common::unrolled_loop<int, 0, 8>([&](int k) { x[k] = op(x[k]); });
+        }
+        for (V &xi : x) {
+            escape(xi);
+        }
+    });
+}
+
+/// Measures both latency() and throughput() of \p op.
+template <typename V, typename F>
+void latencyAndThroughput(Suite &suite, const std::string &name, const V &init, F &&op)
+{
+    latency(suite, name, init, op);
+    throughput(suite, name, init, op);
+}
+
+// opaque {{{1
+/**
+ * Returns \p x hidden from the optimizer, so that e.g. `x * opaque(V(T(1)))` is not
+ * folded away.
+ */
+template <typename T> Vc_ALWAYS_INLINE T opaque(T x)
+{
+    escape(x);
+    return x;
+}
+
+// spread {{{1
+/// Returns a vector with its entries evenly spread over [lo, hi].
+template <typename V> V spread(double lo, double hi)
+{
+    using T = typename V::EntryType;
+    return V([&](int i) { return T(lo + (hi - lo) * (i + 0.5) / V::size()); });
+}
+
+// Reseeded {{{1
+/**
+ * Measures functions that do not map their domain onto itself, e.g. math functions.
+ *
+ * Every call is fed `input + x * zero`, which depends on the previous result but always
+ * evaluates to the same input values. The latency of this reseeding is measured once per
+ * type (as "reseed", before the first function) and subtracted from the latency
+ * results.
+ */
+template <typename V> class Reseeded
+{
+public:
+    explicit Reseeded(Suite &s) : m_suite(s), m_zero(opaque(V::Zero())) {}
+
+    /// Measures latency and throughput of \p f for inputs spread over [\p lo, \p hi].
+    template <typename F> void operator()(const std::string &name, double lo, double hi, F &&f)
+    {
+        if (!m_suite.enabled(name, typeName<V>())) {
+            return;
+        }
+        const V &zero = m_zero;
+        if (m_overhead < 0) {
+            const V one = opaque(V(typename V::EntryType(1)));
+            m_overhead = m_suite.run(
+                "reseed", typeName<V>(), V::size(), "latency", [&](std::size_t calls) {
+                    V x = one;
+                    escape(x);
+                    for (std::size_t i = 0; i < calls; ++i) {
+                        x = one + x * zero;
+                    }
+                    escape(x);
+                });
+        }
+        const V input = opaque(spread<V>(lo, hi));
+        const auto op = [&](V x) { return f(input + x * zero); };
+        latency(m_suite, name, input, op, m_overhead);
+        throughput(m_suite, name, input, op);
+    }
+
+private:
+    Suite &m_suite;
+    const V m_zero;
+    double m_overhead = -1;
+};
+
+// }}}1
+}  // namespace Benchmark
+
+#endif  // VC_BENCHMARKS_BENCHMARK_H_
+
+// vim: foldmethod=marker
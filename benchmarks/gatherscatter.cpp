@@ -0,0 +1,194 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+#include <Vc/Allocator>
+#include <random>
+
+using namespace Benchmark;
+
+// This file is built once per gather/scatter strategy (see CMakeLists.txt). The
+// strategies only differ for masked gathers and scatters, which are measured with full,
+// half, single-entry, and random masks. The random masks cycle through a table, so that
+// strategies that branch on the mask pay for the mispredictions.
+
+#if defined Vc_USE_SET_GATHERS
+static const char *const strategy = "Vc_USE_SET_GATHERS";
+#elif defined Vc_USE_BSF_GATHERS
+static const char *const strategy = "Vc_USE_BSF_GATHERS";
+#elif defined Vc_USE_POPCNT_BSF_GATHERS
+static const char *const strategy = "Vc_USE_POPCNT_BSF_GATHERS";
+#else
+static const char *const strategy = "";
+#endif
+
+enum : std::size_t { TableSize = 4096, IndexCount = 256 };
+
+// the index and mask types may require more alignment than std::allocator provides
+template <typename T> using AlignedVector = std::vector<T, Vc::Allocator<T>>;
+
+// Fixture {{{1
+template <typename V> struct Fixture {
+    using T = typename V::EntryType;
+    using IT = typename V::IndexType;
+    using M = typename V::Mask;
+
+    Fixture() : table(TableSize)
+    {
+        std::default_random_engine rne;
+        // a random cyclic permutation, so that following the stored indexes visits every
+        // entry of the table
+        std::vector<int> order(TableSize);
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            order[i] = int(i);
+        }
+        std::shuffle(order.begin() + 1, order.end(), rne);
+        for (std::size_t i = 0; i < TableSize; ++i) {
+            table[order[i]] = T(order[(i + 1) % TableSize]);
+        }
+        std::uniform_int_distribution<int> dist(0, TableSize - 1);
+        std::bernoulli_distribution coin;
+        for (std::size_t i = 0; i < IndexCount; ++i) {
+            indexes.push_back(IT([&](int) { return dist(rne); }));
+            M m;
+            for (std::size_t j = 0; j < V::size(); ++j) {
+                m[j] = coin(rne);
+            }
+            randomMasks.push_back(m);
+        }
+    }
+
+    Buffer<T> table;
+    AlignedVector<IT> indexes;
+    AlignedVector<M> randomMasks;
+};
+
+// gather {{{1
+template <typename V> void gather(Suite &s, Fixture<V> &f)
+{
+    using IT = typename V::IndexType;
+    using M = typename V::Mask;
+    const std::string type = typeName<V>();
+    if (s.enabled("gather", type)) {
+        // latency: the gathered values are the indexes of the next gather
+        s.run("gather", type, V::size(), "latency", [&](std::size_t calls) {
+            IT i = f.indexes[0];
+            const typename V::EntryType *mem = f.table.data();
+            escape(mem);
+            for (std::size_t n = 0; n < calls; ++n) {
+                i = Vc::simd_cast<IT>(V(mem, i));
+            }
+            escape(i);
+        });
+        s.run("gather", type, V::size(), "throughput", [&](std::size_t calls) {
+            V acc = V::Zero();
+            const typename V::EntryType *mem = f.table.data();
+            escape(mem);
+            for (std::size_t n = 0; n < calls; ++n) {
+                acc += V(mem, f.indexes[n % IndexCount]);
+            }
+            escape(acc);
+        });
+    }
+    const auto masked = [&](const std::string &name, const AlignedVector<M> &masks) {
+        if (!s.enabled(name, type)) {
+            return;
+        }
+        s.run(name, type, V::size(), "throughput", [&](std::size_t calls) {
+            V acc = V::Zero();
+            const typename V::EntryType *mem = f.table.data();
+            escape(mem);
+            for (std::size_t n = 0; n < calls; ++n) {
+                V x = V::Zero();
+                x.gather(mem, f.indexes[n % IndexCount], masks[n % masks.size()]);
+                acc += x;
+            }
+            escape(acc);
+        });
+    };
+    const V iota = V::IndexesFromZero();
+    masked("gather_masked_full", {M(true)});
+    masked("gather_masked_half", {iota < V(V::size() / 2 + 1)});
+    masked("gather_masked_one", {iota == V::Zero()});
+    masked("gather_masked_random", f.randomMasks);
+}
+
+// scatter {{{1
+template <typename V> void scatter(Suite &s, Fixture<V> &f)
+{
+    using M = typename V::Mask;
+    const std::string type = typeName<V>();
+    const V x = opaque(V::IndexesFromZero());
+    if (s.enabled("scatter", type)) {
+        s.run("scatter", type, V::size(), "throughput", [&](std::size_t calls) {
+            typename V::EntryType *mem = f.table.data();
+            escape(mem);
+            for (std::size_t n = 0; n < calls; ++n) {
+                x.scatter(mem, f.indexes[n % IndexCount]);
+            }
+            escape(mem);
+        });
+    }
+    const auto masked = [&](const std::string &name, const AlignedVector<M> &masks) {
+        if (!s.enabled(name, type)) {
+            return;
+        }
+        s.run(name, type, V::size(), "throughput", [&](std::size_t calls) {
+            typename V::EntryType *mem = f.table.data();
+            escape(mem);
+            for (std::size_t n = 0; n < calls; ++n) {
+                x.scatter(mem, f.indexes[n % IndexCount], masks[n % masks.size()]);
+            }
+            escape(mem);
+        });
+    };
+    const V iota = V::IndexesFromZero();
+    masked("scatter_masked_full", {M(true)});
+    masked("scatter_masked_half", {iota < V(V::size() / 2 + 1)});
+    masked("scatter_masked_one", {iota == V::Zero()});
+    masked("scatter_masked_random", f.randomMasks);
+}
+
+// gatherScatter {{{1
+template <typename V> void gatherScatter(Suite &s)
+{
+    Fixture<V> f;
+    gather(s, f);
+    scatter(s, f);
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("gatherscatter", argc, argv, strategy);
+    gatherScatter<Vc::float_v>(s);
+    gatherScatter<Vc::double_v>(s);
+    gatherScatter<Vc::int_v>(s);
+    gatherScatter<Vc::short_v>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,65 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// The reductions return a scalar. To chain them, the result is broadcast again, so the
+// latency results include one broadcast.
+
+template <typename V> void horizontal(Suite &s)  // {{{1
+{
+    using T = typename V::EntryType;
+    const V zero = opaque(V::Zero());
+    const V one = opaque(V(T(1)));
+    const V iota = opaque(V::IndexesFromZero());
+    latencyAndThroughput(s, "sum", zero, [](V x) { return V(x.sum()); });
+    latencyAndThroughput(s, "product", one, [](V x) { return V(x.product()); });
+    latencyAndThroughput(s, "min", iota, [](V x) { return V(x.min()); });
+    latencyAndThroughput(s, "max", iota, [](V x) { return V(x.max()); });
+    latencyAndThroughput(s, "partialSum", zero, [](V x) { return x.partialSum(); });
+    latencyAndThroughput(s, "sorted", iota, [](V x) { return x.sorted(); });
+    latencyAndThroughput(s, "reversed", iota, [](V x) { return x.reversed(); });
+    latencyAndThroughput(s, "rotated", iota, [](V x) { return x.rotated(1); });
+    latencyAndThroughput(s, "mask_count", iota,
+                         [&](V x) { return V(T((x < one).count())); });
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("horizontal", argc, argv);
+    horizontal<Vc::float_v>(s);
+    horizontal<Vc::double_v>(s);
+    horizontal<Vc::int_v>(s);
+    horizontal<Vc::uint_v>(s);
+    horizontal<Vc::short_v>(s);
+    horizontal<Vc::ushort_v>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
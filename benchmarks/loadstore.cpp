@@ -0,0 +1,160 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// Loads and stores only have a meaningful throughput. Every call accesses the next
+// vector in a buffer that either fits into the L1 cache or is much larger than the last
+// level cache.
+
+enum : std::size_t { L1Bytes = 16 * 1024, MemoryBytes = 64 * 1024 * 1024 };
+
+// load {{{1
+template <typename V, typename Flags>
+void load(Suite &s, Buffer<typename V::EntryType> &buffer, const std::string &name,
+          std::size_t offset, Flags flags)
+{
+    if (!s.enabled(name, typeName<V>())) {
+        return;
+    }
+    const std::size_t end = buffer.size() - V::size() * 4 - offset;
+    std::size_t next = 0;  // continue where the last repetition stopped
+    s.run(name, typeName<V>(), V::size(), "throughput", [&](std::size_t calls) {
+        const typename V::EntryType *mem = buffer.data() + offset;
+        escape(mem);
+        V acc[4] = {V::Zero(), V::Zero(), V::Zero(), V::Zero()};
+        std::size_t j = next;
+        for (std::size_t i = 0; i < calls; i += 4) {
+            Vc::Common::unrolled_loop<int, 0, 4>(
+                [&](int k) { acc[k] += V(mem + j + k * V::size(), flags); });
+            j += 4 * V::size();
+            if (j >= end) {
+                j = 0;
+            }
+        }
+        next = j;
+        for (V &x : acc) {
+            escape(x);
+        }
+    });
+}
+
+// store {{{1
+template <typename V, typename Flags>
+void store(Suite &s, Buffer<typename V::EntryType> &buffer, const std::string &name,
+           std::size_t offset, Flags flags)
+{
+    if (!s.enabled(name, typeName<V>())) {
+        return;
+    }
+    const std::size_t end = buffer.size() - V::size() * 4 - offset;
+    std::size_t next = 0;  // continue where the last repetition stopped
+    s.run(name, typeName<V>(), V::size(), "throughput", [&](std::size_t calls) {
+        typename V::EntryType *mem = buffer.data() + offset;
+        V x = V::IndexesFromZero();
+        escape(mem);
+        escape(x);
+        std::size_t j = next;
+        for (std::size_t i = 0; i < calls; i += 4) {
+            Vc::Common::unrolled_loop<int, 0, 4>(
+                [&](int k) { x.store(mem + j + k * V::size(), flags); });
+            j += 4 * V::size();
+            if (j >= end) {
+                j = 0;
+            }
+        }
+        next = j;
+        escape(mem);
+    });
+}
+
+template <typename V, typename Flags>
+void maskedStore(Suite &s, Buffer<typename V::EntryType> &buffer, const std::string &name,
+                 Flags flags)
+{
+    if (!s.enabled(name, typeName<V>())) {
+        return;
+    }
+    const std::size_t end = buffer.size() - V::size() * 4;
+    std::size_t next = 0;  // continue where the last repetition stopped
+    s.run(name, typeName<V>(), V::size(), "throughput", [&](std::size_t calls) {
+        typename V::EntryType *mem = buffer.data();
+        V x = V::IndexesFromZero();
+        typename V::Mask mask = x < V(V::size() / 2 + 1);
+        escape(mem);
+        escape(x);
+        escape(mask);
+        std::size_t j = next;
+        for (std::size_t i = 0; i < calls; i += 4) {
+            Vc::Common::unrolled_loop<int, 0, 4>(
+                [&](int k) { x.store(mem + j + k * V::size(), mask, flags); });
+            j += 4 * V::size();
+            if (j >= end) {
+                j = 0;
+            }
+        }
+        next = j;
+        escape(mem);
+    });
+}
+
+// loadStore {{{1
+template <typename V> void loadStore(Suite &s, std::size_t bytes, const std::string &where)
+{
+    using T = typename V::EntryType;
+    Buffer<T> buffer(bytes / sizeof(T));
+    load<V>(s, buffer, "load_aligned_" + where, 0, Vc::Aligned);
+    load<V>(s, buffer, "load_unaligned_" + where, 0, Vc::Unaligned);
+    load<V>(s, buffer, "load_misaligned_" + where, 1, Vc::Unaligned);
+    load<V>(s, buffer, "load_streaming_" + where, 0, Vc::Aligned | Vc::Streaming);
+    load<V>(s, buffer, "load_prefetch_" + where, 0, Vc::Aligned | Vc::PrefetchDefault);
+    store<V>(s, buffer, "store_aligned_" + where, 0, Vc::Aligned);
+    store<V>(s, buffer, "store_unaligned_" + where, 0, Vc::Unaligned);
+    store<V>(s, buffer, "store_misaligned_" + where, 1, Vc::Unaligned);
+    store<V>(s, buffer, "store_streaming_" + where, 0, Vc::Aligned | Vc::Streaming);
+    maskedStore<V>(s, buffer, "store_masked_" + where, Vc::Aligned);
+}
+
+template <typename V> void loadStore(Suite &s)
+{
+    loadStore<V>(s, L1Bytes, "l1");
+    loadStore<V>(s, MemoryBytes, "memory");
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("loadstore", argc, argv);
+    loadStore<Vc::float_v>(s);
+    loadStore<Vc::double_v>(s);
+    loadStore<Vc::int_v>(s);
+    loadStore<Vc::short_v>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,79 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// math {{{1
+template <typename V> void math(Suite &s)
+{
+    Reseeded<V> bench(s);
+    const V y = opaque(spread<V>(-3, 5));
+    bench("sin", -8192, 8192, [](V x) { return Vc::sin(x); });
+    bench("cos", -8192, 8192, [](V x) { return Vc::cos(x); });
+    bench("tan", -8192, 8192, [](V x) { return Vc::tan(x); });
+    bench("sincos", -8192, 8192, [](V x) {
+        V sin, cos;
+        Vc::sincos(x, &sin, &cos);
+        return sin + cos;
+    });
+    bench("asin", -1, 1, [](V x) { return Vc::asin(x); });
+    bench("atan", -100, 100, [](V x) { return Vc::atan(x); });
+    bench("atan2", -100, 100, [&](V x) { return Vc::atan2(y, x); });
+    bench("exp", -80, 80, [](V x) { return Vc::exp(x); });
+    bench("exp2", -100, 100, [](V x) { return Vc::exp2(x); });
+    bench("exp10", -30, 30, [](V x) { return Vc::exp10(x); });
+    bench("expm1", -10, 10, [](V x) { return Vc::expm1(x); });
+    bench("log", 1e-3, 1e6, [](V x) { return Vc::log(x); });
+    bench("log2", 1e-3, 1e6, [](V x) { return Vc::log2(x); });
+    bench("log10", 1e-3, 1e6, [](V x) { return Vc::log10(x); });
+    bench("log1p", 0, 1e3, [](V x) { return Vc::log1p(x); });
+    bench("pow", 0.1, 100, [&](V x) { return Vc::pow(x, y); });
+    bench("cbrt", -1e3, 1e3, [](V x) { return Vc::cbrt(x); });
+    bench("hypot", -1e3, 1e3, [&](V x) { return Vc::hypot(x, y); });
+    bench("sinh", -80, 80, [](V x) { return Vc::sinh(x); });
+    bench("cosh", -80, 80, [](V x) { return Vc::cosh(x); });
+    bench("tanh", -10, 10, [](V x) { return Vc::tanh(x); });
+    bench("erf", -4, 4, [](V x) { return Vc::erf(x); });
+    bench("erfc", -4, 9, [](V x) { return Vc::erfc(x); });
+    bench("fast::sin", -8192, 8192, [](V x) { return Vc::fast::sin(x); });
+    bench("fast::cos", -8192, 8192, [](V x) { return Vc::fast::cos(x); });
+    bench("fast::exp", -80, 80, [](V x) { return Vc::fast::exp(x); });
+    bench("fast::log", 1e-3, 1e6, [](V x) { return Vc::fast::log(x); });
+    bench("fast::atan2", -100, 100, [&](V x) { return Vc::fast::atan2(y, x); });
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("math", argc, argv);
+    math<Vc::float_v>(s);
+    math<Vc::double_v>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,83 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "benchmark.h"
+
+using namespace Benchmark;
+
+// SimdArray<T, N> is implemented either directly on a native vector (N equal to its
+// size), on two halves (N a power-of-two multiple), or on an uneven split (e.g. three
+// native vectors). Comparing the cycles per entry against the native vector shows the
+// cost of the splitting.
+
+template <typename V> void simdarray(Suite &s)  // {{{1
+{
+    using T = typename V::EntryType;
+    const V one = opaque(V(T(1)));
+    const V zero = opaque(V::Zero());
+    const V init = opaque(V(T(3)));
+    latencyAndThroughput(s, "add", init, [&](V x) { return x + one; });
+    latencyAndThroughput(s, "mul", init, [&](V x) { return x * one; });
+    latencyAndThroughput(s, "div", init, [&](V x) { return x / one; });
+    latencyAndThroughput(s, "fma", init, [&](V x) { return Vc::fma(x, one, zero); });
+    latencyAndThroughput(s, "sqrt", init, [](V x) { return Vc::sqrt(x); });
+    latencyAndThroughput(s, "compare_blend", init,
+                         [&](V x) { return Vc::iif(x < one, one, x); });
+    latencyAndThroughput(s, "sum", zero, [](V x) { return V(x.sum()); });
+    latencyAndThroughput(s, "min", init, [](V x) { return V(x.min()); });
+
+    Reseeded<V> bench(s);
+    bench("sin", -8192, 8192, [](V x) { return Vc::sin(x); });
+    bench("sincos", -8192, 8192, [](V x) {
+        V sin, cos;
+        Vc::sincos(x, &sin, &cos);
+        return sin + cos;
+    });
+    bench("exp", -80, 80, [](V x) { return Vc::exp(x); });
+    bench("log", 1e-3, 1e6, [](V x) { return Vc::log(x); });
+}
+
+template <typename T> void simdarrays(Suite &s)
+{
+    constexpr std::size_t N = Vc::Vector<T>::size();
+    simdarray<Vc::Vector<T>>(s);
+    simdarray<Vc::SimdArray<T, N>>(s);
+    simdarray<Vc::SimdArray<T, 2 * N>>(s);
+    simdarray<Vc::SimdArray<T, 3 * N>>(s);
+    simdarray<Vc::SimdArray<T, 4 * N>>(s);
+    simdarray<Vc::SimdArray<T, N + 1>>(s);
+}
+
+int Vc_CDECL main(int argc, char **argv)  // {{{1
+{
+    Suite s("simdarray", argc, argv);
+    simdarrays<float>(s);
+    simdarrays<double>(s);
+    return 0;
+}
+
+// vim: foldmethod=marker
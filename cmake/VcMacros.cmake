@@ -3,6 +3,8 @@
 # The following macros are provided:
 # vc_determine_compiler
 # vc_set_preferred_compiler_flags
+# vc_compile_for_all_implementations
+# vc_compile_for_dispatch
 #
 #=============================================================================
 # Copyright 2009-2015   Matthias Kretz <kretz@kde.org>
@@ -509,3 +511,22 @@ macro(vc_compile_for_all_implementations _srcs _src)
       message(WARNING "The following unknown targets where listed in the EXCLUDE list of vc_compile_for_all_implementations: '${_disabled_targets}'")
    endif()
 endmacro()
+
+# Generate compile rules for a kernel source file that registers Vc::DispatchedFunction versions
+# (see Vc/common/dispatch.h). The file is compiled for Scalar, SSE2, SSE4_2, AVX, and
+# AVX2+FMA+BMI2 unless an ONLY list is passed. All other arguments are forwarded to
+# vc_compile_for_all_implementations. Compile the rest of the target for the baseline target,
+# i.e. without Vc_ARCHITECTURE_FLAGS, so that it runs on every CPU of the fleet.
+# Example:
+#   vc_compile_for_dispatch(_srcs saxpy.cpp)
+#   add_executable(app main.cpp ${_srcs})
+#   target_link_libraries(app Vc)
+macro(vc_compile_for_dispatch _srcs _src)
+   set(_dispatch_args ${ARGN})
+   list(FIND _dispatch_args "ONLY" _only_index)
+   if(_only_index EQUAL -1)
+      vc_compile_for_all_implementations(${_srcs} ${_src} ${ARGN} ONLY Scalar SSE2 SSE4_2 AVX AVX2+FMA+BMI2)
+   else()
+      vc_compile_for_all_implementations(${_srcs} ${_src} ${ARGN})
+   endif()
+endmacro()
@@ -94,14 +94,164 @@ VECTOR_TYPE log2(const VECTOR_TYPE &v);
  */
 VECTOR_TYPE log10(const VECTOR_TYPE &v);
 
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the logarithm on.
+ * \returns the natural logarithm of \p v + 1, accurate also for \p v close to 0.
+ *
+ * \note The single-precision implementation has an error of max. 1.44 ulp (mean 0.28 ulp) in the range [-1, 100] (including denormals).
+ * \note The double-precision implementation has an error of max. 1.44 ulp (mean 0.26 ulp) in the range [-1, 100] (including denormals).
+ */
+VECTOR_TYPE log1p(const VECTOR_TYPE &v);
+
 /**
  * \ingroup Math
  *
  * \param v The values to apply the exponential function on.
  * \returns the exponential of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.27 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 1.1 ulp (mean 0.27 ulp) for normalized results.
+ * \note Denormal results are off by at most one denormal step.
  */
 VECTOR_TYPE exp(const VECTOR_TYPE &v);
 
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the base-2 exponential function on.
+ * \returns 2 raised to the power of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1 ulp (mean 0.27 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 1.1 ulp (mean 0.27 ulp) for normalized results.
+ * \note Denormal results are off by at most one denormal step.
+ */
+VECTOR_TYPE exp2(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the base-10 exponential function on.
+ * \returns 10 raised to the power of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.2 ulp (mean 0.27 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 1.4 ulp (mean 0.29 ulp) for normalized results.
+ * \note There is no exp10 in \c std. The Scalar implementation uses \c std::pow(10, v).
+ */
+VECTOR_TYPE exp10(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the function on.
+ * \returns \f$e^v - 1\f$, computed without the cancellation of <tt>exp(v) - 1</tt> for
+ * small \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.4 ulp (mean 0.26 ulp) in the range [-50, 88].
+ * \note The double-precision implementation has an error of max. 1.3 ulp (mean 0.27 ulp) in the range [-50, 709].
+ */
+VECTOR_TYPE expm1(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param x The bases.
+ * \param y The exponents.
+ * \returns \p x raised to the power of \p y, with the special values of C99 Annex F.9.4.4.
+ *
+ * The logarithm of \p x and its product with \p y are evaluated in double-double
+ * arithmetic. The single-precision implementation evaluates the double-precision
+ * implementation.
+ *
+ * \note The single-precision implementation has an error of max. 0.5 ulp (mean 0.25 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 1.2 ulp (mean 0.27 ulp) for normalized results.
+ * \note Integral exponents can use \c pow(v, int), which multiplies for |n| ≤ 2, or \c
+ * pow<N>(v), which multiplies for every compile-time constant exponent.
+ */
+VECTOR_TYPE pow(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the cube root on.
+ * \returns the cube root of \p v.
+ *
+ * \note The single-precision implementation has an error of max. 0.73 ulp (mean 0.26 ulp) (including denormals).
+ * \note The double-precision implementation has an error of max. 0.73 ulp (mean 0.26 ulp) (including denormals).
+ */
+VECTOR_TYPE cbrt(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param x \VSize{T} values.
+ * \param y \VSize{T} values.
+ * \returns \f$\sqrt{x^2 + y^2}\f$ without overflow or underflow in the intermediate
+ * squares.
+ *
+ * \note The single-precision implementation has an error of max. 0.5 ulp (mean 0.25 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 0.5 ulp (mean 0.25 ulp) for normalized results.
+ */
+VECTOR_TYPE hypot(const VECTOR_TYPE &x, const VECTOR_TYPE &y);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the hyperbolic sine on.
+ * \returns the hyperbolic sine of all values in \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.56 ulp (mean 0.28 ulp).
+ * \note The double-precision implementation has an error of max. 1.55 ulp (mean 0.27 ulp).
+ */
+VECTOR_TYPE sinh(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the hyperbolic cosine on.
+ * \returns the hyperbolic cosine of all values in \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.46 ulp (mean 0.28 ulp).
+ * \note The double-precision implementation has an error of max. 1.37 ulp (mean 0.27 ulp).
+ */
+VECTOR_TYPE cosh(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The values to apply the hyperbolic tangent on.
+ * \returns the hyperbolic tangent of all values in \p v.
+ *
+ * \note The single-precision implementation has an error of max. 1.32 ulp (mean 0.27 ulp).
+ * \note The double-precision implementation has an error of max. 1.33 ulp (mean 0.27 ulp).
+ */
+VECTOR_TYPE tanh(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The input values.
+ * \returns the error function \f$\frac{2}{\sqrt{\pi}}\int_0^v e^{-t^2}dt\f$ of all
+ * values in \p v.
+ *
+ * \note The single-precision implementation has an error of max. 0.92 ulp (mean 0.17 ulp).
+ * \note The double-precision implementation has an error of max. 0.99 ulp (mean 0.25 ulp).
+ */
+VECTOR_TYPE erf(const VECTOR_TYPE &v);
+
+/**
+ * \ingroup Math
+ *
+ * \param v The input values.
+ * \returns the complementary error function 1 - erf(\p v), without the cancellation
+ * for large \p v.
+ *
+ * \note The single-precision implementation has an error of max. 2.4 ulp (mean 0.29 ulp) for normalized results.
+ * \note The double-precision implementation has an error of max. 2.3 ulp (mean 0.34 ulp) for normalized results.
+ */
+VECTOR_TYPE erfc(const VECTOR_TYPE &v);
+
 /**
  * \ingroup Math
  *
@@ -0,0 +1,69 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+#include "saxpy.h"
+
+static const char *implementationName(unsigned int features)
+{
+    switch (features & Vc::ImplementationMask) {
+    case Vc::ScalarImpl: return "Scalar";
+    case Vc::SSE2Impl: return "SSE2";
+    case Vc::SSE3Impl: return "SSE3";
+    case Vc::SSSE3Impl: return "SSSE3";
+    case Vc::SSE41Impl: return "SSE4.1";
+    case Vc::SSE42Impl: return "SSE4.2";
+    case Vc::AVXImpl: return "AVX";
+    case Vc::AVX2Impl: return "AVX2";
+    default: return "unknown";
+    }
+}
+
+int Vc_CDECL main()
+{
+    const std::size_t n = 1003;
+    std::vector<float> x(n), y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        x[i] = float(i);
+        y[i] = 1.f;
+    }
+
+    saxpy(2.f, x.data(), y.data(), n);
+
+    std::cout << "saxpy uses the " << implementationName(saxpy.implementation())
+              << " version\n";
+    for (std::size_t i = 0; i < n; ++i) {
+        if (y[i] != 2.f * float(i) + 1.f) {
+            std::cout << "wrong result at " << i << ": " << y[i] << '\n';
+            return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
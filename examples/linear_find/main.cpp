@@ -27,6 +27,7 @@
 #include <vector>
 #include <algorithm>
 #include "../tsc.h"
+#include "../perfcounters.h"
 
 using Vc::float_v;
 typedef Vc::SimdArray<double, float_v::size()> double_v;
@@ -106,43 +107,6 @@ inline Iterator lower_bound(Iterator first, Iterator last,
 #endif
     return first;
 }
-
-template <class Iterator, class T>
-inline Iterator find(Iterator first, Iterator last, const T &value)
-{
-    typename simdize<Iterator>::value_type value_v = value;
-    for (simdize<Iterator> it = first; it < last; ++it) {
-        const auto mask = *it == value_v;
-        if (any_of(mask)) {
-            return static_cast<Iterator>(it) + mask.firstOne();
-        }
-    }
-    return last;
-}
-
-template <class Iterator, class V>
-inline std::array<Iterator, V::size()> find_parallel(Iterator first, Iterator last,
-                                                     const V &value)
-{
-    std::array<Iterator, V::size()> matches;
-    for (auto &x : matches) {
-        x = last;
-    }
-    typename V::mask_type found(false);
-    for (; first < last; ++first) {
-        const auto mask = *first == value && !found;
-        if (any_of(mask)) {
-            found |= mask;
-            for (std::size_t i : where(mask)) {
-                matches[i] = first;
-            }
-            if (all_of(found)) {
-                break;
-            }
-        }
-    }
-    return matches;
-}
 }  // namespace Vc
 
 template <typename _InputIterator, typename _Tp>
@@ -199,6 +163,7 @@ int Vc_CDECL main()
 
         double mean[3] = {};
         double stddev[3] = {};
+        PerfCounters perf[3];
         do {
             for (int i : {std, vec, par}) {
                 mean[i] = 0;
@@ -207,6 +172,7 @@ int Vc_CDECL main()
             TimeStampCounter tsc;
 
             // search (std)
+            perf[std].start();
             for (auto n = Repetitions; n; --n) {
                 tsc.start();
                 for (std::size_t i = 0; i < search_values.size(); ++i) {
@@ -218,27 +184,31 @@ int Vc_CDECL main()
                 mean[std] += x;
                 stddev[std] += x * x;
             }
+            perf[std].stop();
 
             // search (vec)
+            perf[vec].start();
             for (auto n = Repetitions; n; --n) {
                 tsc.start();
                 for (std::size_t i = 0; i < search_values.size(); ++i) {
                     iterators[vec][i] =
-                        Vc::find(data.begin(), data.begin() + N, search_values[i]);
+                        Vc::simd_find(data.begin(), data.begin() + N, search_values[i]);
                 }
                 tsc.stop();
                 double x = tsc.cycles();
                 mean[vec] += x;
                 stddev[vec] += x * x;
             }
+            perf[vec].stop();
 
             // seach (par)
+            perf[par].start();
             for (auto n = Repetitions; n; --n) {
                 tsc.start();
                 for (std::size_t i = 0; i < search_values.size();) {
                     for (const auto &it :
-                         Vc::find_parallel(data.begin(), data.begin() + N,
-                                           float_v(&search_values[i]))) {
+                         Vc::simd_find_parallel(data.begin(), data.begin() + N,
+                                                float_v(&search_values[i]))) {
                         iterators[par][i++] = it;
                     }
                 }
@@ -247,6 +217,7 @@ int Vc_CDECL main()
                 mean[par] += x;
                 stddev[par] += x * x;
             }
+            perf[par].stop();
 
             // search (bin)
             /*for (auto n = Repetitions; n; --n) {
@@ -290,6 +261,15 @@ int Vc_CDECL main()
                                  stddev[std] * stddev[std] / (mean[std] * mean[std]) +
                                  stddev[par] * stddev[par] / (mean[par] * mean[par]));
             std::cout << std::endl;
+            if (perf[std].available()) {
+                const char *names[3] = {"std", "Vc", "par"};
+                for (int i : {std, vec, par}) {
+                    std::cout << std::setw(15) << names[i] << ": ";
+                    perf[i].report(std::cout, double(Repetitions) * search_values.size(),
+                                   "search");
+                    std::cout << '\n';
+                }
+            }
         } while (stddev[std] * 20 > mean[std] || stddev[vec] * 20 > mean[vec] ||
                  stddev[par] * 20 > mean[par]);
     }
@@ -27,6 +27,7 @@
 #include <iomanip>
 #include <valarray>
 #include "../tsc.h"
+#include "../perfcounters.h"
 
 static constexpr int UnrollOuterloop = 4;
 
@@ -249,11 +250,12 @@ template <typename T> void unused(T &&x) { x = x; }
 template <typename T> void unused(T &&x) { asm("" ::"m"(x)); }
 #endif
 
-template <size_t N, typename F> Vc_ALWAYS_INLINE void benchmark(F &&f)
+template <size_t N, typename F> Vc_ALWAYS_INLINE void benchmark(PerfCounters &perf, F &&f)
 {
     TimeStampCounter tsc;
     auto cycles = tsc.cycles();
     cycles = 0x7fffffff;
+    perf.start();
     for (int i = 0; i < 100; ++i) {
         tsc.start();
         for (int j = 0; j < 10; ++j) {
@@ -263,6 +265,7 @@ template <size_t N, typename F> Vc_ALWAYS_INLINE void benchmark(F &&f)
         tsc.stop();
         cycles = std::min(cycles, tsc.cycles());
     }
+    perf.stop();
     //std::cout << cycles << " Cycles for " << N *N *(N + N - 1) << " FLOP => ";
     std::cout << std::setw(19) << std::setprecision(3)
               << double(N * N * (N + N - 1) * 10) / cycles;
@@ -283,6 +286,7 @@ template <size_t N> void run()
             BV[i][j] = 0.01 * (N + i - j);
         }
     }
+    PerfCounters perf[4];
     std::cout << std::setw(2) << N;
 #if defined Vc_MSVC
     auto &&fakeModify = [](Matrix<float, N> &a, Matrix<float, N> &b) {
@@ -298,23 +302,32 @@ template <size_t N> void run()
 #endif
     };
 #endif
-    benchmark<N>([&] {
+    benchmark<N>(perf[0], [&] {
         fakeModify(A, B);
         return scalar_mul(A, B);
     });
-    benchmark<N>([&] {
+    benchmark<N>(perf[1], [&] {
         fakeModify(A, B);
         return scalar_mul_blocked(A, B);
     });
-    benchmark<N>([&] {
+    benchmark<N>(perf[2], [&] {
         fakeModify(A, B);
         return A * B;
     });
-    benchmark<N>([&] {
+    benchmark<N>(perf[3], [&] {
         fakeModify(A, B);
         return AV * BV;
     });
     std::cout << std::endl;
+    // the hardware counters average over all 1000 multiplications
+    if (perf[0].available()) {
+        const char *names[4] = {"scalar", "scalar & blocked", "Vector<T>", "valarray"};
+        for (int i = 0; i < 4; ++i) {
+            std::cout << std::setw(19) << names[i] << ": ";
+            perf[i].report(std::cout, 1000. * N * N * (N + N - 1), "FLOP");
+            std::cout << '\n';
+        }
+    }
 }
 
 int Vc_CDECL main()
@@ -0,0 +1,268 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#ifndef VC_PERFCOUNTERS_H_
+#define VC_PERFCOUNTERS_H_
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+
+/*
+ * PerfCounters reads hardware performance counters of the calling thread via Linux
+ * perf_event_open, complementing the reference cycles of TimeStampCounter:
+ *
+ *   PerfCounters perf;
+ *   perf.start();
+ *   // benchmarked code processing n elements
+ *   perf.stop();
+ *   perf.report(std::cout, n, "element");  // prints e.g. "3.1 cycles, 7.9 instructions
+ *                                           // (IPC 2.55), ... per element"
+ *
+ * The events are opened disabled, as one group: they only count between start() and
+ * stop(), and always all at the same time, so that ratios such as the IPC relate counts
+ * of the same interval. Events the CPU (or a virtual machine, or
+ * /proc/sys/kernel/perf_event_paranoid) does not support, or that do not fit into the
+ * group, are simply unavailable. If the kernel multiplexes the group with other events,
+ * the counts are extrapolated to the time the region ran. Only user space is counted.
+ * Other operating systems have no counters.
+ */
+class PerfCounters
+{
+public:
+    enum Event {
+        CoreCycles,    // unhalted core cycles, i.e. independent of the clock frequency
+        RefCycles,     // unhalted reference cycles
+        Instructions,  // instructions retired
+        L1DMisses,     // L1 data cache read misses
+        LLCMisses,     // last level cache misses
+        BranchMisses,  // mispredicted branches retired
+        EventCount
+    };
+
+    PerfCounters();
+    ~PerfCounters();
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    // resets the counters and starts counting
+    void start();
+    // stops counting
+    void stop();
+
+    // returns whether at least one event can be counted
+    bool available() const;
+    bool available(Event e) const { return m_fd[e] >= 0; }
+
+    // returns the count of \p e between start() and stop(), 0 if unavailable
+    double operator[](Event e) const;
+
+    static const char *name(Event e);
+
+    // prints the available counts divided by \p elements
+    void report(std::ostream &out, double elements, const char *unit = "element") const;
+
+private:
+    struct Reading {
+        unsigned long long enabled, running;
+        unsigned long long value[EventCount];
+    };
+    void read(Reading &r) const;
+
+    int m_leader;              // the fd of the group leader, -1 if no event is available
+    int m_fd[EventCount];
+    int m_index[EventCount];   // the position of the event in the group
+    Reading m_start;
+    Reading m_end;
+};
+
+inline PerfCounters::PerfCounters() : m_leader(-1)
+{
+    std::memset(&m_start, 0, sizeof(m_start));
+    std::memset(&m_end, 0, sizeof(m_end));
+    for (int e = 0; e < EventCount; ++e) {
+        m_fd[e] = -1;
+        m_index[e] = -1;
+    }
+#ifdef __linux__
+    auto &&cache = [](unsigned long long id) {
+        return id | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+               (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+    };
+    const struct {
+        unsigned type;
+        unsigned long long config;
+    } events[EventCount] = {
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_REF_CPU_CYCLES},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+        {PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_L1D)},
+        {PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_LL)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    };
+    int members = 0;
+    for (int e = 0; e < EventCount; ++e) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = events[e].type;
+        attr.config = events[e].config;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                           PERF_FORMAT_TOTAL_TIME_RUNNING;
+        // the first event that opens becomes the group leader; it is enabled and
+        // disabled for the whole group, the other members follow it
+        attr.disabled = m_leader < 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        m_fd[e] =
+            static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, m_leader, 0));
+        if (m_fd[e] >= 0) {
+            if (m_leader < 0) {
+                m_leader = m_fd[e];
+            }
+            m_index[e] = members++;
+        }
+    }
+#endif
+}
+
+inline PerfCounters::~PerfCounters()
+{
+#ifdef __linux__
+    for (int fd : m_fd) {
+        if (fd >= 0 && fd != m_leader) {
+            close(fd);
+        }
+    }
+    if (m_leader >= 0) {
+        close(m_leader);
+    }
+#endif
+}
+
+inline void PerfCounters::read(Reading &r) const
+{
+    std::memset(&r, 0, sizeof(r));
+#ifdef __linux__
+    // PERF_FORMAT_GROUP: nr, time_enabled, time_running, value[nr]
+    unsigned long long buffer[3 + EventCount];
+    if (m_leader < 0 || ::read(m_leader, buffer, sizeof(buffer)) < 3 * 8) {
+        return;
+    }
+    r.enabled = buffer[1];
+    r.running = buffer[2];
+    for (int e = 0; e < EventCount; ++e) {
+        if (m_index[e] >= 0 && static_cast<unsigned long long>(m_index[e]) < buffer[0]) {
+            r.value[e] = buffer[3 + m_index[e]];
+        }
+    }
+#endif
+}
+
+inline void PerfCounters::start()
+{
+#ifdef __linux__
+    if (m_leader >= 0) {
+        ioctl(m_leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        // the reset does not clear the enabled and running times
+        read(m_start);
+        ioctl(m_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+}
+
+inline void PerfCounters::stop()
+{
+#ifdef __linux__
+    if (m_leader >= 0) {
+        ioctl(m_leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        read(m_end);
+    }
+#endif
+}
+
+inline bool PerfCounters::available() const
+{
+    for (int fd : m_fd) {
+        if (fd >= 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+inline double PerfCounters::operator[](Event e) const
+{
+    const double value = m_end.value[e] - m_start.value[e];
+    const double enabled = m_end.enabled - m_start.enabled;
+    const double running = m_end.running - m_start.running;
+    if (running <= 0) {
+        return 0;
+    }
+    return running < enabled ? value * enabled / running : value;
+}
+
+inline const char *PerfCounters::name(Event e)
+{
+    static const char *const names[EventCount] = {
+        "cycles", "ref-cycles", "instructions", "L1D misses", "LLC misses", "branch misses"};
+    return names[e];
+}
+
+inline void PerfCounters::report(std::ostream &out, double elements, const char *unit) const
+{
+    const char *separator = "";
+    const auto flags = out.flags();
+    const auto precision = out.precision(3);
+    for (int i = 0; i < EventCount; ++i) {
+        const Event e = static_cast<Event>(i);
+        if (!available(e)) {
+            continue;
+        }
+        out << separator << (*this)[e] / elements << ' ' << name(e);
+        if (e == Instructions && available(CoreCycles) && (*this)[CoreCycles] > 0) {
+            out << " (IPC " << (*this)[Instructions] / (*this)[CoreCycles] << ')';
+        }
+        separator = ", ";
+    }
+    if (*separator) {
+        out << " per " << unit;
+    }
+    out.precision(precision);
+    out.flags(flags);
+}
+
+#endif  // VC_PERFCOUNTERS_H_
+
+// vim: foldmethod=marker
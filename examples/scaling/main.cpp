@@ -26,6 +26,7 @@
 
 #include <Vc/Vc>
 #include "../tsc.h"
+#include "../perfcounters.h"
 
 using Vc::float_v;
 
@@ -132,7 +133,9 @@ struct ScaleWorkingSetSize
         }
 
         TimeStampCounter tsc;
+        PerfCounters perf;
         double throughput = 0.;
+        perf.start();
         for (std::size_t i = 0; i < 2 + 512 / N; ++i) {
             tsc.start();
             // ------------- start of the benchmarked code ---------------
@@ -150,10 +153,17 @@ struct ScaleWorkingSetSize
 
             throughput = std::max(throughput, (Repetitions * M * N * float_v::Size * FLOPs) / static_cast<double>(tsc.cycles()));
         }
+        perf.stop();
 
         const long bytes = N * M * sizeof(float_v);
         printf("%10lu Byte | %4.2f FLOP/Byte | %4.1f FLOP/cycle\n", bytes, static_cast<double>(float_v::Size * FLOPs) / (4 * sizeof(float_v)), throughput
                 );
+        if (perf.available()) {
+            std::fflush(stdout);
+            std::cout << "                  ";
+            perf.report(std::cout, double(2 + 512 / N) * Repetitions * M * N, "float_v");
+            std::cout << std::endl;
+        }
     }
 };
 
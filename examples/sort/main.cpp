@@ -0,0 +1,121 @@
+/*{{{
+    Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+    Permission to use, copy, modify, and distribute this software
+    and its documentation for any purpose and without fee is hereby
+    granted, provided that the above copyright notice appear in all
+    copies and that both that the copyright notice and this
+    permission notice and warranty disclaimer appear in supporting
+    documentation, and that the name of the author not be used in
+    advertising or publicity pertaining to distribution of the
+    software without specific, written prior permission.
+
+    The author disclaim all warranties with regard to this
+    software, including all implied warranties of merchantability
+    and fitness.  In no event shall the author be liable for any
+    special, indirect or consequential damages or any damages
+    whatsoever resulting from loss of use, data or profits, whether
+    in an action of contract, negligence or other tortious action,
+    arising out of or in connection with the use or performance of
+    this software.
+
+}}}*/
+
+#include <Vc/Vc>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "../tsc.h"
+
+template <typename T> struct Distribution {
+    typedef typename std::conditional<std::is_floating_point<T>::value,
+                                      std::uniform_real_distribution<T>,
+                                      std::uniform_int_distribution<T>>::type type;
+    static type make()
+    {
+        return type(std::numeric_limits<T>::lowest() / 2, std::numeric_limits<T>::max() / 2);
+    }
+};
+template <> struct Distribution<short> {
+    typedef std::uniform_int_distribution<int> type;
+    static type make() { return type(-30000, 30000); }
+};
+template <> struct Distribution<Vc::ushort> {
+    typedef std::uniform_int_distribution<unsigned> type;
+    static type make() { return type(0, 60000); }
+};
+
+template <typename T> void benchmark(const char *name)
+{
+    std::cout << "\n" << name << " (" << Vc::Vector<T>::Size << " entries per vector)\n";
+    std::cout << std::setw(15) << "N";
+    std::cout << std::setw(15) << "std" << std::setw(15) << "stddev";
+    std::cout << std::setw(15) << "Vc" << std::setw(15) << "stddev";
+    std::cout << std::setw(15) << "std/Vc" << '\n';
+
+    std::default_random_engine rne;
+    auto dist = Distribution<T>::make();
+
+    for (std::size_t N = 64; N <= 1024 * 1024; N *= 4) {
+        const std::size_t Repetitions = 5 + 1024 * 256 / N;
+
+        std::vector<T> input(N);
+        for (auto &x : input) {
+            x = T(dist(rne));
+        }
+        std::vector<T> data[2];
+
+        enum { std, vec };
+        double mean[2] = {};
+        double stddev[2] = {};
+        TimeStampCounter tsc;
+        for (auto n = Repetitions; n; --n) {
+            data[std] = input;
+            tsc.start();
+            std::sort(data[std].begin(), data[std].end());
+            tsc.stop();
+            double x = tsc.cycles();
+            mean[std] += x;
+            stddev[std] += x * x;
+
+            data[vec] = input;
+            tsc.start();
+            Vc::simd_sort(data[vec].begin(), data[vec].end());
+            tsc.stop();
+            x = tsc.cycles();
+            mean[vec] += x;
+            stddev[vec] += x * x;
+
+            // test that the results are equal
+            assert(data[std] == data[vec]);
+        }
+
+        // output results (cycles per element)
+        std::cout << std::setw(15) << N;
+        for (int i : {std, vec}) {
+            mean[i] /= Repetitions;
+            stddev[i] /= Repetitions;
+            stddev[i] = std::sqrt(std::max(0., stddev[i] - mean[i] * mean[i]));
+
+            std::cout << std::setw(15) << mean[i] / N;
+            std::cout << std::setw(15) << stddev[i] / N;
+        }
+        std::cout << std::setw(15) << std::setprecision(4) << mean[std] / mean[vec]
+                  << std::endl;
+    }
+}
+
+int Vc_CDECL main()
+{
+    benchmark<float>("float");
+    benchmark<double>("double");
+    benchmark<int>("int");
+    benchmark<Vc::uint>("uint");
+    benchmark<short>("short");
+    benchmark<Vc::ushort>("ushort");
+    return 0;
+}
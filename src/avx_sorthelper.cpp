@@ -306,6 +306,30 @@ Vc_CONST AVX2::uint_v sorted<CurrentImplementation::current()>(AVX2::uint_v x_)
 
     return concat(_mm_unpacklo_epi32(l, h), _mm_unpackhi_epi32(l, h));
 }
+
+template <typename T> static Vc_INTRINSIC AVX2::Vector<T> sortedBytes(AVX2::Vector<T> x)
+{
+    constexpr auto Impl = CurrentImplementation::current();
+    const AVX2::short_v a = sorted<Impl>(simd_cast<AVX2::short_v, 0>(x));
+    const __m256i reverseShorts = _mm256_setr_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5,
+                                                   2, 3, 0, 1, 14, 15, 12, 13, 10, 11, 8,
+                                                   9, 6, 7, 4, 5, 2, 3, 0, 1);
+    const AVX2::short_v b = Mem::permute128<X1, X0>(_mm256_shuffle_epi8(
+        sorted<Impl>(simd_cast<AVX2::short_v, 1>(x)).data(), reverseShorts));
+    const AVX2::short_v lo = sorted<Impl>(AVX2::short_v(_mm256_min_epi16(a.data(), b.data())));
+    const AVX2::short_v hi = sorted<Impl>(AVX2::short_v(_mm256_max_epi16(a.data(), b.data())));
+    return simd_cast<AVX2::Vector<T>>(lo, hi);
+}
+
+template <> Vc_CONST AVX2::schar_v sorted<CurrentImplementation::current()>(AVX2::schar_v x)
+{
+    return sortedBytes(x);
+}
+
+template <> Vc_CONST AVX2::uchar_v sorted<CurrentImplementation::current()>(AVX2::uchar_v x)
+{
+    return sortedBytes(x);
+}
 #endif  // AVX2
 
 template <>
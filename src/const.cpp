@@ -29,11 +29,14 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Vc/sse/const_data.h>
 #include <Vc/version.h>
 
+#include <atomic>
+#include <cstdint>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 
 #include <Vc/common/const.h>
+#include <Vc/common/indexsequence.h>
 #include <Vc/common/macros.h>
 
 namespace Vc_VERSIONED_NAMESPACE
@@ -236,13 +239,40 @@ namespace Vc_VERSIONED_NAMESPACE
 {
 namespace Common
 {
-    alignas(64) unsigned int RandomState[16] = {
+    namespace
+    {
+    const unsigned int InitialRandomState[16] = {
         0x5a383a4fu, 0xc68bd45eu, 0x691d6d86u, 0xb367e14fu,
         0xd689dbaau, 0xfde442aau, 0x3d265423u, 0x1a77885cu,
         0x36ed2684u, 0xfb1f049du, 0x19e52f31u, 0x821e4dd7u,
         0x23996d25u, 0x5962725au, 0x6aced4ceu, 0xd4c610f3u
     };
 
+    // The first thread to call V::Random() keeps the historical initial state. Every
+    // further thread mixes its index into it via SplitMix64, so that no two threads
+    // produce the same sequence.
+    unsigned int initialRandomState(int i)
+    {
+        static std::atomic<std::uint64_t> threadCount(0);
+        static thread_local const std::uint64_t threadIndex = threadCount++;
+        if (threadIndex == 0) {
+            return InitialRandomState[i];
+        }
+        // one SplitMix64 step, as in Detail::splitmix64 (Vc/common/random.h)
+        std::uint64_t z = ((threadIndex << 4) | std::uint64_t(i)) + 0x9e3779b97f4a7c15ull;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return InitialRandomState[i] ^ static_cast<unsigned int>((z ^ (z >> 31)) >> 32);
+    }
+    }  // unnamed namespace
+
+    alignas(64) thread_local unsigned int RandomState[16] = {
+        initialRandomState( 0), initialRandomState( 1), initialRandomState( 2), initialRandomState( 3),
+        initialRandomState( 4), initialRandomState( 5), initialRandomState( 6), initialRandomState( 7),
+        initialRandomState( 8), initialRandomState( 9), initialRandomState(10), initialRandomState(11),
+        initialRandomState(12), initialRandomState(13), initialRandomState(14), initialRandomState(15)
+    };
+
     alignas(32) const unsigned int AllBitsSet[8] = {
         0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU, 0xffffffffU
     };
@@ -488,3 +518,93 @@ namespace SSE
     };
 }
 }
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Detail
+{
+namespace
+{
+// compress / expand tables {{{
+constexpr int popcount(unsigned k) { return k == 0 ? 0 : int(k & 1) + popcount(k >> 1); }
+
+// the index of the n-th set bit in k or -1
+constexpr int nth_set_bit(unsigned k, int n, int pos = 0)
+{
+    return k == 0 ? -1 : (k & 1) ? (n == 0 ? pos : nth_set_bit(k >> 1, n - 1, pos + 1))
+                                 : nth_set_bit(k >> 1, n, pos + 1);
+}
+
+// the entry that moves to entry i or -1 if entry i is zeroed
+constexpr int compress_source(unsigned k, int i) { return nth_set_bit(k, i); }
+constexpr int expand_source(unsigned k, int i)
+{
+    return (k >> i) & 1 ? popcount(k & ((1u << i) - 1)) : -1;
+}
+constexpr int source(bool compress, unsigned k, int i)
+{
+    return compress ? compress_source(k, i) : expand_source(k, i);
+}
+
+// byte b of the pshufb control for entries of EntrySize bytes
+template <int EntrySize, bool Compress>
+constexpr unsigned char pshufb_control(unsigned k, int b)
+{
+    return source(Compress, k, b / EntrySize) < 0
+               ? 0x80
+               : source(Compress, k, b / EntrySize) * EntrySize + b % EntrySize;
+}
+
+template <int EntrySize, bool Compress, std::size_t... I>
+constexpr SSE::ShuffleTable<sizeof...(I) / 16> pshufb_table(index_sequence<I...>)
+{
+    return {{pshufb_control<EntrySize, Compress>(I / 16, I % 16)...}};
+}
+
+// nibble for 32-bit lane i of the vpermd index for entries of EntrySize bytes
+template <int EntrySize, bool Compress> constexpr unsigned vpermd_nibble(unsigned k, int i)
+{
+    return source(Compress, k, i / (EntrySize / 4)) < 0
+               ? 8u
+               : unsigned(source(Compress, k, i / (EntrySize / 4)) * (EntrySize / 4) +
+                          i % (EntrySize / 4));
+}
+
+template <int EntrySize, bool Compress>
+constexpr unsigned vpermd_nibbles(unsigned k, int i = 0)
+{
+    return i == 8 ? 0u : (vpermd_nibble<EntrySize, Compress>(k, i) << (4 * i)) |
+                             vpermd_nibbles<EntrySize, Compress>(k, i + 1);
+}
+
+template <int EntrySize, bool Compress, std::size_t... I>
+constexpr AVX::PermuteTable<sizeof...(I)> vpermd_table(index_sequence<I...>)
+{
+    return {{vpermd_nibbles<EntrySize, Compress>(I)...}};
+}
+// }}}
+}  // unnamed namespace
+}  // namespace Detail
+
+namespace SSE
+{
+    using Detail::pshufb_table;
+    const ShuffleTable<4> c_compress::compress64 = pshufb_table<8, true>(make_index_sequence<4 * 16>());
+    const ShuffleTable<16> c_compress::compress32 = pshufb_table<4, true>(make_index_sequence<16 * 16>());
+    const ShuffleTable<256> c_compress::compress16 = pshufb_table<2, true>(make_index_sequence<256 * 16>());
+    const ShuffleTable<4> c_compress::expand64 = pshufb_table<8, false>(make_index_sequence<4 * 16>());
+    const ShuffleTable<16> c_compress::expand32 = pshufb_table<4, false>(make_index_sequence<16 * 16>());
+    const ShuffleTable<256> c_compress::expand16 = pshufb_table<2, false>(make_index_sequence<256 * 16>());
+}  // namespace SSE
+
+namespace AVX
+{
+    using Detail::vpermd_table;
+    const PermuteTable<256> c_compress::compress32 = vpermd_table<4, true>(make_index_sequence<256>());
+    const PermuteTable<16> c_compress::compress64 = vpermd_table<8, true>(make_index_sequence<16>());
+    const PermuteTable<256> c_compress::expand32 = vpermd_table<4, false>(make_index_sequence<256>());
+    const PermuteTable<16> c_compress::expand64 = vpermd_table<8, false>(make_index_sequence<16>());
+}  // namespace AVX
+}  // namespace Vc
+
+// vim: foldmethod=marker
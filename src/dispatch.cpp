@@ -0,0 +1,94 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include <Vc/global.h>
+#include <Vc/support.h>
+#include <Vc/common/dispatch.h>
+
+#include <cstdio>
+#include <cstdlib>
+
+namespace Vc_VERSIONED_NAMESPACE
+{
+namespace Common
+{
+bool Vc_CDECL registerDispatchTarget(DispatchTable &table, void (*function)(),
+                                     unsigned int features)
+{
+    if (table.size == DispatchTable::Capacity) {
+        printf("Vc: too many implementations registered for one dispatched function. "
+               "Aborting.\n");
+        abort();
+    }
+    table.functions[table.size] = function;
+    table.features[table.size] = features;
+    ++table.size;
+    return true;
+}
+
+static int countBits(unsigned int x)
+{
+    int n = 0;
+    for (; x; x &= x - 1) {
+        ++n;
+    }
+    return n;
+}
+
+unsigned int Vc_CDECL selectDispatchTarget(const DispatchTable &table)
+{
+    const unsigned int extra = extraInstructionsSupported();
+    unsigned int best = table.size;
+    for (unsigned int i = 0; i < table.size; ++i) {
+        const unsigned int features = table.features[i];
+        const unsigned int impl = features & ImplementationMask;
+        if (!isImplementationSupported(static_cast<Implementation>(impl)) ||
+            (features & ExtraInstructionsMask & ~extra) != 0) {
+            continue;
+        }
+        if (best == table.size) {
+            best = i;
+            continue;
+        }
+        const unsigned int bestImpl = table.features[best] & ImplementationMask;
+        if (impl > bestImpl ||
+            (impl == bestImpl && countBits(features & ExtraInstructionsMask) >
+                                     countBits(table.features[best] & ExtraInstructionsMask))) {
+            best = i;
+        }
+    }
+    if (best == table.size) {
+        printf("Vc: no registered implementation of a dispatched function runs on this "
+               "CPU. Aborting.\n");
+        abort();
+    }
+    return best;
+}
+}  // namespace Common
+}  // namespace Vc
+
+// vim: foldmethod=marker
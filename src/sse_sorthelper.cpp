@@ -196,6 +196,29 @@ Vc_CONST SSE::float_v sorted<CurrentImplementation::current()>(SSE::float_v x_)
     // X         return SSE::blendv_ps(x, y, k);
 }
 
+// The 8-bit vectors are sorted as two short vectors. Merging the sorted halves with one
+// min/max step leaves all entries of lo less than or equal to all entries of hi.
+template <typename T> static Vc_INTRINSIC SSE::Vector<T> sortedBytes(SSE::Vector<T> x)
+{
+    using HT = SSE::VectorHelper<T>;
+    constexpr auto Impl = CurrentImplementation::current();
+    const SSE::short_v a = sorted<Impl>(SSE::short_v(HT::expand0(x.data())));
+    const SSE::short_v b = sorted<Impl>(SSE::short_v(HT::expand1(x.data()))).reversed();
+    const SSE::short_v lo = sorted<Impl>(Vc::min(a, b));
+    const SSE::short_v hi = sorted<Impl>(Vc::max(a, b));
+    return HT::concat(lo.data(), hi.data());
+}
+
+template <> Vc_CONST SSE::schar_v sorted<CurrentImplementation::current()>(SSE::schar_v x)
+{
+    return sortedBytes(x);
+}
+
+template <> Vc_CONST SSE::uchar_v sorted<CurrentImplementation::current()>(SSE::uchar_v x)
+{
+    return sortedBytes(x);
+}
+
 }  // namespace Detail
 }  // namespace Vc
 
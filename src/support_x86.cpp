@@ -113,6 +113,8 @@ Vc::Implementation bestImplementationSupported()
 Vc_TARGET_NO_SIMD
 unsigned int extraInstructionsSupported()
 {
+    CpuId::init();
+
     unsigned int flags = 0;
     if (CpuId::hasF16c()) flags |= Vc::Float16cInstructions;
     if (CpuId::hasFma4()) flags |= Vc::Fma4Instructions;
@@ -155,8 +155,10 @@ static Vc_ALWAYS_INLINE folded<float, Abi> foldInput(const Vector<float, Abi> &x
             Vc::Detail::doubleConstant<1, 0x45F306DC9C883, -1>();
         VD y = round(xd * _2_over_pi);
         r.quadrant = simd_cast<V>(simd_cast<IV>(y) & 3);  // = y mod 4
-        constexpr double pi_over_2 = Vc::Detail::doubleConstant<1, 0x921FB54442D18, 0>();
-        r.x = simd_cast<V>(xd - y * pi_over_2);
+        // x - y * pi/2, y uses no more than 20 mantissa bits; a single pi/2 constant
+        // would lose the low bits of x close to a multiple of pi/2, which matters for tan
+        r.x = simd_cast<V>(xd - y * Vc::Detail::doubleConstant<1, 0x921FB54400000, 0>() -
+                           y * Vc::Detail::doubleConstant<1, 0x0B4611A626331, -34>());
     }
     //std::cout << std::hexfloat << r.x << ' ' << r.quadrant << std::defaultfloat << '\n';
     return r;
@@ -397,6 +399,106 @@ void Trigonometric<Vc::Detail::TrigonometricImplementation<
     *c = cos_sign ^ iif(f.quadrant == 0 || f.quadrant == 2, cos_s, sin_s);
 }
 
+/*
+ * sincos for two vectors, as used for the two halves of a SimdArray: both range
+ * reductions and all four series are evaluated in one function body, which lets the
+ * compiler interleave the independent dependency chains instead of issuing two calls
+ * that each end in a long chain of multiply-adds.
+ */
+namespace
+{
+template <typename V>
+static Vc_ALWAYS_INLINE void sincosPair(const V &x0, const V &x1, V *s0, V *c0, V *s1,
+                                        V *c1)
+{
+    using T = typename V::EntryType;
+    const T sign = -0.;
+    const auto f0 = foldInput(x0);
+    const auto f1 = foldInput(x1);
+    const V sin_sign0 = (x0 ^ (1 - f0.quadrant)) & sign;
+    const V sin_sign1 = (x1 ^ (1 - f1.quadrant)) & sign;
+    const V cos_sign0 = ((T(0.5) - f0.quadrant) & (f0.quadrant - T(2.5))) & sign;
+    const V cos_sign1 = ((T(0.5) - f1.quadrant) & (f1.quadrant - T(2.5))) & sign;
+
+    const V sin_s0 = sinSeries(f0.x);
+    const V sin_s1 = sinSeries(f1.x);
+    const V cos_s0 = cosSeries(f0.x);
+    const V cos_s1 = cosSeries(f1.x);
+    const auto even0 = f0.quadrant == 0 || f0.quadrant == 2;
+    const auto even1 = f1.quadrant == 0 || f1.quadrant == 2;
+    *s0 = sin_sign0 ^ iif(even0, sin_s0, cos_s0);
+    *s1 = sin_sign1 ^ iif(even1, sin_s1, cos_s1);
+    *c0 = cos_sign0 ^ iif(even0, cos_s0, sin_s0);
+    *c1 = cos_sign1 ^ iif(even1, cos_s1, sin_s1);
+}
+}  // anonymous namespace
+
+template <>
+template <>
+void Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sincos(const Vc::double_v &x0,
+                                                   const Vc::double_v &x1,
+                                                   Vc::double_v *s0, Vc::double_v *c0,
+                                                   Vc::double_v *s1, Vc::double_v *c1)
+{
+    sincosPair(x0, x1, s0, c0, s1, c1);
+}
+
+template <>
+template <>
+void Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::sincos(const Vc::float_v &x0,
+                                                   const Vc::float_v &x1,
+                                                   Vc::float_v *s0, Vc::float_v *c0,
+                                                   Vc::float_v *s1, Vc::float_v *c1)
+{
+    if (Vc_IS_UNLIKELY(any_of(abs(x0) >= 393382) || any_of(abs(x1) >= 393382))) {
+        sincos(x0, s0, c0);
+        sincos(x1, s1, c1);
+        return;
+    }
+    sincosPair(x0, x1, s0, c0, s1, c1);
+}
+
+/*
+ * algorithm for tangent:
+ *
+ * Fold |x| into [-¼π, ¼π]. In quadrants 0 and 2 the result is sin / cos of the folded
+ * value, in quadrants 1 and 3 it is -cos / sin. The sign of x is applied last since the
+ * tangent is odd.
+ */
+template <>
+template <>
+Vc::double_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::tan(const Vc::double_v &x)
+{
+    using V = Vc::double_v;
+    const auto f = foldInput(x);
+    const V sin_s = sinSeries(f.x);
+    const V cos_s = cosSeries(f.x);
+    const auto odd = f.quadrant == 1 || f.quadrant == 3;
+    const V r = iif(odd, -cos_s, sin_s) / iif(odd, sin_s, cos_s);
+    return r ^ (x & signmask);
+}
+
+template <>
+template <>
+Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
+    Vc::CurrentImplementation::current()>>::tan(const Vc::float_v &x)
+{
+    using V = Vc::float_v;
+    if (Vc_IS_UNLIKELY(any_of(abs(x) >= 393382))) {
+        return simd_cast<V>(tan(simd_cast<Vc::double_v, 0>(x)),
+                            tan(simd_cast<Vc::double_v, 1>(x)));
+    }
+    const auto f = foldInput(x);
+    const V sin_s = sinSeries(f.x);
+    const V cos_s = cosSeries(f.x);
+    const auto odd = f.quadrant == 1 || f.quadrant == 3;
+    const V r = iif(odd, -cos_s, sin_s) / iif(odd, sin_s, cos_s);
+    return r ^ (x & signmaskf);
+}
+
 template <>
 template <>
 Vc::float_v Trigonometric<Vc::Detail::TrigonometricImplementation<
@@ -0,0 +1,303 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <Vc/Allocator>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using Vc::TransparentHugePages;
+using Vc::ExplicitHugePages;
+using Vc::NumaBind;
+using Vc::NumaInterleave;
+using Vc::ParallelFirstTouch;
+
+typedef vir::Typelist<Vc::AlignedAllocation<>, Vc::AlignedAllocation<Vc::AlignOnPage>,
+                 TransparentHugePages, ExplicitHugePages, NumaBind<0>,
+                 NumaBind<63, ExplicitHugePages>, NumaInterleave<>,
+                 ParallelFirstTouch<>, ParallelFirstTouch<NumaInterleave<>>>
+    AllPolicies;
+
+template <typename T> static bool isAligned(const T *p, std::size_t alignment)
+{
+    return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+TEST_TYPES(Policy, mallocAndFree, AllPolicies) //{{{1
+{
+    // small sizes use base pages, large sizes huge pages
+    for (std::size_t n : {1u, 1000u, 1u << 18, (1u << 18) + 17, 3u << 19}) {
+        int *p = Vc::malloc<int, Policy>(n);
+        VERIFY(isAligned(p, Vc::VectorAlignment)) << "n = " << n;
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = int(i);
+        }
+        for (std::size_t i = 0; i < n; i += 997) {
+            COMPARE(p[i], int(i)) << "n = " << n;
+        }
+        COMPARE(p[n - 1], int(n - 1)) << "n = " << n;
+        Vc::free<Policy>(p, n);
+    }
+
+    // like AlignedAllocation, every policy succeeds for 0 Bytes
+    int *p = Vc::malloc<int, Policy>(0);
+    VERIFY(p != nullptr);
+    Vc::free<Policy>(p, 0);
+    Vc::Allocator<float, Policy> alloc;
+    float *q = alloc.allocate(0);
+    VERIFY(q != nullptr);
+    alloc.deallocate(q, 0);
+}
+
+TEST(hugePageAlignment) //{{{1
+{
+    const std::size_t n = 5u << 19;  // 2.5 M floats = 10 MB
+    float *p = Vc::malloc<float, TransparentHugePages>(n);
+#ifdef __linux__
+    VERIFY(isAligned(p, 2u << 20));
+#else
+    VERIFY(isAligned(p, 4096));
+#endif
+    Vc::free<TransparentHugePages>(p, n);
+
+    p = Vc::malloc<float, ExplicitHugePages>(n);
+    VERIFY(isAligned(p, 4096));
+    Vc::free<ExplicitHugePages>(p, n);
+}
+
+TEST_TYPES(Policy, stdVector, AllPolicies) //{{{1
+{
+    typedef Vc::float_v V;
+    std::vector<V, Vc::Allocator<V, Policy>> v(1000, V(1));
+    VERIFY(isAligned(v.data(), alignof(V)));
+    for (int i = 0; i < 100000; ++i) {
+        v.push_back(V(float(i)));
+    }
+    COMPARE(v.size(), 101000u);
+    COMPARE(v[999], V(1));
+    COMPARE(v.back(), V(99999));
+
+    std::vector<V, Vc::Allocator<V, Policy>> copy(v);
+    COMPARE(copy[1000], V(0));
+    VERIFY(copy.get_allocator() == v.get_allocator());
+
+    // rebind to a different element type
+    typename Vc::Allocator<V, Policy>::template rebind<double>::other alloc(v.get_allocator());
+    double *d = alloc.allocate(3);
+    alloc.deallocate(d, 3);
+}
+
+TEST_TYPES(V, memory, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t n : {1u, 17u, 1u << 20}) {
+        Vc::Memory<V, 0, 0, true, ParallelFirstTouch<NumaInterleave<>>> m(n);
+        COMPARE(m.entriesCount(), n);
+        VERIFY(isAligned(m.entries(), alignof(V)));
+        for (std::size_t i = 0; i < m.vectorsCount(); ++i) {
+            m.vector(i) = V(T(1));
+        }
+        Vc::Memory<V, 0, 0, true, TransparentHugePages> m2(m);
+        COMPARE(m2.vectorsCount(), m.vectorsCount());
+        COMPARE(V(m2.vector(m2.vectorsCount() - 1)), V(T(1)));
+
+        Vc::Memory<V, 0, 0, true, TransparentHugePages> m3(n);
+        m3 = m;
+        m3.swap(m2);
+        COMPARE(V(m3.vector(0)), V(T(1)));
+    }
+    // the default policy keeps the type of dynamically sized Memory
+    static_assert(std::is_same<Vc::Memory<V>,
+                               Vc::Memory<V, 0, 0, true, Vc::AlignedAllocation<>>>::value,
+                  "");
+}
+
+TEST(firstTouch) //{{{1
+{
+    for (std::size_t n : {0u, 1u, 3u, 1000u, 1u << 22}) {
+        std::vector<int> data(n + 1, -1);
+        Vc::firstTouch(data.data(), n, 7);
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(data[i], 7) << "n = " << n << ", i = " << i;
+        }
+        COMPARE(data[n], -1);
+    }
+    const std::size_t n = 1u << 21;
+    double *p = Vc::malloc<double, TransparentHugePages>(n);
+    Vc::firstTouch(p, n);
+    COMPARE(p[0], 0.);
+    COMPARE(p[n - 1], 0.);
+    Vc::free<TransparentHugePages>(p, n);
+}
+
+TEST(parallelForStatic) //{{{1
+{
+    // first touch relies on thread s executing exactly block s, even if the other threads
+    // are slower than the calling thread and stealing would pay off
+    Vc::Common::ThreadPool pool(3);
+    COMPARE(pool.size(), 4u);
+    for (std::size_t count : {4u, 8u}) {
+        std::vector<std::thread::id> ids(count);
+        pool.parallel_for_static(count, [&](std::size_t i) {
+            if (i >= count / 4) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            }
+            ids[i] = std::this_thread::get_id();
+        });
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::size_t s = i * 4 / count;
+            COMPARE(ids[i] == ids[s * count / 4], true)
+                << "count = " << count << ", i = " << i;
+            COMPARE(ids[i] == std::this_thread::get_id(), s == 0)
+                << "count = " << count << ", i = " << i;
+            for (std::size_t j = 0; j < i; ++j) {
+                COMPARE(ids[i] == ids[j], s == j * 4 / count)
+                    << "count = " << count << ", i = " << i << ", j = " << j;
+            }
+        }
+    }
+}
+
+TEST(touchBlocks) //{{{1
+{
+    // blocks are cut at huge page boundaries for huge ranges and at page boundaries
+    // otherwise; the callback only receives addresses, so the range need not be mapped
+    using Vc::Common::Detail::HugePageSize;
+    const std::size_t page = Vc::Common::Detail::pageSize();
+    for (std::size_t bytes : {std::size_t(100), 3 * page + 5, HugePageSize / 2,
+                              7 * HugePageSize + 12345}) {
+        const std::uintptr_t begin = 3 * HugePageSize + 100;
+        const std::uintptr_t end = begin + bytes;
+        const std::size_t granularity = bytes >= HugePageSize / 2 ? HugePageSize : page;
+        std::mutex mutex;
+        std::vector<std::pair<std::uintptr_t, std::uintptr_t>> ranges;
+        Vc::Common::Detail::forEachTouchBlock(
+            begin, end, [&](std::uintptr_t lo, std::uintptr_t hi) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ranges.emplace_back(lo, hi);
+            });
+        std::sort(ranges.begin(), ranges.end());
+        VERIFY(!ranges.empty());
+        COMPARE(ranges.front().first, begin) << "bytes = " << bytes;
+        COMPARE(ranges.back().second, end) << "bytes = " << bytes;
+        for (std::size_t i = 1; i < ranges.size(); ++i) {
+            COMPARE(ranges[i].first, ranges[i - 1].second) << "bytes = " << bytes;
+            COMPARE(ranges[i].first % granularity, 0u) << "bytes = " << bytes;
+        }
+    }
+}
+
+TEST(arena) //{{{1
+{
+    Vc::AlignedArena arena(4096);
+    COMPARE(arena.capacity(), 0u);
+    char *a = static_cast<char *>(arena.allocate(3));
+    char *b = static_cast<char *>(arena.allocate(100));
+    VERIFY(isAligned(a, Vc::VectorAlignment));
+    VERIFY(isAligned(b, Vc::VectorAlignment));
+    VERIFY(b >= a + 3);
+    char *c = static_cast<char *>(arena.allocate(8, 64));
+    VERIFY(isAligned(c, 64));
+    COMPARE(arena.capacity(), 4096u);
+
+    // the most recent allocation is taken back
+    arena.deallocate(c, 8);
+    COMPARE(static_cast<char *>(arena.allocate(8, 64)), c);
+
+    // larger than a chunk and a chunk overflow
+    char *big = static_cast<char *>(arena.allocate(10000));
+    VERIFY(isAligned(big, 4096));
+    std::fill_n(big, 10000, 1);
+    COMPARE(arena.capacity(), 4096u + 10000u);
+    char *d = static_cast<char *>(arena.allocate(4000));
+    COMPARE(arena.capacity(), 2 * 4096u + 10000u);
+
+    // reset reuses all chunks
+    arena.reset();
+    COMPARE(static_cast<char *>(arena.allocate(3)), a);
+    COMPARE(static_cast<char *>(arena.allocate(4090)), big);
+    COMPARE(arena.capacity(), 2 * 4096u + 10000u);
+    // too large for the rest of the big chunk and for the next chunk
+    VERIFY(arena.allocate(6000) != nullptr);
+    COMPARE(arena.capacity(), 2 * 4096u + 16000u);
+    COMPARE(static_cast<char *>(arena.allocate(4000)), d);
+
+    arena.release();
+    COMPARE(arena.capacity(), 0u);
+}
+
+TEST_TYPES(V, arenaAllocator, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::AlignedArena arena;
+    {
+        std::vector<V, Vc::ArenaAllocator<V>> v(Vc::ArenaAllocator<V>{arena});
+        for (int i = 0; i < 1000; ++i) {
+            v.push_back(V(T(i % 100)));
+        }
+        VERIFY(isAligned(v.data(), alignof(V)));
+        COMPARE(v[999], V(T(99)));
+        std::vector<T, Vc::ArenaAllocator<T>> w(v.get_allocator());
+        VERIFY(w.get_allocator() == v.get_allocator());
+        VERIFY(w.get_allocator() != Vc::ArenaAllocator<T>());
+    }
+    const std::size_t capacity = arena.capacity();
+    for (int iteration = 0; iteration < 10; ++iteration) {
+        arena.reset();
+        std::vector<V, Vc::ArenaAllocator<V>> v(500, V(T(1)), arena);
+        COMPARE(v.back(), V(T(1)));
+        COMPARE(arena.capacity(), capacity);
+    }
+}
+
+TEST_TYPES(V, threadLocalArena, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::AlignedArena &arena = Vc::AlignedArena::local();
+    arena.reset();
+    for (int iteration = 0; iteration < 3; ++iteration) {
+        arena.reset();
+        Vc::Memory<V, 0, 0, true, Vc::ThreadLocalArena> a(1000);
+        Vc::Memory<V, 0, 0, true, Vc::ThreadLocalArena> b(a);
+        VERIFY(isAligned(a.entries(), alignof(V)));
+        VERIFY(isAligned(b.entries(), alignof(V)));
+        for (std::size_t i = 0; i < a.vectorsCount(); ++i) {
+            a.vector(i) = V(T(2));
+        }
+        b = a;
+        COMPARE(V(b.vector(b.vectorsCount() - 1)), V(T(2)));
+
+        std::vector<T, Vc::Allocator<T, Vc::ThreadLocalArena>> c(100, T(3));
+        COMPARE(c[99], T(3));
+    }
+    COMPARE(arena.capacity(), std::size_t(Vc::AlignedArena::DefaultChunkSize));
+}
+
+// vim: foldmethod=marker
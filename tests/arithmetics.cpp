@@ -135,7 +135,7 @@ TEST_TYPES(Vec, testIsMix, AllVectors)
 }
 
 // testAdd{{{1
-TEST_TYPES(Vec, testAdd, AllVectors)
+TEST_TYPES(Vec, testAdd, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     Vec a(Zero), b(Zero);
     COMPARE(a, b);
@@ -159,7 +159,7 @@ TEST_TYPES(Vec, testAdd, AllVectors)
 }
 
 // testSub{{{1
-TEST_TYPES(Vec, testSub, AllVectors)
+TEST_TYPES(Vec, testSub, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     Vec a(2), b(2);
     COMPARE(a, b);
@@ -183,7 +183,7 @@ TEST_TYPES(Vec, testSub, AllVectors)
 }
 
 // testMul{{{1
-TEST_TYPES(V, testMul, AllVectors)
+TEST_TYPES(V, testMul, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     for (int i = 0; i < 10000; ++i) {
         V a = V::Random();
@@ -233,7 +233,7 @@ TEST_TYPES(Vec, testMulSub, AllVectors)
 }
 
 // testDiv{{{1
-TEST_TYPES(Vec, testDiv, AllVectors)
+TEST_TYPES(Vec, testDiv, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     for (int repetition = 0; repetition < 10000; ++repetition) {
         const Vec a = Vec::Random();
@@ -309,7 +309,8 @@ TEST_TYPES(Vec, testAnd, int_v, ushort_v, uint_v, short_v)
 }
 
 // testShift{{{1
-TEST_TYPES(Vec, testShift, int_v, ushort_v, uint_v, short_v)
+TEST_TYPES(Vec, testShift, int_v, ushort_v, uint_v, short_v, schar_v, uchar_v, llong_v,
+           ullong_v)
 {
     typedef typename Vec::EntryType T;
     const T step = std::max<T>(1, std::numeric_limits<T>::max() / 1000);
@@ -362,6 +363,103 @@ TEST_TYPES(Vec, testShift, int_v, ushort_v, uint_v, short_v)
     }
 }
 
+// testByteCmp{{{1
+TEST_TYPES(V, testByteCmp, ByteVectors)
+{
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        const V a = V::Random();
+        const V b = repetition % 4 == 0 ? a : V::Random();
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a == b)[i], a[i] == b[i]) << a << " == " << b;
+            COMPARE((a != b)[i], a[i] != b[i]) << a << " != " << b;
+            COMPARE((a <  b)[i], a[i] <  b[i]) << a << " < " << b;
+            COMPARE((a <= b)[i], a[i] <= b[i]) << a << " <= " << b;
+            COMPARE((a >  b)[i], a[i] >  b[i]) << a << " > " << b;
+            COMPARE((a >= b)[i], a[i] >= b[i]) << a << " >= " << b;
+        }
+    }
+}
+
+// testByteCasts{{{1
+TEST_TYPES(V, testByteCasts, ByteVectors)
+{
+    using T = typename V::EntryType;
+    using W = Vc::SimdArray<short, V::Size>;
+    using I = Vc::SimdArray<int, V::Size>;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        const V a = V::Random();
+        const W w = simd_cast<W>(a);
+        const I i = simd_cast<I>(a);
+        for (size_t k = 0; k < V::Size; ++k) {
+            COMPARE(w[k], short(a[k])) << a;
+            COMPARE(i[k], int(a[k])) << a;
+        }
+        COMPARE(simd_cast<V>(w), a);
+        COMPARE(simd_cast<V>(i), a);
+        // the conversion to 8 bits keeps the low byte
+        COMPARE(simd_cast<V>(w * short(256) + w), a);
+    }
+    COMPARE(simd_cast<V>(W(300)), V(T(300 & 0xff)));
+}
+
+// testInt64{{{1
+TEST_TYPES(V, testInt64, Int64Vectors)
+{
+    using T = typename V::EntryType;
+    using D = Vc::SimdArray<double, V::Size>;
+    using I = Vc::SimdArray<int, V::Size>;
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        const V a = V::Random();
+        const V b = repetition % 4 == 0 ? a : V::Random();
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE((a == b)[i], a[i] == b[i]) << a << " == " << b;
+            COMPARE((a != b)[i], a[i] != b[i]) << a << " != " << b;
+            COMPARE((a <  b)[i], a[i] <  b[i]) << a << " < " << b;
+            COMPARE((a <= b)[i], a[i] <= b[i]) << a << " <= " << b;
+            COMPARE((a >  b)[i], a[i] >  b[i]) << a << " > " << b;
+            COMPARE((a >= b)[i], a[i] >= b[i]) << a << " >= " << b;
+        }
+        const V small = a >> 20;
+        const D d = simd_cast<D>(small);
+        const I n = simd_cast<I>(a);
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE(d[i], double(small[i])) << small;
+            COMPARE(n[i], int(a[i])) << a;
+        }
+        COMPARE(simd_cast<V>(d), small);
+        COMPARE(simd_cast<V>(n), V::generate([&](size_t i) { return T(n[i]); }));
+    }
+    COMPARE(V(std::numeric_limits<T>::max()) + 1, V(std::numeric_limits<T>::min()));
+    COMPARE(std::numeric_limits<V>::max(), V(std::numeric_limits<T>::max()));
+    COMPARE(std::numeric_limits<V>::min(), V(std::numeric_limits<T>::min()));
+}
+
+// testSaturating{{{1
+TEST_TYPES(V, testSaturating, concat<ByteVectors, IntVectors>)
+{
+    using T = typename V::EntryType;
+    using L = long long;
+    const L lo = std::numeric_limits<T>::min();
+    const L hi = std::numeric_limits<T>::max();
+    const auto clamp = [&](L x) { return T(std::max(lo, std::min(hi, x))); };
+    for (int repetition = 0; repetition < 10000; ++repetition) {
+        const V a = V::Random();
+        const V b = V::Random();
+        const V sum = Vc::add_sat(a, b);
+        const V diff = Vc::sub_sat(a, b);
+        const V mean = Vc::avg(a, b);
+        for (size_t i = 0; i < V::Size; ++i) {
+            COMPARE(sum[i], clamp(L(a[i]) + L(b[i]))) << a << " + " << b;
+            COMPARE(diff[i], clamp(L(a[i]) - L(b[i]))) << a << " - " << b;
+            const L s = L(a[i]) + L(b[i]) + 1;
+            COMPARE(mean[i], T(s >= 0 ? s / 2 : (s - 1) / 2)) << "avg(" << a << ", " << b
+                                                               << ')';
+        }
+    }
+    COMPARE(Vc::add_sat(V(T(hi)), V(T(1))), V(T(hi)));
+    COMPARE(Vc::sub_sat(V(T(lo)), V(T(1))), V(T(lo)));
+}
+
 // testOnesComplement{{{1
 TEST_TYPES(Vec, testOnesComplement, concat<IntVectors, OddIntSimdArrays<17>>)
 {
@@ -428,7 +526,7 @@ TEST_TYPES(Vec, testNegate, AllVectors)
 }
 
 // testMin{{{1
-TEST_TYPES(Vec, testMin, AllVectors)
+TEST_TYPES(Vec, testMin, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     typedef typename Vec::EntryType T;
     typedef typename Vec::Mask Mask;
@@ -450,7 +548,7 @@ TEST_TYPES(Vec, testMin, AllVectors)
 }
 
 // testMax{{{1
-TEST_TYPES(Vec, testMax, AllVectors)
+TEST_TYPES(Vec, testMax, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     typedef typename Vec::EntryType T;
     typedef typename Vec::Mask Mask;
@@ -473,7 +571,7 @@ TEST_TYPES(Vec, testMax, AllVectors)
 }
 
 // testProduct{{{1
-TEST_TYPES(Vec, testProduct, AllVectors)
+TEST_TYPES(Vec, testProduct, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     typedef typename Vec::EntryType T;
     typedef typename Vec::Mask Mask;
@@ -516,7 +614,7 @@ TEST_TYPES(Vec, testProduct, AllVectors)
 }
 
 // testSum{{{1
-TEST_TYPES(Vec, testSum, AllVectors)
+TEST_TYPES(Vec, testSum, concat<AllVectors, ByteVectors, Int64Vectors>)
 {
     typedef typename Vec::EntryType T;
     typedef typename Vec::Mask Mask;
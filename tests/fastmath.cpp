@@ -0,0 +1,192 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+using Vc::precision;
+
+TEST_TYPES(V, testSin, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(4);
+    const auto fun = [](const V &x) { return Vc::fast::sin(x); };
+    const auto ref = [](long double x) { return std::sin(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -4, 4);
+    compareWithLongDoubleReference<V>(fun, ref, -8192, 8192);
+    // outside of [-8192, 8192] fast::sin is Vc::sin
+    for (size_t i = 0; i < 1000; ++i) {
+        const V x = V::Random() * T(100000) + T(8193);
+        COMPARE(fun(x), Vc::sin(x)) << ", x = " << x;
+        COMPARE(fun(-x), Vc::sin(-x)) << ", x = " << -x;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(0)), V(0));
+    COMPARE(std::signbit(fun(V(T(-0.)))[0]), true);
+    COMPARE(fun(V(std::numeric_limits<T>::denorm_min())),
+            V(std::numeric_limits<T>::denorm_min()));
+    VERIFY(all_of(isnan(fun(V(inf)))));
+    VERIFY(all_of(isnan(fun(V(-inf)))));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const V x = (V::Random() - T(0.5)) * T(100);
+    COMPARE(Vc::sin<precision::ulp4>(x), fun(x));
+    COMPARE(Vc::sin<precision::precise>(x), Vc::sin(x));
+}
+
+TEST_TYPES(V, testCos, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(4);
+    const auto fun = [](const V &x) { return Vc::fast::cos(x); };
+    const auto ref = [](long double x) { return std::cos(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -4, 4);
+    compareWithLongDoubleReference<V>(fun, ref, -8192, 8192);
+    // outside of [-8192, 8192] fast::cos is Vc::cos
+    for (size_t i = 0; i < 1000; ++i) {
+        const V x = V::Random() * T(100000) + T(8193);
+        COMPARE(fun(x), Vc::cos(x)) << ", x = " << x;
+        COMPARE(fun(-x), Vc::cos(-x)) << ", x = " << -x;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(0)), V(1));
+    COMPARE(fun(V(T(-0.))), V(1));
+    VERIFY(all_of(isnan(fun(V(inf)))));
+    VERIFY(all_of(isnan(fun(V(-inf)))));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const V x = (V::Random() - T(0.5)) * T(100);
+    COMPARE(Vc::cos<precision::ulp4>(x), fun(x));
+    COMPARE(Vc::cos<precision::precise>(x), Vc::cos(x));
+}
+
+TEST_TYPES(V, testExp, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(4);
+    const auto fun = [](const V &x) { return Vc::fast::exp(x); };
+    const auto ref = [](long double x) { return std::exp(x); };
+    // results down to 2^-125 (2^-1021) are exact up to 4 ulp
+    const T lo = std::numeric_limits<T>::min_exponent * std::log(T(2));
+    const T hi = std::log(std::numeric_limits<T>::max());
+    compareWithLongDoubleReference<V>(fun, ref, -2, 2);
+    compareWithLongDoubleReference<V>(fun, ref, lo, hi);
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(0)), V(1));
+    COMPARE(fun(V(T(-0.))), V(1));
+    COMPARE(fun(V(inf)), V(inf));
+    COMPARE(fun(V(-inf)), V(0));
+    COMPARE(fun(V(std::numeric_limits<T>::max())), V(inf));
+    COMPARE(fun(V(std::numeric_limits<T>::lowest())), V(0));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+    // results below the normalized range are flushed to zero or are approximate
+    VERIFY(all_of(fun(V(lo - T(1))) < std::numeric_limits<T>::min()));
+    VERIFY(all_of(fun(V(lo - T(1))) >= V(0)));
+
+    const V x = (V::Random() - T(0.5)) * T(100);
+    COMPARE(Vc::exp<precision::ulp4>(x), fun(x));
+    COMPARE(Vc::exp<precision::precise>(x), Vc::exp(x));
+}
+
+TEST_TYPES(V, testLog, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(4);
+    const auto fun = [](const V &x) { return Vc::fast::log(x); };
+    const auto ref = [](long double x) { return std::log(x); };
+    compareWithLongDoubleReference<V>(fun, ref, 0, 4);
+    compareWithLongDoubleReference<V>(fun, ref, T(0.5), 2);
+    compareWithLongDoubleReference<V>(fun, ref, 0, std::numeric_limits<T>::max());
+    compareWithLongDoubleReference<V>(fun, ref, 0, std::numeric_limits<T>::min());
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(1)), V(0));
+    COMPARE(fun(V(0)), V(-inf));
+    COMPARE(fun(V(T(-0.))), V(-inf));
+    COMPARE(fun(V(inf)), V(inf));
+    FUZZY_COMPARE(fun(V(std::numeric_limits<T>::denorm_min())),
+                  V(std::log(std::numeric_limits<T>::denorm_min())));
+    VERIFY(all_of(isnan(fun(V(-1)))));
+    VERIFY(all_of(isnan(fun(V(-inf)))));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const V x = V::Random() * T(100);
+    COMPARE(Vc::log<precision::ulp4>(x), fun(x));
+    COMPARE(Vc::log<precision::precise>(x), Vc::log(x));
+}
+
+TEST_TYPES(V, testAtan2, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(4);
+    setFuzzyness<double>(4);
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V y = (V::Random() - T(0.5)) * T(20);
+        const V x = (V::Random() - T(0.5)) * T(20);
+        V reference;
+        for (size_t j = 0; j < V::Size; ++j) {
+            reference[j] = T(std::atan2(static_cast<long double>(y[j]),
+                                        static_cast<long double>(x[j])));
+        }
+        FUZZY_COMPARE(Vc::fast::atan2(y, x), reference)
+            << ", y = " << y << ", x = " << x << ", i = " << i;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T pi = T(3.14159265358979323846264338327950288);
+    const T max = std::numeric_limits<T>::max();
+    const auto fun = [](const V &y, const V &x) { return Vc::fast::atan2(y, x); };
+    COMPARE(fun(V(0), V(1)), V(0));
+    COMPARE(std::signbit(fun(V(T(-0.)), V(1))[0]), true);
+    COMPARE(fun(V(0), V(T(-0.))), V(pi));
+    COMPARE(fun(V(T(-0.)), V(T(-0.))), V(-pi));
+    COMPARE(fun(V(1), V(0)), V(pi / 2));
+    COMPARE(fun(V(-1), V(0)), V(-pi / 2));
+    COMPARE(fun(V(1), V(-inf)), V(pi));
+    COMPARE(fun(V(-1), V(-inf)), V(-pi));
+    COMPARE(fun(V(inf), V(1)), V(pi / 2));
+    FUZZY_COMPARE(fun(V(inf), V(inf)), V(pi / 4));
+    FUZZY_COMPARE(fun(V(-inf), V(-inf)), V(-3 * pi / 4));
+    FUZZY_COMPARE(fun(V(max), V(max)), V(pi / 4));
+    FUZZY_COMPARE(fun(V(max), V(-max)), V(3 * pi / 4));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN()), V(1)))));
+    VERIFY(all_of(isnan(fun(V(1), V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const V y = (V::Random() - T(0.5)) * T(100);
+    const V x = (V::Random() - T(0.5)) * T(100);
+    COMPARE(Vc::atan2<precision::ulp4>(y, x), fun(y, x));
+    COMPARE(Vc::atan2<precision::precise>(y, x), Vc::atan2(y, x));
+}
+
+//}}}1
+// vim: foldmethod=marker
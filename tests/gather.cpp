@@ -32,13 +32,29 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <Vc/span>
 
 #define ALL_TYPES                                                                        \
-    concat<AllVectors,                                                                   \
+    concat<AllVectors, ByteVectors, Int64Vectors,                                        \
            Typelist<Vc::fixed_size_simd<int, 7>, Vc::fixed_size_simd<int, 9>,            \
                     Vc::fixed_size_simd<uint, 7>, Vc::fixed_size_simd<uint, 9>,          \
                     Vc::fixed_size_simd<short, 9>, Vc::fixed_size_simd<ushort, 9>>>
 
 using namespace Vc;
 
+// all masks for up to 16 entries, random masks for the 32 entries of AVX2 (u)char_v
+template <class V, class F> void forMasks(F &&f, std::true_type)
+{
+    for_all_masks(V, m) {
+        f(m);
+    }
+}
+template <class V, class F> void forMasks(F &&f, std::false_type)
+{
+    withRandomMask<V>(f);
+}
+template <class V, class F> void forMasks(F &&f)
+{
+    forMasks<V>(f, std::integral_constant<bool, (V::size() <= 16)>());
+}
+
 TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
 {
     typedef typename Vec::IndexType It;
@@ -53,7 +69,7 @@ TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
     alignas(static_cast<std::size_t>(It::MemoryAlignment))
         std::array<typename It::EntryType, It::size()> indexArray;
     indexes.store(&indexArray[0], Vc::Aligned);
-    for_all_masks(Vec, m) {
+    forMasks<Vec>([&](const typename Vec::Mask &m) {
         const Vec a(mem, indexes, m);
         for (size_t i = 0; i < Vec::Size; ++i) {
             COMPARE(a[i], m[i] ? mem[i] : 0) << " i = " << i << ", m = " << m;
@@ -77,7 +93,7 @@ TEST_TYPES(Vec, maskedGatherArray, ALL_TYPES)
         for (size_t i = 0; i < Vec::Size; ++i) {
             COMPARE(b[i], m[i] ? mem[i] : x) << " i = " << i << ", m = " << m;
         }
-    }
+    });
 }
 
 template <typename Vec>
@@ -0,0 +1,321 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+using GenericVectors =
+    vir::Typelist<Vc::Generic::double_v, Vc::Generic::float_v, Vc::Generic::int_v,
+                  Vc::Generic::uint_v, Vc::Generic::short_v, Vc::Generic::ushort_v,
+                  Vc::Generic::schar_v, Vc::Generic::uchar_v, Vc::Generic::llong_v,
+                  Vc::Generic::ullong_v>;
+using GenericRealVectors = vir::Typelist<Vc::Generic::double_v, Vc::Generic::float_v>;
+
+template <typename V> V referenceVector(int offset)
+{
+    using T = typename V::EntryType;
+    return V([&](size_t i) { return T((int(i) * 7 + offset) % 23 + 1); });
+}
+
+TEST_TYPES(V, sizes, GenericVectors)
+{
+    using T = typename V::EntryType;
+    COMPARE(V::Size, size_t(Vc_GENERIC_VECTOR_BYTES) / sizeof(T));
+    COMPARE(V::Mask::Size, V::Size);
+    COMPARE(sizeof(V), size_t(Vc_GENERIC_VECTOR_BYTES));
+    COMPARE(V::MemoryAlignment, size_t(Vc_GENERIC_VECTOR_BYTES));
+    VERIFY(Vc::is_simd_vector<V>::value);
+    VERIFY(Vc::is_simd_mask<typename V::Mask>::value);
+    COMPARE(V(), V::Zero());
+}
+
+TEST_TYPES(V, loadStore, GenericVectors)
+{
+    using T = typename V::EntryType;
+    alignas(static_cast<size_t>(V::MemoryAlignment)) T mem[V::Size + 1];
+    for (size_t i = 0; i < V::Size + 1; ++i) {
+        mem[i] = T(i);
+    }
+    const V indexes = V::IndexesFromZero();
+    COMPARE(V(&mem[0], Vc::Aligned), indexes);
+    COMPARE(V(&mem[1], Vc::Unaligned), indexes + 1);
+
+    T out[V::Size + 1] = {};
+    (indexes + 2).store(&out[1], Vc::Unaligned);
+    COMPARE(out[0], T(0));
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(out[i + 1], T(i + 2));
+    }
+    V(T(0)).store(&out[0], indexes > 2, Vc::Unaligned);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(out[i], i > 2 ? T(0) : i == 0 ? T(0) : T(i + 1)) << "i: " << i;
+    }
+
+    // converting load & store
+    signed char bytes[V::Size];
+    for (size_t i = 0; i < V::Size; ++i) {
+        bytes[i] = static_cast<signed char>(i % 100);
+    }
+    COMPARE(V(&bytes[0], Vc::Unaligned), V([](size_t i) { return T(i % 100); }));
+    double doubles[V::Size];
+    indexes.store(&doubles[0], Vc::Unaligned);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(doubles[i], double(T(i)));
+    }
+}
+
+TEST_TYPES(V, arithmetics, GenericVectors)
+{
+    using T = typename V::EntryType;
+    const V a = referenceVector<V>(0);
+    const V b = referenceVector<V>(5);
+    const V sum = a + b, diff = a - b, prod = a * b, quot = a / b;
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(sum[i], T(a[i] + b[i]));
+        COMPARE(diff[i], T(a[i] - b[i]));
+        COMPARE(prod[i], T(a[i] * b[i]));
+        COMPARE(quot[i], T(a[i] / b[i]));
+    }
+    V x = a;
+    x += b;
+    COMPARE(x, sum);
+    x *= T(2);
+    COMPARE(x, sum * 2);
+    COMPARE(-(-a), a);
+    COMPARE(++x, sum * 2 + 1);
+    COMPARE(x--, sum * 2 + 1);
+    COMPARE(x, sum * 2);
+
+    const auto lt = a < b;
+    const auto eq = a == b;
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(lt[i], a[i] < b[i]);
+        COMPARE(eq[i], a[i] == b[i]);
+        COMPARE((a >= b)[i], a[i] >= b[i]);
+    }
+    COMPARE(!lt, a >= b);
+    COMPARE(!V::Zero(), typename V::Mask(true));
+}
+
+TEST_TYPES(V, integerOperators, concat<Vc::Generic::int_v, Vc::Generic::uint_v,
+                                       Vc::Generic::short_v, Vc::Generic::ushort_v,
+                                       Vc::Generic::schar_v, Vc::Generic::uchar_v,
+                                       Vc::Generic::llong_v, Vc::Generic::ullong_v>)
+{
+    using T = typename V::EntryType;
+    const V a = referenceVector<V>(3);
+    const V b = referenceVector<V>(11);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE((a % b)[i], T(a[i] % b[i]));
+        COMPARE((a & b)[i], T(a[i] & b[i]));
+        COMPARE((a | b)[i], T(a[i] | b[i]));
+        COMPARE((a ^ b)[i], T(a[i] ^ b[i]));
+        COMPARE((~a)[i], T(~a[i]));
+        COMPARE((a << 2)[i], T(a[i] << 2));
+        COMPARE((a >> 1)[i], T(a[i] >> 1));
+        COMPARE((a << (b & T(3)))[i], T(a[i] << (b[i] & 3)));
+    }
+}
+
+TEST_TYPES(V, masks, GenericVectors)
+{
+    using M = typename V::Mask;
+    const V indexes = V::IndexesFromZero();
+    COMPARE(M(true).count(), int(V::Size));
+    VERIFY(M(true).isFull());
+    VERIFY(M(false).isEmpty());
+    VERIFY(!M(false).isNotEmpty());
+
+    const int n = V::Size / 2;
+    const M m = indexes < n;
+    COMPARE(m.count(), n);
+    VERIFY(m.isMix());
+    COMPARE(m.firstOne(), 0);
+    COMPARE((!m).firstOne(), n);
+    COMPARE(m.toInt(), typename M::IntType((1ull << n) - 1));
+    COMPARE(m && (indexes > 0), indexes > 0 && indexes < n);
+    COMPARE(m ^ M(true), !m);
+    COMPARE(m.shifted(1), indexes < n - 1);
+    COMPARE(M::generate([&](size_t i) { return int(i) < n; }), m);
+
+    bool mem[V::Size];
+    m.store(mem);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(mem[i], int(i) < n);
+    }
+    COMPARE(M(mem), m);
+
+    V x = indexes;
+    where(m) | x = V(100);
+    x(indexes == n) += 10;
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(x[i], typename V::EntryType(int(i) < n ? 100 : int(i) == n ? n + 10 : i));
+    }
+    COMPARE(iif(m, V::One(), V::Zero()), V([&](size_t i) { return int(i) < n ? 1 : 0; }));
+}
+
+TEST_TYPES(V, reductions, GenericVectors)
+{
+    using T = typename V::EntryType;
+    const V a = referenceVector<V>(1);
+    T sum = 0, prod = 1, min = a[0], max = a[0];
+    for (size_t i = 0; i < V::Size; ++i) {
+        sum += a[i];
+        prod *= a[i];
+        min = std::min<T>(min, a[i]);
+        max = std::max<T>(max, a[i]);
+    }
+    COMPARE(a.sum(), sum);
+    COMPARE(a.product(), prod);
+    COMPARE(a.min(), min);
+    COMPARE(a.max(), max);
+
+    const auto m = V::IndexesFromZero() < 2;
+    COMPARE(a.sum(m), T(a[0] + a[1]));
+    COMPARE(a.min(m), std::min<T>(a[0], a[1]));
+    COMPARE(a.max(m), std::max<T>(a[0], a[1]));
+    COMPARE(a.product(m), T(a[0] * a[1]));
+
+    const V ps = V::One().partialSum();
+    COMPARE(ps, V::IndexesFromZero() + 1);
+}
+
+TEST_TYPES(V, permutations, GenericVectors)
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero() + 1;
+    const int N = V::Size;
+    for (int amount : {-N, -3, -1, 0, 1, 3, N}) {
+        if (std::abs(amount) > N) {
+            continue;
+        }
+        const V shifted = a.shifted(amount);
+        const V rotated = a.rotated(amount);
+        const V shiftedIn = a.shifted(amount, a * 2);
+        for (int i = 0; i < N; ++i) {
+            const int j = i + amount;
+            COMPARE(shifted[i], j >= 0 && j < N ? T(j + 1) : T(0)) << "amount: " << amount;
+            COMPARE(rotated[i], T((j + 2 * N) % N + 1)) << "amount: " << amount;
+            COMPARE(shiftedIn[i], j < 0 ? T(2 * (j + N + 1))
+                                        : j < N ? T(j + 1) : T(2 * (j - N + 1)))
+                << "amount: " << amount;
+        }
+    }
+    COMPARE(a.reversed(), V([&](size_t i) { return T(N - i); }));
+    COMPARE(a.reversed().sorted(), a);
+    COMPARE(a.interleaveLow(-a), V([&](size_t i) { return T(i & 1 ? -T(i / 2 + 1) : T(i / 2 + 1)); }));
+    COMPARE(a.interleaveHigh(a), V([&](size_t i) { return T(N / 2 + i / 2 + 1); }));
+    COMPARE(a.apply([](T x) { return T(x + 1); }), a + 1);
+}
+
+TEST_TYPES(V, gatherScatter, GenericVectors)
+{
+    using T = typename V::EntryType;
+    T data[3 * V::Size + 8];
+    for (size_t i = 0; i < 3 * V::Size + 8; ++i) {
+        data[i] = T(i);
+    }
+    const typename V::IndexType indexes([](int n) { return n * 3; });
+    V x(data, indexes);
+    COMPARE(x, V::IndexesFromZero() * 3);
+
+    x = x + 1;
+    x.scatter(data, indexes, x < T(6));
+    COMPARE(data[0], T(1));
+    COMPARE(data[3], T(4));
+    COMPARE(data[6], T(6));
+}
+
+TEST_TYPES(V, math, GenericRealVectors)
+{
+    using T = typename V::EntryType;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const V a = referenceVector<V>(0) - T(12.25);
+    for (size_t i = 0; i < V::Size; ++i) {
+        COMPARE(abs(a)[i], std::abs(a[i]));
+        COMPARE(sqrt(abs(a))[i], std::sqrt(std::abs(a[i])));
+        COMPARE(floor(a)[i], std::floor(a[i]));
+        COMPARE(ceil(a)[i], std::ceil(a[i]));
+        COMPARE(min(a, -a)[i], std::min(a[i], T(-a[i])));
+        COMPARE(max(a, -a)[i], std::max(a[i], T(-a[i])));
+        COMPARE(copysign(V(T(2)), a)[i], std::copysign(T(2), a[i]));
+        FUZZY_COMPARE(exp(a / 8)[i], std::exp(a[i] / 8));
+        FUZZY_COMPARE(exp2(a / 8)[i], std::exp2(a[i] / 8));
+        FUZZY_COMPARE(expm1(a / 8)[i], std::expm1(a[i] / 8));
+        FUZZY_COMPARE(exp10(a / 8)[i], std::pow(T(10), a[i] / 8));
+        FUZZY_COMPARE(pow(abs(a), a / 8)[i], std::pow(std::abs(a[i]), a[i] / 8));
+        FUZZY_COMPARE(pow(a, 2)[i], a[i] * a[i]);
+        FUZZY_COMPARE(cbrt(a)[i], std::cbrt(a[i]));
+        FUZZY_COMPARE(hypot(a, a + 1)[i], std::hypot(a[i], T(a[i] + 1)));
+        FUZZY_COMPARE(sin(a)[i], std::sin(a[i]));
+    }
+    // the glibc reference itself is off by up to 1.6 ulp for tanh
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    for (size_t i = 0; i < V::Size; ++i) {
+        FUZZY_COMPARE(log1p(abs(a))[i], std::log1p(std::abs(a[i])));
+        FUZZY_COMPARE(sinh(a / 8)[i], std::sinh(a[i] / 8));
+        FUZZY_COMPARE(cosh(a / 8)[i], std::cosh(a[i] / 8));
+        FUZZY_COMPARE(tanh(a / 8)[i], std::tanh(a[i] / 8));
+        FUZZY_COMPARE(erf(a / 8)[i], std::erf(a[i] / 8));
+        FUZZY_COMPARE(erfc(a / 8)[i], std::erfc(a[i] / 8));
+    }
+    COMPARE(round(V(T(2.5))), V(T(2)));
+    COMPARE(round(V(T(-3.5))), V(T(-4)));
+    VERIFY(isnegative(V(T(-0.))).isFull());
+    VERIFY(isnegative(abs(V(T(-0.)))).isEmpty());
+
+    V nan = a;
+    nan.setQnan(a < 0);
+    COMPARE(isnan(nan), a < 0);
+    COMPARE(isfinite(nan), a >= 0);
+    COMPARE(isinf(V(std::numeric_limits<T>::infinity())), typename V::Mask(true));
+    COMPARE(isinf(a), typename V::Mask(false));
+
+    Vc::fixed_size_simd<int, V::Size> e;
+    const V mantissa = frexp(a, &e);
+    COMPARE(ldexp(mantissa, e), a);
+}
+
+TEST_TYPES(V, casts, GenericVectors)
+{
+    using T = typename V::EntryType;
+    const V a = V::IndexesFromZero();
+    const auto f = Vc::simd_cast<Vc::Generic::float_v>(a);
+    const auto d1 = Vc::simd_cast<Vc::Generic::double_v, 1>(a);
+    for (size_t i = 0; i < Vc::Generic::float_v::Size; ++i) {
+        COMPARE(f[i], i < V::Size ? float(T(i)) : 0.f);
+    }
+    for (size_t i = 0; i < Vc::Generic::double_v::Size; ++i) {
+        const size_t j = i + Vc::Generic::double_v::Size;
+        COMPARE(d1[i], j < V::Size ? double(T(j)) : 0.);
+    }
+    const auto m = Vc::simd_cast<Vc::Generic::short_m>(a < 2);
+    COMPARE(m.count(), 2);
+    using S = Vc::Scalar::Vector<T>;
+    COMPARE((Vc::simd_cast<S, 1>(a)), S(T(1)));
+}
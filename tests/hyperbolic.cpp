@@ -0,0 +1,152 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+TEST_TYPES(V, testSinh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const T max = std::log(std::numeric_limits<T>::max()) + std::log(T(2)) - T(0.001);
+    const T inf = std::numeric_limits<T>::infinity();
+    const T denorm = std::numeric_limits<T>::denorm_min();
+    COMPARE(Vc::sinh(V(0)), V(0));
+    COMPARE(std::signbit(Vc::sinh(V(T(-0.)))[0]), true);
+    COMPARE(Vc::sinh(V(denorm)), V(denorm));
+    COMPARE(Vc::sinh(V(-denorm)), V(-denorm));
+    COMPARE(Vc::sinh(V(inf)), V(inf));
+    COMPARE(Vc::sinh(V(-inf)), V(-inf));
+    COMPARE(Vc::sinh(V(std::numeric_limits<T>::max())), V(inf));
+    VERIFY(all_of(isnan(Vc::sinh(V(std::numeric_limits<T>::quiet_NaN())))));
+    // the largest arguments with finite results
+    FUZZY_COMPARE(Vc::sinh(V(max)), V(std::sinh(max)));
+    FUZZY_COMPARE(Vc::sinh(V(-max)), V(-std::sinh(max)));
+
+    const auto fun = [](const V &x) { return Vc::sinh(x); };
+    const auto ref = [](long double x) { return std::sinh(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, T(-1e-5), T(1e-5));
+    compareWithLongDoubleReference<V>(fun, ref, -max, max);
+}
+
+TEST_TYPES(V, testCosh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const T max = std::log(std::numeric_limits<T>::max()) + std::log(T(2)) - T(0.001);
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::cosh(V(0)), V(1));
+    COMPARE(Vc::cosh(V(T(-0.))), V(1));
+    COMPARE(Vc::cosh(V(std::numeric_limits<T>::denorm_min())), V(1));
+    COMPARE(Vc::cosh(V(inf)), V(inf));
+    COMPARE(Vc::cosh(V(-inf)), V(inf));
+    COMPARE(Vc::cosh(V(std::numeric_limits<T>::max())), V(inf));
+    VERIFY(all_of(isnan(Vc::cosh(V(std::numeric_limits<T>::quiet_NaN())))));
+    FUZZY_COMPARE(Vc::cosh(V(max)), V(std::cosh(max)));
+    FUZZY_COMPARE(Vc::cosh(V(-max)), V(std::cosh(max)));
+
+    const auto fun = [](const V &x) { return Vc::cosh(x); };
+    const auto ref = [](long double x) { return std::cosh(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, -max, max);
+}
+
+TEST_TYPES(V, testTanh, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const T inf = std::numeric_limits<T>::infinity();
+    const T denorm = std::numeric_limits<T>::denorm_min();
+    COMPARE(Vc::tanh(V(0)), V(0));
+    COMPARE(std::signbit(Vc::tanh(V(T(-0.)))[0]), true);
+    COMPARE(Vc::tanh(V(denorm)), V(denorm));
+    COMPARE(Vc::tanh(V(-denorm)), V(-denorm));
+    COMPARE(Vc::tanh(V(30)), V(1));
+    COMPARE(Vc::tanh(V(-30)), V(-1));
+    COMPARE(Vc::tanh(V(std::numeric_limits<T>::max())), V(1));
+    COMPARE(Vc::tanh(V(inf)), V(1));
+    COMPARE(Vc::tanh(V(-inf)), V(-1));
+    VERIFY(all_of(isnan(Vc::tanh(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const auto fun = [](const V &x) { return Vc::tanh(x); };
+    const auto ref = [](long double x) { return std::tanh(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, T(-1e-5), T(1e-5));
+    compareWithLongDoubleReference<V>(fun, ref, -20, 20);
+}
+
+TEST_TYPES(V, testErf, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erf(V(0)), V(0));
+    COMPARE(std::signbit(Vc::erf(V(T(-0.)))[0]), true);
+    COMPARE(Vc::erf(V(7)), V(1));
+    COMPARE(Vc::erf(V(-7)), V(-1));
+    COMPARE(Vc::erf(V(inf)), V(1));
+    COMPARE(Vc::erf(V(-inf)), V(-1));
+    VERIFY(all_of(isnan(Vc::erf(V(std::numeric_limits<T>::quiet_NaN())))));
+
+    const auto fun = [](const V &x) { return Vc::erf(x); };
+    const auto ref = [](long double x) { return std::erf(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, T(-1e-5), T(1e-5));
+    compareWithLongDoubleReference<V>(fun, ref, -6, 6);
+}
+
+TEST_TYPES(V, testErfc, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(3);
+    setFuzzyness<double>(3);
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::erfc(V(0)), V(1));
+    COMPARE(Vc::erfc(V(T(-0.))), V(1));
+    COMPARE(Vc::erfc(V(-7)), V(2));
+    COMPARE(Vc::erfc(V(30)), V(0));
+    COMPARE(Vc::erfc(V(inf)), V(0));
+    COMPARE(Vc::erfc(V(-inf)), V(2));
+    VERIFY(all_of(isnan(Vc::erfc(V(std::numeric_limits<T>::quiet_NaN())))));
+    // results in the range of denormals
+    const T large = sizeof(T) == 4 ? T(9.5) : T(27);
+    VERIFY(Vc::erfc(V(large))[0] > T(0));
+    VERIFY(Vc::erfc(V(large))[0] < std::numeric_limits<T>::min());
+
+    const auto fun = [](const V &x) { return Vc::erfc(x); };
+    const auto ref = [](long double x) { return std::erfc(x); };
+    // the upper bounds keep the results out of the denormal range
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, -6, sizeof(T) == 4 ? T(9) : T(26));
+}
+
+//}}}1
+// vim: foldmethod=marker
@@ -0,0 +1,123 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+using Vc::Interpolation;
+
+template <typename T>  //{{{1
+T lerp_reference(const std::vector<T> &samples, T x0, T dx, T x)
+{
+    const T u = std::min(std::max((x - x0) / dx, T(0)), T(samples.size() - 1));
+    const std::size_t i = std::min(std::size_t(u), samples.size() - 2);
+    return samples[i] + (u - i) * (samples[i + 1] - samples[i]);
+}
+
+TEST_TYPES(V, testLinear, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    // sizes that fit into registers as well as those that need gathers
+    for (std::size_t size : {2, 3, 4, 5, 8, 9, 16, 17, 100, 1000}) {
+        std::vector<T> samples(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            samples[i] = std::sin(T(i) * T(0.3)) * 10;
+        }
+        const T x0 = -1;
+        const T dx = T(0.25);
+        const Vc::Table<T> table(samples.data(), size, x0, dx);
+        const T hi = x0 + (size - 1) * dx;
+        for (int rep = 0; rep < 1000; ++rep) {
+            // includes arguments outside of the table on both sides
+            const V x = V::Random() * (hi - x0 + 2) + (x0 - 1);
+            const V ref = x.apply([&](T _x) { return lerp_reference(samples, x0, dx, _x); });
+            FUZZY_COMPARE(Vc::interpolate(table, x), ref) << "size = " << size << ", x = " << x;
+        }
+        // both interpolations pass through the samples (the last one is reached at the
+        // end of the last segment and thus only up to rounding)
+        const V i = V([&](int n) { return T(n % size); });
+        const V exact = i.apply([&](T _i) { return samples[std::size_t(_i)]; });
+        FUZZY_COMPARE(Vc::interpolate(table, x0 + i * dx), exact) << "size = " << size;
+        FUZZY_COMPARE(Vc::interpolate<Interpolation::Cubic>(table, x0 + i * dx), exact)
+            << "size = " << size;
+        // clamping and NaN
+        COMPARE(Vc::interpolate(table, V(x0 - 100)), V(samples.front()));
+        COMPARE(Vc::interpolate(table, V(hi + 100)), V(samples.back()));
+        COMPARE(Vc::interpolate(table, V(std::numeric_limits<T>::infinity())),
+                V(samples.back()));
+        VERIFY(all_of(isnan(Vc::interpolate(table, V(std::numeric_limits<T>::quiet_NaN())))));
+        VERIFY(all_of(isnan(Vc::interpolate<Interpolation::Cubic>(
+            table, V(std::numeric_limits<T>::quiet_NaN())))));
+    }
+}
+
+TEST_TYPES(V, testCubic, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    // Catmull-Rom reproduces polynomials of degree 2 away from the table ends
+    const T c[] = {1, T(-0.5), T(0.125)};
+    for (std::size_t size : {6, 7, 16, 50}) {
+        std::vector<T> samples(size);
+        for (std::size_t i = 0; i < size; ++i) {
+            samples[i] = c[0] + c[1] * i + c[2] * i * i;
+        }
+        const Vc::Table<T> table(samples.data(), size);
+        setFuzzyness<float>(8);
+        setFuzzyness<double>(8);
+        for (int rep = 0; rep < 1000; ++rep) {
+            const V x = V::Random() * T(size - 3) + 1;
+            FUZZY_COMPARE(Vc::interpolate<Interpolation::Cubic>(table, x),
+                          c[0] + x * (c[1] + x * c[2]))
+                << "size = " << size << ", x = " << x;
+        }
+        // in the first and last segment the samples outside of the table repeat the end
+        // samples, which bends the curve
+        for (std::size_t i = 0; i < size; ++i) {
+            samples[i] = 3 - T(2) * i;
+        }
+        const Vc::Table<T> linear(samples.data(), size);
+        COMPARE(Vc::interpolate<Interpolation::Cubic>(linear, V(T(0.5))), V(T(2.125)));
+        for (int rep = 0; rep < 1000; ++rep) {
+            const V x = V::Random() * T(size - 3) + 1;
+            FUZZY_COMPARE(Vc::interpolate<Interpolation::Cubic>(linear, x), 3 - 2 * x)
+                << "size = " << size << ", x = " << x;
+        }
+    }
+}
+
+TEST_TYPES(V, testArray, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const T samples[] = {0, 1, 4, 9, 16};
+    const Vc::Table<T> table(samples, 5, T(10), T(2));
+    COMPARE(table.size(), 5u);
+    COMPARE(Vc::interpolate(table, V(T(13))), V(T(2.5)));
+    COMPARE(Vc::interpolate(table, V(T(17))), V(T(12.5)));
+}
+
+// vim: foldmethod=marker
@@ -140,5 +140,38 @@ TEST_TYPES(V, testLog10, RealTypes) //{{{1
     });
 }
 
+TEST_TYPES(V, testLog1p, RealTypes) //{{{1
+{
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    typedef typename V::EntryType T;
+    COMPARE(Vc::log1p(V(0)), V(0));
+    COMPARE(std::signbit(Vc::log1p(V(T(-0.)))[0]), true);
+    COMPARE(Vc::log1p(V(-1)), V(-std::numeric_limits<T>::infinity()));
+    COMPARE(Vc::log1p(V(std::numeric_limits<T>::infinity())),
+            V(std::numeric_limits<T>::infinity()));
+    VERIFY(all_of(isnan(Vc::log1p(V(-2)))));
+    VERIFY(all_of(isnan(Vc::log1p(V(-std::numeric_limits<T>::infinity())))));
+    VERIFY(all_of(isnan(Vc::log1p(V(std::numeric_limits<T>::quiet_NaN())))));
+    testAllDenormals<V>([](const V x) {
+        COMPARE(Vc::log1p(x), x);
+        COMPARE(Vc::log1p(-x), -x);
+    });
+
+    // reference in long double for random x in [lo, hi)
+    const auto test = [](T lo, T hi) {
+        for (size_t i = 0; i < 100000 / V::Size; ++i) {
+            const V x = V::Random() * (hi - lo) + lo;
+            const V ref = x.apply(
+                [](T _x) { return T(std::log1p(static_cast<long double>(_x))); });
+            FUZZY_COMPARE(Vc::log1p(x), ref) << " x = " << x << ", i = " << i;
+        }
+    };
+    test(T(-0.999), T(-0.5));
+    test(T(-0.5), T(1));
+    test(T(-1e-5), T(1e-5));
+    test(1, T(1e6));
+}
+
 //}}}1
 // vim: foldmethod=marker
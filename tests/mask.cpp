@@ -480,4 +480,50 @@ TEST_TYPES(V, testCompareOperators, AllVectors) /*{{{*/
 }
 /*}}}*/
 
+TEST_TYPES(V, compressExpand, concat<AllVectors, SimdArrays<8>, OddSimdArrays<3>>) /*{{{*/
+{
+    typedef typename V::EntryType T;
+    typedef typename V::Mask M;
+    const V v = V(Vc::IndexesFromZero) + T(1);
+    for (unsigned bits = 0; bits < (1u << V::Size); ++bits) {
+        const M k = allMasks<V>(bits);
+        const V c = Vc::compress(v, k);
+        const V e = Vc::expand(v, k);
+        size_t j = 0;
+        for (size_t i = 0; i < V::Size; ++i) {
+            if (k[i]) {
+                COMPARE(c[j], v[i]) << "k: " << k << ", c: " << c;
+                COMPARE(e[i], v[j]) << "k: " << k << ", e: " << e;
+                ++j;
+            } else {
+                COMPARE(e[i], T(0)) << "k: " << k << ", e: " << e;
+            }
+        }
+        for (; j < V::Size; ++j) {
+            COMPARE(c[j], T(0)) << "k: " << k << ", c: " << c;
+        }
+        COMPARE(Vc::expand(c, k), iif(k, v, V::Zero())) << "k: " << k;
+    }
+}
+/*}}}*/
+TEST_TYPES(V, compressStore, concat<AllVectors, SimdArrays<8>, OddSimdArrays<3>>) /*{{{*/
+{
+    typedef typename V::EntryType T;
+    withRandomMask<V>([](const typename V::Mask &k) {
+        const V v = V(Vc::IndexesFromZero) + T(1);
+        const V c = Vc::compress(v, k);
+        const std::size_t n = k.count();
+        T mem[V::Size + 2];
+        for (size_t offset = 0; offset < 2; ++offset) {
+            std::fill_n(&mem[0], V::Size + 2, T(-1));
+            COMPARE(Vc::compress_store(&mem[offset], v, k), n);
+            for (size_t i = 0; i < n; ++i) {
+                COMPARE(mem[offset + i], c[i]) << "k: " << k << ", i: " << i;
+            }
+            COMPARE(mem[offset + n], T(-1)) << "k: " << k;
+        }
+    });
+}
+/*}}}*/
+
 // vim: foldmethod=marker
@@ -99,7 +99,19 @@ TEST_TYPES(V, testCeil, RealTypes) //{{{1
     COMPARE(Vc::ceil(x), reference) << ", x = " << x;
 }
 
-TEST_TYPES(V, testExp, RealTypes) //{{{1
+// exp {{{1
+template <typename V, typename F> void testExpSpecialValues(F &&fun, typename V::EntryType lo)
+{
+    typedef typename V::EntryType T;
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(fun(V(inf)), V(inf));
+    COMPARE(fun(V(-inf)), V(lo));
+    COMPARE(fun(V(std::numeric_limits<T>::max())), V(inf));
+    COMPARE(fun(V(std::numeric_limits<T>::lowest())), V(lo));
+    VERIFY(all_of(isnan(fun(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testExp, RealTypes)
 {
     setFuzzyness<float>(1);
     setFuzzyness<double>(2);
@@ -110,6 +122,85 @@ TEST_TYPES(V, testExp, RealTypes) //{{{1
         FUZZY_COMPARE(Vc::exp(x), reference) << ", x = " << x << ", i = " << i;
     }
     COMPARE(Vc::exp(V(0)), V(1));
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp(x); }, 0);
+}
+
+// exp2, exp10, expm1 {{{1
+// Results in the denormal range have fewer significant bits; the ulp distance relative to
+// the exponent of the reference overstates the error there. Require an absolute error of
+// at most one denorm_min instead.
+template <typename V, typename F, typename R>
+void testExpDenormalResults(F &&fun, R &&ref, typename V::EntryType lo,
+                            typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        const V reference = x.apply([&](T _x) { return T(ref(static_cast<long double>(_x))); });
+        const V result = fun(x);
+        VERIFY(all_of(abs(result - reference) <= std::numeric_limits<T>::denorm_min()))
+            << "x = " << x << ", result = " << result << ", reference = " << reference;
+    }
+}
+
+TEST_TYPES(V, testExpDenormals, RealTypes)
+{
+    typedef typename V::EntryType T;
+    const T lo = std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits;
+    const T hi = std::numeric_limits<T>::min_exponent - 1;
+    testExpDenormalResults<V>([](const V &x) { return Vc::exp2(x); },
+                              [](long double x) { return std::exp2(x); }, lo, hi);
+    const T ln2 = std::log(T(2));
+    testExpDenormalResults<V>([](const V &x) { return Vc::exp(x); },
+                              [](long double x) { return std::exp(x); }, lo * ln2, hi * ln2);
+    COMPARE(Vc::exp2(V(lo)), V(std::numeric_limits<T>::denorm_min()));
+    COMPARE(Vc::exp2(V(lo - 2)), V(0));
+}
+
+TEST_TYPES(V, testExp2, RealTypes)
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    compareWithLongDoubleReference<V>([](const V &x) { return Vc::exp2(x); },
+                                      [](long double x) { return std::exp2(x); },
+                                      std::numeric_limits<T>::min_exponent - 1,
+                                      std::numeric_limits<T>::max_exponent);
+    COMPARE(Vc::exp2(V(0)), V(1));
+    COMPARE(Vc::exp2(V(10)), V(1024));
+    COMPARE(Vc::exp2(V(-3)), V(0.125));
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp2(x); }, 0);
+}
+
+TEST_TYPES(V, testExp10, RealTypes)
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    compareWithLongDoubleReference<V>([](const V &x) { return Vc::exp10(x); },
+                                      [](long double x) { return std::pow(10.L, x); },
+                                      std::numeric_limits<T>::min_exponent10,
+                                      std::numeric_limits<T>::max_exponent10);
+    COMPARE(Vc::exp10(V(0)), V(1));
+    COMPARE(Vc::exp10(V(3)), V(1000));
+    testExpSpecialValues<V>([](const V &x) { return Vc::exp10(x); }, 0);
+}
+
+TEST_TYPES(V, testExpm1, RealTypes)
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const auto ref = [](long double x) { return std::expm1(x); };
+    const auto fun = [](const V &x) { return Vc::expm1(x); };
+    compareWithLongDoubleReference<V>(fun, ref, -1, 1);
+    compareWithLongDoubleReference<V>(fun, ref, T(-1e-5), T(1e-5));
+    compareWithLongDoubleReference<V>(fun, ref, -50,
+                                      std::log(std::numeric_limits<T>::max()));
+    COMPARE(Vc::expm1(V(0)), V(0));
+    COMPARE(Vc::expm1(V(-0.)), V(-0.));
+    COMPARE(Vc::expm1(V(std::numeric_limits<T>::min())), V(std::numeric_limits<T>::min()));
+    testExpSpecialValues<V>(fun, -1);
 }
 
 TEST_TYPES(V, testMax, AllTypes) //{{{1
@@ -319,3 +319,88 @@ TEST_TYPES(V, testCopyAssignment, AllVectors)
         COMPARE(m1[i], T(1));
     }
 }
+
+TEST_TYPES(V, memoryExpressions, AllVectors)
+{
+    typedef typename V::EntryType T;
+    const size_t N = 77;
+    Memory<V> a(N), b(N), c(N), d(N);
+    for (size_t i = 0; i < N; ++i) {
+        b[i] = T(i % 10 + 1);
+        c[i] = T(i % 3 + 1);
+        d[i] = T(i % 5);
+    }
+    a = b * c + d;
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(b[i] * c[i] + d[i])) << "i = " << i;
+    }
+    a = d - b / c;
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(d[i] - b[i] / c[i])) << "i = " << i;
+    }
+
+    // broadcasts: scalars and vectors on either side of every operator
+    a = b + T(1);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(b[i] + 1)) << "i = " << i;
+    }
+    a = T(20) - b;
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(20 - b[i])) << "i = " << i;
+    }
+    a = T(1) + b - T(3);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(1 + b[i] - 3)) << "i = " << i;
+    }
+    a = T(2) * b + V(T(1));
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(2 * b[i] + 1)) << "i = " << i;
+    }
+    a = V(T(100)) - (b * c) / T(2) - T(1);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(T(100) - T(b[i] * c[i]) / T(2) - T(1))) << "i = " << i;
+    }
+
+    // the operand of the expression may be the destination
+    Memory<V> ref(a);
+    a += b * c;
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] + b[i] * c[i])) << "i = " << i;
+    }
+    a = ref;
+    a *= b - d;
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(ref[i] * (b[i] - d[i]))) << "i = " << i;
+    }
+    a = (a - ref * (b - d)) + c;
+    COMPARE(a, c);
+
+    // explicit load/store flags and construction from an expression
+    a.assign(b * c + d, Vc::Aligned | Vc::Streaming);
+    Memory<V> e(b * c + d);
+    COMPARE(e.entriesCount(), N);
+    COMPARE(a, e);
+    a.assign(b + c, Vc::Aligned | Vc::PrefetchDefault);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(a[i], T(b[i] + c[i])) << "i = " << i;
+    }
+
+    // fixed-size Memory and SimdVector
+    Memory<V, 33> f, g;
+    for (size_t i = 0; i < 33; ++i) {
+        g[i] = T(i);
+    }
+    f = g * g - g;
+    for (size_t i = 0; i < 33; ++i) {
+        COMPARE(f[i], T(T(i) * T(i) - T(i))) << "i = " << i;
+    }
+    SimdVector<T> s = (b + d) * T(3);
+    COMPARE(s.size(), N);
+    for (size_t i = 0; i < N; ++i) {
+        COMPARE(s[i], T((b[i] + d[i]) * 3)) << "i = " << i;
+    }
+    s = s + T(1) * b;
+    for (size_t i = N; i < s.vectorsCount() * V::Size; ++i) {
+        COMPARE(s.data()[i], T(0)) << "i = " << i;
+    }
+}
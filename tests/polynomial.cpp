@@ -0,0 +1,113 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+
+template <typename V, std::size_t N>  //{{{1
+V reference(const V &x, const double (&c)[N])
+{
+    typedef typename V::EntryType T;
+    return x.apply([&](T _x) {
+        long double r = c[N - 1];
+        for (std::size_t i = N - 1; i > 0; --i) {
+            r = r * _x + c[i - 1];
+        }
+        return T(r);
+    });
+}
+
+TEST_TYPES(V, testHorner, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const V x = V([](int n) { return T(n % 7 - 3); });
+    COMPARE(Vc::horner(x, 5), V(5));
+    COMPARE(Vc::horner(x, 1, 2), 1 + 2 * x);
+    COMPARE(Vc::horner(x, 1, 2, 3), 1 + x * (2 + 3 * x));
+    COMPARE(Vc::horner(x, 1., -2.f, V(3), 4), 1 + x * (-2 + x * (3 + 4 * x)));
+    const double c[] = {1, -2, 3, 4};
+    COMPARE(Vc::horner(x, c), Vc::horner(x, 1, -2, 3, 4));
+
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    // Taylor series of eˣ
+    const double e[] = {1.,
+                        1.,
+                        1. / 2,
+                        1. / 6,
+                        1. / 24,
+                        1. / 120,
+                        1. / 720,
+                        1. / 5040,
+                        1. / 40320,
+                        1. / 362880,
+                        1. / 3628800,
+                        1. / 39916800};
+    for (int i = 0; i < 1000; ++i) {
+        const V y = V::Random();
+        FUZZY_COMPARE(Vc::horner(y, e), reference(y, e)) << "y = " << y;
+    }
+}
+
+TEST_TYPES(V, testEstrin, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const V x = V([](int n) { return T(n % 7 - 3); });
+    COMPARE(Vc::estrin(x, 5), V(5));
+    COMPARE(Vc::estrin(x, 1, 2), 1 + 2 * x);
+    COMPARE(Vc::estrin(x, 1, 2, 3), 1 + x * (2 + 3 * x));
+    COMPARE(Vc::estrin(x, 1., -2.f, V(3), 4), 1 + x * (-2 + x * (3 + 4 * x)));
+    // all intermediate results are small integers and thus exact
+    COMPARE(Vc::estrin(x, 1, 2, 3, 4, 5, 6, 7), Vc::horner(x, 1, 2, 3, 4, 5, 6, 7));
+    COMPARE(Vc::estrin(x, 1, 2, 3, 4, 5, 6, 7, 8, 9),
+            Vc::horner(x, 1, 2, 3, 4, 5, 6, 7, 8, 9));
+
+    setFuzzyness<float>(2);
+    setFuzzyness<double>(2);
+    const double e[] = {1.,
+                        1.,
+                        1. / 2,
+                        1. / 6,
+                        1. / 24,
+                        1. / 120,
+                        1. / 720,
+                        1. / 5040,
+                        1. / 40320,
+                        1. / 362880,
+                        1. / 3628800,
+                        1. / 39916800,
+                        1. / 479001600,
+                        1. / 6227020800,
+                        1. / 87178291200,
+                        1. / 1307674368000,
+                        1. / 20922789888000};
+    for (int i = 0; i < 1000; ++i) {
+        const V y = V::Random();
+        FUZZY_COMPARE(Vc::estrin(y, e), reference(y, e)) << "y = " << y;
+    }
+}
+
+// vim: foldmethod=marker
@@ -0,0 +1,213 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <cmath>
+
+template <typename V, typename F, typename R>  //{{{1
+void testBinaryFunction(F &&fun, R &&ref, const V &x_lo, const V &x_hi, const V &y_lo,
+                        const V &y_hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (x_hi - x_lo) + x_lo;
+        const V y = V::Random() * (y_hi - y_lo) + y_lo;
+        const V reference = V::generate([&](size_t j) {
+            return T(ref(static_cast<long double>(x[j]), static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(fun(x, y), reference) << ", x = " << x << ", y = " << y << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, testPow, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(2);
+    const auto fun = [](const V &x, const V &y) { return Vc::pow(x, y); };
+    const auto ref = [](long double x, long double y) { return std::pow(x, y); };
+    testBinaryFunction<V>(fun, ref, V(T(0.5)), V(T(10)), V(T(-30)), V(T(30)));
+    testBinaryFunction<V>(fun, ref, V(T(0.99)), V(T(1.01)), V(T(-1000)), V(T(1000)));
+
+    // large and small bases with the exponent chosen to keep the result normal
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V e = round((V::Random() - T(0.5)) * T(200));
+        const V x = Vc::exp2(e) * (V::Random() + T(1));
+        const V y = (V::Random() - T(0.5)) * T(1.8);
+        const V reference = V::generate([&](size_t j) {
+            return T(std::pow(static_cast<long double>(x[j]), static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+    }
+
+    // negative bases with integral exponents
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V x = -(V::Random() * T(9.5) + T(0.5));
+        const V y = round((V::Random() - T(0.5)) * T(40));
+        const V reference = V::generate([&](size_t j) {
+            return T(std::pow(static_cast<long double>(x[j]), static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(Vc::pow(x, y), reference) << ", x = " << x << ", y = " << y;
+    }
+
+    COMPARE(Vc::pow(V(2), V(10)), V(1024));
+    COMPARE(Vc::pow(V(-2), V(3)), V(-8));
+    COMPARE(Vc::pow(V(4), V(T(0.5))), V(2));
+    COMPARE(Vc::pow(V(10), V(-2)), V(T(0.01)));
+    FUZZY_COMPARE(Vc::pow(V(std::numeric_limits<T>::denorm_min()), V(T(0.5))),
+                  V(std::sqrt(std::numeric_limits<T>::denorm_min())));
+}
+
+TEST_TYPES(V, testPowSpecialValues, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T big = std::numeric_limits<T>::max();
+    // the special cases of C99 Annex F.9.4.4
+    for (T x : {T(0), T(-0.), T(1), T(-1), T(0.5), T(-0.5), T(2), T(-2), T(3.5), inf, -inf, nan,
+                big, -big, std::numeric_limits<T>::denorm_min()}) {
+        for (T y : {T(0), T(-0.), T(1), T(-1), T(2), T(-2), T(3), T(-3), T(0.5), T(-0.5),
+                    T(2.5), inf, -inf, nan, big, -big}) {
+            const T reference = std::pow(x, y);
+            const V result = Vc::pow(V(x), V(y));
+            if (std::isnan(reference)) {
+                VERIFY(all_of(isnan(result))) << "pow(" << x << ", " << y << ") = " << result;
+            } else if (reference == 0 || std::isinf(reference)) {
+                COMPARE(result, V(reference)) << "pow(" << x << ", " << y << ")";
+                COMPARE(std::signbit(result[0]), std::signbit(reference)) << "pow(" << x << ", " << y
+                                                                   << ")";
+            } else {
+                FUZZY_COMPARE(result, V(reference)) << "pow(" << x << ", " << y << ")";
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, testPowIntegralExponents, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(5);
+    setFuzzyness<double>(5);
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(40);
+        COMPARE(Vc::pow(x, 0), V(T(1)));
+        COMPARE(Vc::pow(x, 1), x);
+        COMPARE(Vc::pow(x, 2), x * x);
+        COMPARE(Vc::pow(x, -1), V(T(1)) / x);
+        COMPARE(Vc::pow(x, -2), V(T(1)) / (x * x));
+        COMPARE(Vc::pow(x, 5), Vc::pow(x, V(5)));
+        COMPARE(Vc::pow(x, -7), Vc::pow(x, V(-7)));
+        COMPARE(Vc::pow(abs(x), 2.5), Vc::pow(abs(x), V(T(2.5))));
+
+        COMPARE(Vc::pow<0>(x), V(T(1)));
+        COMPARE(Vc::pow<1>(x), x);
+        COMPARE(Vc::pow<2>(x), x * x);
+        COMPARE(Vc::pow<3>(x), x * x * x);
+        COMPARE(Vc::pow<-1>(x), V(T(1)) / x);
+        const V reference = x.apply([](T _x) { return T(std::pow(static_cast<long double>(_x), 7)); });
+        FUZZY_COMPARE(Vc::pow<7>(x), reference) << ", x = " << x;
+    }
+}
+
+TEST_TYPES(V, testCbrt, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    // the Scalar implementation (also used for the remainder of SimdArray) calls std::cbrt,
+    // which is off by up to 3 ulp in glibc
+    if (Vc::Scalar::is_vector<V>::value || !std::is_same<V, Vc::Vector<T>>::value) {
+        setFuzzyness<double>(3);
+    }
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V e = round((V::Random() - T(0.5)) * T(2 * std::numeric_limits<T>::max_exponent));
+        const V x = Vc::exp2(e) * (V::Random() + T(1)) * (V::Random() - T(0.5));
+        const V reference =
+            x.apply([](T _x) { return T(std::cbrt(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::cbrt(x), reference) << ", x = " << x;
+    }
+    for (T x = std::numeric_limits<T>::denorm_min(); x < std::numeric_limits<T>::min();
+         x *= T(3.7)) {
+        FUZZY_COMPARE(Vc::cbrt(V(x)), V(T(std::cbrt(static_cast<long double>(x)))))
+            << ", x = " << x;
+    }
+    FUZZY_COMPARE(Vc::cbrt(V(27)), V(3));
+    FUZZY_COMPARE(Vc::cbrt(V(-8)), V(-2));
+    FUZZY_COMPARE(Vc::cbrt(V(T(0.125))), V(T(0.5)));
+    COMPARE(Vc::cbrt(V(0)), V(0));
+    COMPARE(std::signbit(Vc::cbrt(V(T(-0.)))[0]), true);
+    COMPARE(Vc::cbrt(V(std::numeric_limits<T>::infinity())),
+            V(std::numeric_limits<T>::infinity()));
+    COMPARE(Vc::cbrt(V(-std::numeric_limits<T>::infinity())),
+            V(-std::numeric_limits<T>::infinity()));
+    VERIFY(all_of(isnan(Vc::cbrt(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testHypot, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(1);
+    setFuzzyness<double>(1);
+    const auto fun = [](const V &x, const V &y) { return Vc::hypot(x, y); };
+    const auto ref = [](long double x, long double y) { return std::hypot(x, y); };
+    testBinaryFunction<V>(fun, ref, V(T(-1000)), V(T(1000)), V(T(-1000)), V(T(1000)));
+
+    // arguments whose squares overflow or underflow (with normal results)
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V e =
+            round((V::Random() - T(0.5)) * T(2 * (std::numeric_limits<T>::max_exponent - 2)));
+        const V x = Vc::exp2(e) * (V::Random() + T(1));
+        const V y = x * (V::Random() - T(0.5)) * T(4);
+        const V reference = V::generate([&](size_t j) {
+            return T(std::hypot(static_cast<long double>(x[j]), static_cast<long double>(y[j])));
+        });
+        FUZZY_COMPARE(Vc::hypot(x, y), reference) << ", x = " << x << ", y = " << y;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    const T nan = std::numeric_limits<T>::quiet_NaN();
+    const T big = std::numeric_limits<T>::max();
+    const T denorm = std::numeric_limits<T>::denorm_min();
+    COMPARE(Vc::hypot(V(3), V(4)), V(5));
+    COMPARE(Vc::hypot(V(-5), V(12)), V(13));
+    COMPARE(Vc::hypot(V(0), V(0)), V(0));
+    COMPARE(Vc::hypot(V(T(-0.)), V(7)), V(7));
+    COMPARE(Vc::hypot(V(big), V(0)), V(big));
+    COMPARE(Vc::hypot(V(big), V(big)), V(inf));
+    COMPARE(Vc::hypot(V(big / 2), V(big / 2)), V(T(std::hypot(
+                                                   static_cast<long double>(big / 2),
+                                                   static_cast<long double>(big / 2)))));
+    COMPARE(Vc::hypot(V(denorm), V(0)), V(denorm));
+    COMPARE(Vc::hypot(V(3 * denorm), V(4 * denorm)), V(5 * denorm));
+    COMPARE(Vc::hypot(V(inf), V(nan)), V(inf));
+    COMPARE(Vc::hypot(V(nan), V(-inf)), V(inf));
+    VERIFY(all_of(isnan(Vc::hypot(V(nan), V(1)))));
+}
+
+//}}}1
+// vim: foldmethod=marker
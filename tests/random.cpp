@@ -26,6 +26,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 }}}*/
 
 #include "unittest.h"
+#include <thread>
 
 #ifdef _WIN32
 void bzero(void *p, size_t n) { memset(p, 0, n); }
@@ -83,6 +84,28 @@ TEST_TYPES(V, Random, AllVectors)
     }
 }
 
+TEST_TYPES(V, RandomPerThread, AllVectors)
+{
+    // every thread has its own V::Random() state, and no two threads start from the same
+    // one
+    enum { N = 16 };
+    V a[N], b[N];
+    const auto fill = [](V *out) {
+        for (int i = 0; i < N; ++i) {
+            out[i] = V::Random();
+        }
+    };
+    std::thread ta(fill, &a[0]);
+    ta.join();
+    std::thread tb(fill, &b[0]);
+    tb.join();
+    bool differ = false;
+    for (int i = 0; i < N; ++i) {
+        differ = differ || any_of(a[i] != b[i]);
+    }
+    VERIFY(differ) << "two threads produced the same V::Random() sequence";
+}
+
 template<typename V, typename I> void FloatRandom()
 {
     typedef typename V::EntryType T;
@@ -121,6 +144,107 @@ template<typename V, typename I> void FloatRandom()
     }
 }
 
+TEST_TYPES(V, RandomEngineSequences, RealVectors)
+{
+    Vc::RandomEngine<V> a(42, 1), b(42, 1), c(42, 2), d(43, 1);
+    for (int i = 0; i < 100; ++i) {
+        const V ra = a.uniform();
+        COMPARE(ra, b.uniform());
+        VERIFY(any_of(ra != c.uniform())) << "stream 1 and stream 2 must differ";
+        VERIFY(any_of(ra != d.uniform())) << "seed 42 and seed 43 must differ";
+    }
+
+    // jump() splits one sequence into non-overlapping substreams
+    Vc::RandomEngine<V> e(a);
+    e.jump();
+    COMPARE(a.uniform(), b.uniform());
+    VERIFY(any_of(a.uniform() != e.uniform()));
+
+    // reseeding restarts the sequence
+    a.seed(7, 3);
+    b.seed(7, 3);
+    for (int i = 0; i < 10; ++i) {
+        COMPARE(a.uniform(), b.uniform());
+    }
+}
+
+TEST_TYPES(V, RandomEngineUniform, RealVectors)
+{
+    typedef typename V::EntryType T;
+    enum { NBins = 64, Mean = 20000 };
+    int histogram[NBins] = {};
+    Vc::RandomEngine<V> engine(12345);
+    for (size_t i = 0; i < NBins * Mean / V::Size; ++i) {
+        const V x = engine.uniform();
+        VERIFY(all_of(x >= V::Zero() && x < V::One())) << x;
+        const auto bin = Vc::simd_cast<Vc::SimdArray<int, V::Size>>(x * T(NBins));
+        for (size_t k = 0; k < V::Size; ++k) {
+            ++histogram[bin[k]];
+        }
+    }
+    for (int bin = 0; bin < NBins; ++bin) {
+        VERIFY(histogram[bin] > Mean - Mean / 20) << "bin " << bin << ": " << histogram[bin];
+        VERIFY(histogram[bin] < Mean + Mean / 20) << "bin " << bin << ": " << histogram[bin];
+    }
+
+    const V x = engine.uniform(V(-3), V(-2));
+    VERIFY(all_of(x >= V(-3) && x < V(-2))) << x;
+}
+
+TEST_TYPES(V, RandomEngineDistributions, RealVectors)
+{
+    typedef typename V::EntryType T;
+    enum { N = 200003 };  // not a multiple of V::Size to cover the tail handling
+    std::vector<T> data(N, T(-1000));
+    Vc::RandomEngine<V> engine(2026, 5);
+
+    const auto moments = [&]() {
+        double sum = 0, sum2 = 0;
+        for (T x : data) {
+            sum += x;
+            sum2 += double(x) * x;
+        }
+        const double mean = sum / N;
+        return std::make_pair(mean, sum2 / N - mean * mean);
+    };
+
+    engine.generate_uniform(&data[0], &data[0] + N);
+    for (T x : data) {
+        VERIFY(x >= T(0) && x < T(1)) << x;
+    }
+    auto m = moments();
+    VERIFY(std::abs(m.first - 0.5) < 0.005) << m.first;
+    VERIFY(std::abs(m.second - 1. / 12.) < 0.002) << m.second;
+
+    engine.generate_normal(&data[0], &data[0] + N);
+    m = moments();
+    VERIFY(std::abs(m.first) < 0.01) << m.first;
+    VERIFY(std::abs(m.second - 1) < 0.02) << m.second;
+
+    engine.generate_exponential(&data[0], &data[0] + N, T(2));
+    for (T x : data) {
+        VERIFY(x >= T(0)) << x;
+    }
+    m = moments();
+    VERIFY(std::abs(m.first - 0.5) < 0.01) << m.first;
+    VERIFY(std::abs(m.second - 0.25) < 0.01) << m.second;
+
+    double sum = 0, sum2 = 0;
+    for (int i = 0; i < N / int(V::Size); ++i) {
+        const V x = engine.normal(V(3), V(2));
+        sum += x.sum();
+        sum2 += (x * x).sum();
+    }
+    const double n = N / int(V::Size) * V::Size;
+    VERIFY(std::abs(sum / n - 3) < 0.03) << sum / n;
+    VERIFY(std::abs(sum2 / n - 9 - 4) < 0.2) << sum2 / n;
+    sum = 0;
+    for (int i = 0; i < N / int(V::Size); ++i) {
+        sum += engine.exponential().sum();
+    }
+    VERIFY(std::abs(sum / n - 1) < 0.02) << sum / n;
+}
+
 namespace Tests
 {
 template <> void Random_<float_v>::run()
@@ -32,7 +32,9 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 using namespace Vc;
 
-TEST_TYPES(Vec, scatterArray, AllTypes) //{{{1
+#define ALL_TYPES concat<AllTypes, ByteVectors, Int64Vectors>
+
+TEST_TYPES(Vec, scatterArray, ALL_TYPES) //{{{1
 {
     typedef typename Vec::EntryType T;
     typedef typename Vec::IndexType It;
@@ -81,7 +83,7 @@ TEST_TYPES(Vec, scatterArray, AllTypes) //{{{1
     COMPARE(0, std::memcmp(&array[0], &out[0], count * sizeof(typename Vec::EntryType)));
 }
 
-TEST_TYPES(Vec, maskedScatterArray, AllTypes) //{{{1
+TEST_TYPES(Vec, maskedScatterArray, ALL_TYPES) //{{{1
 {
     typedef typename Vec::IndexType It;
     typedef typename Vec::EntryType T;
@@ -100,6 +102,30 @@ TEST_TYPES(Vec, maskedScatterArray, AllTypes) //{{{1
     });
 }
 
+TEST_TYPES(Vec, maskedScatterKeepsUnselected, concat<AllVectors, ByteVectors, Int64Vectors>) //{{{1
+{
+    // no index is 0, so a scatter must not touch mem[0], whatever the mask and the gather
+    // strategy (Vc_USE_SET_GATHERS used to redirect masked-off lanes to index 0)
+    typedef typename Vec::IndexType It;
+    typedef typename Vec::EntryType T;
+
+    Vc::array<T, Vec::Size + 1> mem;
+    const Vec v = Vec([](T n) { return n + 1; });
+    const It indexes([](int n) { return Vec::Size - n; });
+
+    withRandomMask<Vec>([&](typename Vec::mask_type m) {
+        for (auto &x : mem) {
+            x = T(100);
+        }
+        v.scatter(&mem[0], indexes, m);
+
+        COMPARE(mem[0], T(100)) << "m = " << m;
+        for (size_t i = 0; i < Vec::Size; ++i) {
+            COMPARE(mem[Vec::Size - i], m[i] ? v[i] : T(100)) << "i = " << i << ", m = " << m;
+        }
+    });
+}
+
 template<typename T, std::size_t Align> struct Struct //{{{1
 {
     alignas(Align) T a;
@@ -110,7 +136,7 @@ template<typename T, std::size_t Align> struct Struct //{{{1
     char z;
 };
 
-TEST_TYPES(Vec, scatterStruct, AllTypes) //{{{1
+TEST_TYPES(Vec, scatterStruct, ALL_TYPES) //{{{1
 {
     typedef typename Vec::IndexType It;
     typedef Struct<typename Vec::EntryType, sizeof(typename Vec::EntryType)> S;
@@ -175,7 +201,7 @@ template<typename V> V makeReference(V v, typename V::Mask m)
     v.setZero(!m);
     return v;
 }
-TEST_TYPES(Vec, scatterStruct2, AllTypes) //{{{1
+TEST_TYPES(Vec, scatterStruct2, ALL_TYPES) //{{{1
 {
     typedef typename Vec::IndexType It;
     typedef Struct2<typename Vec::EntryType, sizeof(typename Vec::EntryType)> S1;
@@ -0,0 +1,193 @@
+/*  This file is part of the Vc library. {{{
+Copyright © 2026 Matthias Kretz <kretz@kde.org>
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+    * Neither the names of contributing organizations nor the
+      names of its contributors may be used to endorse or promote products
+      derived from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER BE LIABLE FOR ANY
+DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+}}}*/
+
+#include "unittest.h"
+#include <cstdint>
+
+template <typename T> static void verifyPadding(const Vc::SimdVector<T> &v) //{{{1
+{
+    for (std::size_t i = v.size(); i < v.vectorsCount() * Vc::Vector<T>::Size; ++i) {
+        COMPARE(v.data()[i], T(0)) << "size = " << v.size() << ", i = " << i;
+    }
+}
+
+TEST_TYPES(V, pushBack, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::SimdVector<T> v;
+    COMPARE(v.size(), 0u);
+    COMPARE(v.capacity(), 0u);
+    VERIFY(v.empty());
+    VERIFY(v.begin() == v.end());
+
+    std::size_t reallocations = 0;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        const std::size_t capacity = v.capacity();
+        v.push_back(T(i % 100));
+        reallocations += v.capacity() != capacity;
+        COMPARE(v.size(), i + 1);
+        COMPARE(v.capacity() % V::Size, 0u);
+        VERIFY(reinterpret_cast<std::uintptr_t>(v.data()) % alignof(V) == 0);
+        verifyPadding(v);
+    }
+    // amortized growth
+    VERIFY(reallocations <= 12) << reallocations;
+    for (std::size_t i = 0; i < 1000; ++i) {
+        COMPARE(v[i], T(i % 100));
+    }
+    COMPARE(v.back(), T(99));
+    COMPARE(v.front(), T(0));
+
+    v.pop_back();
+    COMPARE(v.size(), 999u);
+    verifyPadding(v);
+}
+
+TEST_TYPES(V, vectorAccess, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    for (std::size_t n : {1u, 2u, 5u, 16u, 17u, 100u}) {
+        Vc::SimdVector<T> v;
+        v.reserve(n);
+        COMPARE(v.capacity(), (n + V::Size - 1) / V::Size * V::Size);
+        for (std::size_t i = 0; i < n; ++i) {
+            v.push_back(T(1));
+        }
+        COMPARE(v.vectorsCount(), (n + V::Size - 1) / V::Size);
+        std::size_t count = 0;
+        // whole-vector access up to the padded end
+        for (auto &x : v) {
+            x += V(T(1));
+            ++count;
+        }
+        COMPARE(count, v.vectorsCount());
+        V sum = V::Zero();
+        for (std::size_t i = 0; i < v.vectorsCount(); ++i) {
+            sum += v.vector(i);
+        }
+        // the padding was 0 and is 1 now
+        COMPARE(sum.sum(), T(2 * n + (v.vectorsCount() * V::Size - n)));
+        v.resize(v.size());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(v[i], T(2));
+        }
+    }
+}
+
+TEST_TYPES(V, resize, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::SimdVector<T> v(13);
+    COMPARE(v.size(), 13u);
+    for (std::size_t i = 0; i < 13; ++i) {
+        COMPARE(v[i], T(0));
+    }
+    verifyPadding(v);
+    v.resize(40, T(3));
+    COMPARE(v.size(), 40u);
+    COMPARE(v[12], T(0));
+    COMPARE(v[13], T(3));
+    COMPARE(v[39], T(3));
+    verifyPadding(v);
+    v.resize(3);
+    COMPARE(v.size(), 3u);
+    verifyPadding(v);
+    v.shrink_to_fit();
+    COMPARE(v.capacity(), (3 + V::Size - 1) / V::Size * V::Size);
+    COMPARE(v[2], T(0));
+    v.clear();
+    VERIFY(v.empty());
+    verifyPadding(v);
+
+    Vc::SimdVector<T> w(5, T(7));
+    COMPARE(w.at(4), T(7));
+    bool thrown = false;
+    try {
+        w.at(5);
+    } catch (const std::out_of_range &) {
+        thrown = true;
+    }
+    VERIFY(thrown);
+
+    Vc::SimdVector<T> init = {T(1), T(2), T(3)};
+    COMPARE(init.size(), 3u);
+    COMPARE(init[2], T(3));
+    verifyPadding(init);
+}
+
+TEST_TYPES(V, copyAndMove, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::SimdVector<T> a;
+    for (int i = 0; i < 50; ++i) {
+        a.push_back(T(i));
+    }
+    Vc::SimdVector<T> b(a);
+    COMPARE(b.size(), 50u);
+    VERIFY(b.data() != a.data());
+    COMPARE(b[49], T(49));
+    verifyPadding(b);
+
+    const T *data = a.data();
+    Vc::SimdVector<T> c(std::move(a));
+    COMPARE(c.data(), data);
+    COMPARE(c.size(), 50u);
+    VERIFY(a.empty());
+    COMPARE(a.capacity(), 0u);
+
+    a = std::move(c);
+    COMPARE(a.data(), data);
+    b = Vc::SimdVector<T>(3, T(1));
+    COMPARE(b.size(), 3u);
+    verifyPadding(b);
+    b = a;
+    COMPARE(b.size(), 50u);
+    COMPARE(b[17], T(17));
+
+    // to and from Vc::Memory
+    Vc::Memory<V> m(b);
+    COMPARE(m.entriesCount(), 50u);
+    COMPARE(m[17], T(17));
+    Vc::SimdVector<T> d(m);
+    COMPARE(d.size(), 50u);
+    COMPARE(d[49], T(49));
+    verifyPadding(d);
+}
+
+TEST_TYPES(V, allocationPolicy, AllVectors) //{{{1
+{
+    typedef typename V::EntryType T;
+    Vc::AlignedArena::local().reset();
+    Vc::SimdVector<T, Vc::ThreadLocalArena> v;
+    for (int i = 0; i < 10000; ++i) {
+        v.push_back(T(i % 7));
+    }
+    COMPARE(v[9999], T(9999 % 7));
+    VERIFY(reinterpret_cast<std::uintptr_t>(v.data()) % alignof(V) == 0);
+}
+
+// vim: foldmethod=marker
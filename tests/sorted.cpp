@@ -27,7 +27,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "unittest.h"
 
-TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, SimdArrays<3>, SimdArrays<1>>)
+TEST_TYPES(Vec, testSort, concat<AllVectors, ByteVectors, Int64Vectors, SimdArrays<15>, SimdArrays<8>, SimdArrays<3>, SimdArrays<1>>)
 {
 // On GCC/clang (i.e. __GNUC__ compatible) __OPTIMIZE__ is not defined on -O0.
 // We use this information to make the test complete in a sane timeframe on debug
@@ -89,4 +89,54 @@ TEST_TYPES(Vec, testSort, concat<AllVectors, SimdArrays<15>, SimdArrays<8>, Simd
     }
 }
 
+TEST_TYPES(Vec, testSortedWithIndex,
+           concat<AllVectors, ByteVectors, Int64Vectors, SimdArrays<15>, SimdArrays<8>,
+                  SimdArrays<3>, SimdArrays<1>>)
+{
+    using T = typename Vec::EntryType;
+    using IV = typename Vec::IndexType;
+    for (int repetition = 0; repetition < 1000; ++repetition) {
+        // few distinct values to test duplicate keys
+        const Vec test = Vc::iif(Vec::Random() > Vec(T(1)), Vec(T(3)), Vec(T(1))) +
+                         Vec::generate([](int i) { return T(i % 3); });
+        alignas(static_cast<size_t>(
+            Vec::MemoryAlignment)) T reference[Vec::Size] = {};
+        test.store(&reference[0], Vc::Aligned);
+        std::sort(std::begin(reference), std::end(reference));
+
+        const auto sorted = Vc::sorted_with_index(test);
+        COMPARE(sorted.first, Vec(&reference[0], Vc::Aligned)) << ", test: " << test;
+        bool used[Vec::Size] = {};
+        for (size_t i = 0; i < Vec::Size; ++i) {
+            const int j = sorted.second[i];
+            VERIFY(j >= 0 && j < int(Vec::Size)) << j;
+            VERIFY(!used[j]) << sorted.second;
+            used[j] = true;
+            COMPARE(sorted.first[i], test[j]) << ", i: " << i;
+        }
+
+        // the payload follows the keys
+        Vec keys = test;
+        IV values = Vc::simd_cast<IV>(test) * 2 + 1;
+        Vc::sort_key_value(keys, values);
+        COMPARE(keys, sorted.first);
+        COMPARE(values, Vc::simd_cast<IV>(keys) * 2 + 1);
+    }
+
+    if (std::is_floating_point<T>::value) {
+        // NaN keys have no rank, the payload must still be permuted
+        Vec keys = Vec::generate([](int i) { return T(int(Vec::Size) - i); });
+        keys[0] = std::numeric_limits<T>::quiet_NaN();
+        IV values(Vc::IndexesFromZero);
+        Vc::sort_key_value(keys, values);
+        bool used[Vec::Size] = {};
+        for (size_t i = 0; i < Vec::Size; ++i) {
+            const int j = values[i];
+            VERIFY(j >= 0 && j < int(Vec::Size)) << j;
+            VERIFY(!used[j]) << values;
+            used[j] = true;
+        }
+    }
+}
+
 // vim: foldmethod=marker
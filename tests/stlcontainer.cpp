@@ -28,6 +28,7 @@
 #include <forward_list>
 #include <list>
 #include <deque>
+#include <atomic>
 
 #include "../Vc/common/macros.h"
 
@@ -176,4 +177,334 @@ TEST_TYPES(V, simdForEach, AllVectors)
         for_each(test3);
     }
 }
+
+TEST_TYPES(V, simdForEachMaskedEpilogue, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T, Vc::Allocator<T>> data(4 * V::Size + 2);
+
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t n = 0; n + offset <= data.size(); ++n) {
+            for (int variant = 0; variant < 2; ++variant) {
+                std::iota(data.begin(), data.end(), T(1));
+                const auto first = data.begin() + offset;
+                int calls = 0;
+                auto &&increment = [&](auto &x) {
+                    static_assert(std::is_same<decltype(x), V &>::value,
+                                  "MaskedEpilogue must only call with the full vector type");
+                    ++calls;
+                    x += 1;
+                };
+                if (variant == 0) {
+                    Vc::simd_for_each(Vc::MaskedEpilogue, first, first + n, increment);
+                } else {
+                    Vc::simd_for_each_n(Vc::MaskedEpilogue, first, n, increment);
+                }
+                VERIFY(calls <= int((n + 2 * V::Size - 2) / V::Size))
+                    << "calls: " << calls << ", n: " << n << ", offset: " << offset;
+                for (std::size_t i = 0; i < data.size(); ++i) {
+                    const bool inside = i >= offset && i < offset + n;
+                    COMPARE(data[i], T(i + 1 + inside))
+                        << "i: " << i << ", n: " << n << ", offset: " << offset;
+                }
+
+                T sum = 0;
+                auto &&accumulate = [&](auto x) { sum += x.sum(); };
+                if (variant == 0) {
+                    Vc::simd_for_each(Vc::MaskedEpilogue, first, first + n, accumulate);
+                } else {
+                    Vc::simd_for_each_n(Vc::MaskedEpilogue, first, n, accumulate);
+                }
+                COMPARE(sum, std::accumulate(first, first + n, T(0)))
+                    << "n: " << n << ", offset: " << offset;
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, simdForEachParallel, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T, Vc::Allocator<T>> data(300000);
+
+    for (std::size_t offset : {0, 1, 3}) {
+        for (std::size_t n : {std::size_t(0), std::size_t(5), data.size() - offset,
+                              data.size() / 3 + 7}) {
+            for (int variant = 0; variant < 2; ++variant) {
+                std::fill(data.begin(), data.end(), T(1));
+                const auto first = data.begin() + offset;
+                auto &&increment = [](auto &x) { x += 1; };
+                if (variant == 0) {
+                    Vc::simd_for_each(Vc::par, first, first + n, increment);
+                } else {
+                    Vc::simd_for_each_n(Vc::par, first, n, increment);
+                }
+                for (std::size_t i = 0; i < data.size(); ++i) {
+                    const bool inside = i >= offset && i < offset + n;
+                    COMPARE(data[i], T(1 + inside))
+                        << "i: " << i << ", n: " << n << ", offset: " << offset;
+                }
+
+                std::atomic<long long> sum(0);
+                auto &&accumulate = [&sum](const V &x) {
+                    sum += static_cast<long long>(x.sum());
+                };
+                if (variant == 0) {
+                    Vc::simd_for_each(Vc::par, first, first + n, accumulate);
+                } else {
+                    Vc::simd_for_each_n(Vc::par, first, n, accumulate);
+                }
+                COMPARE(sum.load(), 2 * static_cast<long long>(n)) << "n: " << n << ", offset: " << offset;
+            }
+        }
+    }
+
+    // like the sequential overloads, the parallel ones return the functor
+    struct Count {
+        std::size_t *calls;
+        void operator()(const V &) const { ++*calls; }
+    };
+    std::size_t calls = 0;
+    const auto first = data.begin();
+    Count f = Vc::simd_for_each(Vc::par, first, first + V::Size, Count{&calls});
+    COMPARE(f.calls, &calls);
+    f = Vc::simd_for_each_n(Vc::par, first, V::Size, Count{&calls});
+    COMPARE(f.calls, &calls);
+    COMPARE(calls, std::size_t(2));
+}
+
+TEST_TYPES(V, simdTransform, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> a(3 * V::Size + 3), b(a.size()), out(a.size() + 1);
+    std::iota(a.begin(), a.end(), T(1));
+    std::iota(b.rbegin(), b.rend(), T(2));
+
+    for (std::size_t n = 0; n <= a.size(); ++n) {
+        std::fill(out.begin(), out.end(), T(0));
+        auto it = Vc::simd_transform(a.begin(), a.begin() + n, out.begin(),
+                                     [](auto x) { return x * T(2); });
+        COMPARE(it - out.begin(), std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            COMPARE(out[i], i < n ? T(a[i] * 2) : T(0)) << "i: " << i << ", n: " << n;
+        }
+
+        std::fill(out.begin(), out.end(), T(0));
+        it = Vc::simd_transform(a.begin(), a.begin() + n, b.begin(), out.begin(),
+                                [](auto x, auto y) { return x - y; });
+        COMPARE(it - out.begin(), std::ptrdiff_t(n));
+        for (std::size_t i = 0; i < out.size(); ++i) {
+            COMPARE(out[i], i < n ? T(a[i] - b[i]) : T(0)) << "i: " << i << ", n: " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, simdTransformReduce, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> a(9 * V::Size + 3), b(a.size());
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i % 7);
+        b[i] = T(i % 3 + 1);
+    }
+    auto &&plus = [](auto x, auto y) { return x + y; };
+    auto &&times = [](auto x, auto y) { return x * y; };
+    auto &&max = [](auto x, auto y) { return Vc::iif(x < y, y, x); };
+
+    for (std::size_t n = 0; n <= a.size(); ++n) {
+        T sum = 0, dot = 0, maximum = 0;
+        for (std::size_t i = 0; i < n; ++i) {
+            sum += T(a[i] + 1);
+            dot += a[i] * b[i];
+            maximum = std::max(maximum, a[i]);
+        }
+        COMPARE(Vc::simd_transform_reduce(a.begin(), a.begin() + n, T(0), plus,
+                                          [](auto x) { return x + T(1); }),
+                sum)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(a.begin(), a.begin() + n, b.begin(), T(0), plus,
+                                          times),
+                dot)
+            << "n: " << n;
+        COMPARE(Vc::simd_transform_reduce(a.begin(), a.begin() + n, T(0), max,
+                                          [](auto x) { return x; }),
+                maximum)
+            << "n: " << n;
+    }
+}
+
+TEST_TYPES(V, simdFind, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> a(4 * V::Size + 3);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i % 11);
+    }
+
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t n = 0; offset + n <= a.size(); ++n) {
+            const auto first = a.begin() + offset;
+            const auto last = first + n;
+            for (T x : {T(0), T(5), T(10), T(12)}) {
+                COMPARE(Vc::simd_find(first, last, x) - first, std::find(first, last, x) - first)
+                    << "offset: " << offset << ", n: " << n << ", x: " << x;
+                COMPARE(Vc::simd_count(first, last, x), std::count(first, last, x))
+                    << "offset: " << offset << ", n: " << n << ", x: " << x;
+            }
+            COMPARE(Vc::simd_find_if(first, last, [](auto v) { return v > T(8); }) - first,
+                    std::find_if(first, last, [](T v) { return v > T(8); }) - first);
+            COMPARE(Vc::simd_count_if(first, last, [](auto v) { return v < T(4); }),
+                    std::count_if(first, last, [](T v) { return v < T(4); }));
+            COMPARE(Vc::simd_any_of(first, last, [](auto v) { return v == T(3); }),
+                    std::any_of(first, last, [](T v) { return v == T(3); }));
+            COMPARE(Vc::simd_none_of(first, last, [](auto v) { return v == T(3); }),
+                    std::none_of(first, last, [](T v) { return v == T(3); }));
+            COMPARE(Vc::simd_all_of(first, last, [](auto v) { return v < T(10); }),
+                    std::all_of(first, last, [](T v) { return v < T(10); }));
+        }
+    }
+}
+
+TEST_TYPES(V, simdMismatch, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> a(4 * V::Size + 3);
+    std::iota(a.begin(), a.end(), T(0));
+
+    for (std::size_t offset = 0; offset <= V::Size; ++offset) {
+        for (std::size_t n = 0; offset + n <= a.size(); ++n) {
+            std::vector<T> b(a.begin() + offset, a.begin() + offset + n + 1);
+            const auto first = a.begin() + offset;
+            auto r = Vc::simd_mismatch(first, first + n, b.begin());
+            COMPARE(r.first - first, std::ptrdiff_t(n)) << "offset: " << offset;
+            COMPARE(r.second - b.begin(), std::ptrdiff_t(n)) << "offset: " << offset;
+            for (std::size_t i = 0; i < n; ++i) {
+                b[i] += T(1);
+                r = Vc::simd_mismatch(first, first + n, b.begin());
+                COMPARE(r.first - first, std::ptrdiff_t(i)) << "offset: " << offset;
+                COMPARE(r.second - b.begin(), std::ptrdiff_t(i)) << "offset: " << offset;
+                r = Vc::simd_mismatch(first, first + n, b.begin(),
+                                      [](auto x, auto y) { return x <= y; });
+                COMPARE(r.first - first, std::ptrdiff_t(n)) << "offset: " << offset;
+                b[i] -= T(1);
+            }
+        }
+    }
+}
+
+TEST_TYPES(V, simdFindParallel, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> a(3 * V::Size + 1);
+    for (std::size_t i = 0; i < a.size(); ++i) {
+        a[i] = T(i % 13);
+    }
+    const V values = V(Vc::IndexesFromZero) * T(2);
+    const auto matches = Vc::simd_find_parallel(a.begin(), a.end(), values);
+    for (std::size_t i = 0; i < V::Size; ++i) {
+        COMPARE(matches[i] - a.begin(), std::find(a.begin(), a.end(), values[i]) - a.begin())
+            << "i: " << i;
+    }
+}
+
+TEST_TYPES(V, simdSort, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> input(1000 * V::Size + 8);
+    unsigned state = 1;
+    for (auto &x : input) {
+        state = state * 1103515245u + 12345u;
+        x = T((state >> 8) % 20000) - T(10000);
+    }
+    for (std::size_t n :
+         {std::size_t(0), std::size_t(1), 2 * V::Size + 1, 256 * V::Size - 1,
+          256 * V::Size, 256 * V::Size + 1, 260 * V::Size + 3, 261 * V::Size,
+          263 * V::Size + 5, 515 * V::Size + 2, 1000 * V::Size + 7}) {
+        for (std::size_t offset : {std::size_t(0), std::size_t(1)}) {
+            std::vector<T> reference(input.begin() + offset, input.begin() + offset + n);
+            std::sort(reference.begin(), reference.end());
+            std::vector<T> data(input.begin(), input.begin() + offset + n + 1);
+            Vc::simd_sort(data.begin() + offset, data.begin() + offset + n);
+            COMPARE(data[offset + n], input[offset + n]) << "n: " << n;
+            VERIFY(std::equal(reference.begin(), reference.end(), data.begin() + offset))
+                << "n: " << n << ", offset: " << offset;
+        }
+    }
+}
+
+TEST_TYPES(V, simdArgsort, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> input(600 * V::Size);
+    unsigned state = 1;
+    for (auto &x : input) {
+        state = state * 1103515245u + 12345u;
+        x = T((state >> 8) % 2000);
+    }
+    input[7] = std::numeric_limits<T>::max();
+    input[8] = std::numeric_limits<T>::max();
+    for (std::size_t n : {std::size_t(0), std::size_t(1), 2 * V::Size + 1, 256 * V::Size,
+                          257 * V::Size + 3, 300 * V::Size + 1, 600 * V::Size}) {
+        std::vector<int> index(n + 1, -1);
+        COMPARE(Vc::simd_argsort(input.begin(), input.begin() + n, index.begin()) -
+                    index.begin(),
+                std::ptrdiff_t(n));
+        COMPARE(index[n], -1);
+        for (std::size_t i = 1; i < n; ++i) {
+            VERIFY(input[index[i - 1]] <= input[index[i]]) << "n: " << n << ", i: " << i;
+        }
+        index.pop_back();
+        std::sort(index.begin(), index.end());
+        for (std::size_t i = 0; i < n; ++i) {
+            COMPARE(index[i], int(i)) << "n: " << n;
+        }
+    }
+}
+
+TEST_TYPES(V, simdCopyIf, AllVectors)
+{
+    typedef typename V::EntryType T;
+    std::vector<T> input(5 * V::Size + 3);
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        input[i] = T(i % 7);
+    }
+    const auto pred = [](auto v) { return v > 2; };
+    for (std::size_t n : {std::size_t(0), std::size_t(1), V::Size - 1, V::Size, 4 * V::Size,
+                          5 * V::Size + 2}) {
+        for (std::size_t offset : {std::size_t(0), std::size_t(1)}) {
+            const auto first = input.begin() + offset;
+            std::vector<T> reference;
+            std::copy_if(first, first + n, std::back_inserter(reference),
+                         [](T x) { return x > 2; });
+
+            std::vector<T> out(n + 1, T(-1));
+            COMPARE(Vc::simd_copy_if(first, first + n, out.begin(), pred) - out.begin(),
+                    std::ptrdiff_t(reference.size()))
+                << "n: " << n;
+            COMPARE(out[reference.size()], T(-1)) << "n: " << n;
+            VERIFY(std::equal(reference.begin(), reference.end(), out.begin())) << "n: " << n;
+
+            std::vector<T> removed(first, first + n);
+            COMPARE(Vc::simd_remove_if(removed.begin(), removed.end(), pred) -
+                        removed.begin(),
+                    std::ptrdiff_t(n - reference.size()))
+                << "n: " << n;
+            for (std::size_t i = 0, j = 0; i < n; ++i) {
+                if (!(first[i] > 2)) {
+                    COMPARE(removed[j++], first[i]) << "n: " << n << ", i: " << i;
+                }
+            }
+
+            std::vector<T> partitioned(first, first + n);
+            std::vector<T> stable(first, first + n);
+            const auto mid = std::stable_partition(stable.begin(), stable.end(),
+                                                   [](T x) { return x > 2; });
+            COMPARE(Vc::simd_partition(partitioned.begin(), partitioned.end(), pred) -
+                        partitioned.begin(),
+                    mid - stable.begin())
+                << "n: " << n;
+            VERIFY(partitioned == stable) << "n: " << n;
+        }
+    }
+}
 #endif
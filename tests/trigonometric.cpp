@@ -99,6 +99,42 @@ TEST_TYPES(V, testCos, RealTypes) //{{{1
     }
 }
 
+TEST_TYPES(V, testTan, RealTypes) //{{{1
+{
+    typedef typename V::EntryType T;
+    setFuzzyness<float>(5);
+    setFuzzyness<double>(4);
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(16384);
+        const V ref = x.apply(
+            [](T _x) { return T(std::tan(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(Vc::tan(x), ref) << " x = " << x << ", i = " << i;
+        FUZZY_COMPARE(Vc::tan(-x), -ref) << " x = " << -x << ", i = " << i;
+    }
+
+    const T inf = std::numeric_limits<T>::infinity();
+    COMPARE(Vc::tan(V(0)), V(0));
+    COMPARE(std::signbit(Vc::tan(V(T(-0.)))[0]), true);
+    VERIFY(all_of(isnan(Vc::tan(V(inf)))));
+    VERIFY(all_of(isnan(Vc::tan(V(-inf)))));
+    VERIFY(all_of(isnan(Vc::tan(V(std::numeric_limits<T>::quiet_NaN())))));
+}
+
+TEST_TYPES(V, testSincosMatchesSinCos, RealTypes) //{{{1
+{
+    // SimdArray interleaves the sincos evaluation of its halves; the result must not
+    // differ from separate sin and cos calls. (Above 393382 single-precision sin switches
+    // to double precision later than sincos and cos do.)
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 10000 / V::Size; ++i) {
+        const V x = (V::Random() - T(0.5)) * T(i < 5000 / V::Size ? 100 : 780000);
+        V sin, cos;
+        Vc::sincos(x, &sin, &cos);
+        COMPARE(sin, Vc::sin(x)) << " x = " << x << ", i = " << i;
+        COMPARE(cos, Vc::cos(x)) << " x = " << x << ", i = " << i;
+    }
+}
+
 TEST_TYPES(V, testAsin, RealTypes) //{{{1
 {
     typedef typename V::EntryType T;
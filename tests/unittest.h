@@ -35,6 +35,10 @@ using RealVectors = vir::Typelist<Vc::native_simd<double>, Vc::native_simd<float
 using IntVectors = vir::Typelist<Vc::native_simd<int>, Vc::native_simd<unsigned short>,
                                  Vc::native_simd<unsigned int>, Vc::native_simd<short>>;
 using AllVectors = vir::concat<RealVectors, IntVectors>;
+using ByteVectors =
+    vir::Typelist<Vc::native_simd<signed char>, Vc::native_simd<unsigned char>>;
+using Int64Vectors =
+    vir::Typelist<Vc::native_simd<long long>, Vc::native_simd<unsigned long long>>;
 using AllMasks = vir::Typelist<Vc::double_m, Vc::float_m, Vc::int_m, Vc::short_m>;
 template <int N>
 using RealSimdArrays =
@@ -111,6 +115,20 @@ template <typename V, int Repetitions = 10000, typename F> void withRandomMask(F
     }
 }
 // }}}
+// compareWithLongDoubleReference {{{
+// Compares fun(x) against ref evaluated in long double, for random x in [lo, hi).
+template <typename V, typename F, typename R>
+void compareWithLongDoubleReference(F &&fun, R &&ref, typename V::EntryType lo,
+                                    typename V::EntryType hi)
+{
+    typedef typename V::EntryType T;
+    for (size_t i = 0; i < 100000 / V::Size; ++i) {
+        const V x = V::Random() * (hi - lo) + lo;
+        const V reference = x.apply([&](T _x) { return T(ref(static_cast<long double>(_x))); });
+        FUZZY_COMPARE(fun(x), reference) << ", x = " << x << ", i = " << i;
+    }
+}
+// }}}
 // vir::test::compare_traits specialization {{{
 template <class Lhs, class Rhs, class = void> struct vc1_compare_traits {
     using common_type = decltype(std::declval<Lhs>() + std::declval<Rhs>());
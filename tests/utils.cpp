@@ -193,7 +193,8 @@ TEST_TYPES(V, fill, AllVectors)
 }
 
 // shifted{{{1
-TEST_TYPES(V, shifted, AllVectors)
+TEST_TYPES(V, shifted, concat<AllVectors, ByteVectors, SimdArrays<16>, OddSimdArrays<15>,
+                                  SimdArrays<7>, SimdArrays<3>>)
 {
     typedef typename V::EntryType T;
     constexpr int Size = V::Size;
@@ -212,7 +213,7 @@ TEST_TYPES(V, shifted, AllVectors)
 
 // rotated{{{1
 TEST_TYPES(V, rotated,
-           concat<AllVectors, SimdArrays<16>, SimdArrays<15>, SimdArrays<11>,
+           concat<AllVectors, ByteVectors, SimdArrays<16>, SimdArrays<15>, SimdArrays<11>,
                   SimdArrays<9>, SimdArrays<8>, SimdArrays<7>, SimdArrays<3>>)
 {
     constexpr int Size = V::Size;
@@ -264,7 +265,8 @@ template <typename V, typename Shift> void shiftedInConstant(const V &data, Shif
     }
 }
 
-TEST_TYPES(V, shiftedIn, concat<AllVectors, SimdArrays<1>, SimdArrays<16>, OddSimdArrays<17>>)
+TEST_TYPES(V, shiftedIn, concat<AllVectors, ByteVectors, SimdArrays<1>, SimdArrays<16>,
+                                OddSimdArrays<17>>)
 {
     constexpr int Size = V::Size;
     const V data = V::Random();
@@ -279,6 +281,37 @@ TEST_TYPES(V, shiftedIn, concat<AllVectors, SimdArrays<1>, SimdArrays<16>, OddSi
     shiftedInConstant(V::Random(), std::integral_constant<int, Size>());
 }
 
+// shiftedInOtherSize{{{1
+template <typename V, typename W> void shiftedInOtherSize()
+{
+    using T = typename V::value_type;
+    constexpr int Size = V::Size;
+    constexpr int InSize = W::Size;
+    const V data = V::Random();
+    const W in = W::Random();
+    for (int shift = -Size + 1; shift < Size; ++shift) {
+        const V test = data.shifted(shift, in);
+        for (int i = 0; i < Size; ++i) {
+            // shiftIn is concatenated in front of (shift < 0) or behind (shift > 0) data
+            const int j = i + shift;
+            const T reference = j >= 0 && j < Size
+                                    ? T(data[j])
+                                    : j < 0 ? T(in[j + InSize])
+                                            : j - Size < InSize ? T(in[j - Size]) : T(0);
+            COMPARE(test[i], reference) << "\nshift = " << shift << ", i = " << i
+                                        << "\ndata = " << data << "\nshiftIn = " << in;
+        }
+    }
+}
+
+TEST_TYPES(V, shiftedInOtherSize,
+           concat<SimdArrays<8>, SimdArrays<7>, SimdArrays<4>, SimdArrays<3>>)
+{
+    using T = typename V::value_type;
+    shiftedInOtherSize<V, Vc::fixed_size_simd<T, V::Size + 1>>();
+    shiftedInOtherSize<V, Vc::fixed_size_simd<T, V::Size - 1>>();
+}
+
 // testMallocAlignment{{{1
 TEST(testMallocAlignment)
 {